@@ -0,0 +1,55 @@
+# Fails if any weak symbol is defined both in one of the AVX kernel objects and in a baseline object.
+# Anything the kernels instantiate that isn't templated on the arch gets the same mangled name in every TU - and the linker is free to keep the wide copy,
+# which then crashes on machines without the instruction set. Run via ctest (see the root CMakeLists.txt), with:
+#   MARVIN_NM       - path to nm.
+#   MARVIN_OBJECTS  - the marvin library's object files, separated by `|`.
+if (NOT MARVIN_NM OR NOT MARVIN_OBJECTS)
+    message(FATAL_ERROR "MARVIN_NM and MARVIN_OBJECTS must be set")
+endif ()
+string(REPLACE "|" ";" objects "${MARVIN_OBJECTS}")
+set(kernel_symbols)
+set(baseline_symbols)
+foreach (object IN LISTS objects)
+    execute_process(
+            COMMAND ${MARVIN_NM} --defined-only "${object}"
+            OUTPUT_VARIABLE nm_output
+            RESULT_VARIABLE nm_result
+    )
+    if (NOT nm_result EQUAL 0)
+        message(FATAL_ERROR "${MARVIN_NM} failed on ${object}")
+    endif ()
+    # Weak functions only - weak objects (V) are data, so it doesn't matter which copy wins.
+    string(REGEX MATCHALL "[^\n]* W [^\n]+" weak_lines "${nm_output}")
+    list(TRANSFORM weak_lines REPLACE "^.* W " "")
+    if (object MATCHES "_AVX(2|512)")
+        list(APPEND kernel_symbols ${weak_lines})
+    else ()
+        list(APPEND baseline_symbols ${weak_lines})
+    endif ()
+endforeach ()
+if (NOT kernel_symbols)
+    message(FATAL_ERROR "No weak symbols found in the AVX kernel objects - is runtime dispatch enabled?")
+endif ()
+# Tag each side, sort the lot, and anything that shows up under both tags sits in adjacent entries.
+list(REMOVE_DUPLICATES kernel_symbols)
+list(REMOVE_DUPLICATES baseline_symbols)
+list(TRANSFORM kernel_symbols APPEND "|k")
+list(TRANSFORM baseline_symbols APPEND "|b")
+set(all_symbols ${kernel_symbols} ${baseline_symbols})
+list(SORT all_symbols)
+set(shared)
+set(previous "")
+foreach (entry IN LISTS all_symbols)
+    string(REGEX REPLACE "\\|[kb]$" "" symbol "${entry}")
+    if (symbol STREQUAL previous)
+        list(APPEND shared "${symbol}")
+    endif ()
+    set(previous "${symbol}")
+endforeach ()
+list(LENGTH kernel_symbols num_kernel_symbols)
+if (shared)
+    list(LENGTH shared num_shared)
+    list(JOIN shared "\n  " shared_list)
+    message(FATAL_ERROR "${num_shared} weak symbol(s) are defined in both the AVX kernel objects and the baseline objects (pipe through c++filt to demangle):\n  ${shared_list}")
+endif ()
+message(STATUS "No shared weak symbols (${num_kernel_symbols} checked)")
@@ -47,7 +47,9 @@ namespace marvin {
 
             On macOS this will use Accelerate's vDSP library for SIMD intrinsics. On Windows, Marvin has an optional
             dependency on Intel's IPP library. If it's found by CMake, these functions will use the IPP implementations of
-            these functions. If it's *not* found, it will use the fallback implementations, which are simple for loops. <br>
+            these functions. If it's *not* found (and on Linux), it will use the fallback implementations, which are vectorised with xsimd. <br>
+            On x86-64, the fallback kernels are built for SSE2, AVX2 and AVX-512, and the widest one the CPU supports is chosen at runtime
+            (see marvin::utils::getInstructionSet()). <br>
             If you're struggling to get IPP installed, Sudara has a great [blog post](https://melatonin.dev/blog/using-intel-performance-primitives-ipp-with-juce-and-cmake/)
             detailing the hoops you need to jump through to get it up and running. <br>
 
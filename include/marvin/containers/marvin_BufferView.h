@@ -16,9 +16,9 @@ namespace marvin::containers {
     /**
         \brief Trivially copyable view into a preallocated SampleType**.
 
-        Useful as a lightweight and framework agnostic alternative to `xframework::AudioBuffer`.
+        Useful as a lightweight and framework agnostic alternative to `xframework::AudioBuffer`. Also accepts `std::complex<>` samples, for multichannel spectra.
     */
-    template <FloatType SampleType>
+    template <RealOrComplexFloatType SampleType>
     struct BufferView final {
         /**
             BufferView wraps around an already allocated SampleType**, and doesn't take ownership.<br>
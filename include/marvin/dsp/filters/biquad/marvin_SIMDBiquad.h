@@ -5,15 +5,106 @@
 #ifndef MARVIN_SIMDBIQUAD_H
 #define MARVIN_SIMDBIQUAD_H
 #include <marvin/dsp/filters/biquad/marvin_BiquadCoefficients.h>
-#include <xsimd/xsimd.hpp>
+#include <marvin/containers/marvin_BufferView.h>
 #include <marvin/library/marvin_Concepts.h>
 #include <marvin/math/marvin_VecOps.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <span>
 namespace marvin::dsp::filters {
+    namespace detail {
+        /**
+            The widest block (and so alignment) of SIMDBiquad's internal arrays - enough for the widest instruction set the kernels can be dispatched to (AVX-512).
+        */
+        inline constexpr size_t SIMDBiquadAlignment{ 64 };
+
+        /**
+            Non-owning view into a SIMDBiquad's coefficients and state, used to hand them to the runtime-dispatched kernel.
+            The filters are stored in blocks of `lanes` filters, with each block holding all of its filters' coefficients and state, one field after another - so
+            a block is a single contiguous run of memory. Filter `i`'s value for field `f` is at `data[(i / lanes * NumFields + f) * lanes + i % lanes]`.<br>
+            `lanes` is a power of two, at most one AVX-512 register's worth - so any arch's batches either divide evenly into a block, or are wider than it
+            (in which case the kernels drop to a narrower instruction set's batches, or process the filters one at a time if there isn't one that fits).
+        */
+        template <FloatType SampleType>
+        struct SIMDBiquadView final {
+            /**
+                The position of each coefficient and state array within a block.
+            */
+            enum Field : size_t {
+                A0,
+                A1,
+                A2,
+                B1,
+                B2,
+                X1,
+                X2,
+                Y1,
+                Y2,
+                NumFields
+            };
+
+            /**
+                The number of filters in each block. The data is aligned to `lanes * sizeof(SampleType)` bytes.
+            */
+            size_t lanes;
+            SampleType* data;
+        };
+
+        /**
+            Processes one sample through each of `numFilters` parallel biquads, in place. Bound at runtime to the widest
+            instruction set available (see `marvin::utils::getInstructionSet()`).
+            \param view The coefficients and state of the filters.
+            \param x A pointer to `numFilters` samples, which are overwritten with the filtered results.
+            \param numFilters The number of filters to process.
+        */
+        template <FloatType SampleType>
+        void processSIMDBiquads(SIMDBiquadView<SampleType> view, SampleType* x, size_t numFilters) noexcept;
+
+        /**
+            Processes a block of samples through each of `numFilters` parallel biquads, in place, keeping the coefficients and state in registers across the block.
+            Bound at runtime to the widest instruction set available, like `processSIMDBiquads`.
+            \param view The coefficients and state of the filters.
+            \param channels `numFilters` pointers, each to `numSamples` samples - channel i runs through filter i, and is overwritten with the filtered results.
+            \param numFilters The number of filters to process.
+            \param numSamples The number of samples in each channel.
+        */
+        template <FloatType SampleType>
+        void processSIMDBiquadsBlock(SIMDBiquadView<SampleType> view, SampleType* const* channels, size_t numFilters, size_t numSamples) noexcept;
+
+        /**
+            The number of lanes (ie filters per block) of the view a SIMDBiquad of `numFilters` filters stores them in - no wider than it needs to be for
+            `numFilters`, so a small bank isn't padded out to a whole AVX-512 register's worth of filters.
+        */
+        template <FloatType SampleType>
+        [[nodiscard]] constexpr size_t getSIMDBiquadLanes(size_t numFilters) noexcept {
+            return std::min(SIMDBiquadAlignment / sizeof(SampleType), std::bit_ceil(numFilters));
+        }
+
+        /**
+            The number of filters out of a bank of `numFilters` that the dispatched kernels process in batches, rather than one at a time. Filters that don't fill
+            one of the widest available instruction set's batches go through a narrower one's, so this is `numFilters` rounded down to a whole number of the
+            narrowest batches the kernels use.
+            \param lanes The view's number of lanes.
+            \param numFilters The number of filters in the bank.
+            \return The number of filters processed in batches.
+        */
+        template <FloatType SampleType>
+        [[nodiscard]] size_t getSIMDBiquadNumVectorised(size_t lanes, size_t numFilters) noexcept;
+    } // namespace detail
+
     /**
      * \brief A SIMD optimised biquad, for running N biquads in parallel.
      *
-     * From benchmarks, only gives a speedup in certain cases, and even in those cases, only ~100ns.
-     * That being said, a robust parallel structure for filters is arguably nicer than a std::array<filter, N>.
+     * Processing a sample at a time (via `operator()(std::span<SampleType, N>)`) has to load and store every coefficient and state vector per call, so only gives a
+     * speedup over a std::array<filter, N> in certain cases. Processing a block at a time (via `operator()(containers::BufferView<SampleType>)`) keeps them in registers for
+     * the whole block, so is the one to use for multichannel processing.
+     * The SIMD width isn't fixed at compile time - processing is forwarded to a kernel bound at runtime to the widest instruction set the CPU supports. Banks too
+     * small to fill one of its registers (eg 4 floats on AVX2), and the filters left over past its last full register (eg 4 of 12 floats on AVX2), use a narrower
+     * instruction set's registers instead.
+     * The coefficients and state live inside the object (interleaved per block of filters, see `detail::SIMDBiquadView`), so constructing one never allocates,
+     * and a container of them is a single contiguous allocation.
      *
      * @tparam SampleType float or double
      * @tparam N The number of parallel biquads to process
@@ -22,22 +113,6 @@ namespace marvin::dsp::filters {
     requires(N > 0)
     class SIMDBiquad final {
     public:
-        /**
-         * Constructor
-         */
-        SIMDBiquad() {
-            m_working.resize(N, 0.0);
-            m_a0.resize(N, 0.0);
-            m_a1.resize(N, 0.0);
-            m_a2.resize(N, 0.0);
-            m_b1.resize(N, 0.0);
-            m_b2.resize(N, 0.0);
-            m_x1.resize(N, 0.0);
-            m_x2.resize(N, 0.0);
-            m_y1.resize(N, 0.0);
-            m_y2.resize(N, 0.0);
-        }
-
         /**
          * Sets the coefficients for all filters to the ones passed to the `coeffs` arg
          *
@@ -45,30 +120,8 @@ namespace marvin::dsp::filters {
          */
         auto setCoeffs(BiquadCoefficients<SampleType> coeffs) noexcept -> void {
             m_equalCoeffs = true;
-            const auto a0 = coeffs.a0 / coeffs.b0;
-            const auto a1 = coeffs.a1 / coeffs.b0;
-            const auto a2 = coeffs.a2 / coeffs.b0;
-            const auto b1 = coeffs.b1 / coeffs.b0;
-            const auto b2 = coeffs.b2 / coeffs.b0;
-
-            const auto a0Batch = xsimd::broadcast(a0);
-            const auto a1Batch = xsimd::broadcast(a1);
-            const auto a2Batch = xsimd::broadcast(a2);
-            const auto b1Batch = xsimd::broadcast(b1);
-            const auto b2Batch = xsimd::broadcast(b2);
-            for (size_t i = 0; i < m_vecSize; i += m_simdSize) {
-                a0Batch.store_aligned(&m_a0[i]);
-                a1Batch.store_aligned(&m_a1[i]);
-                a2Batch.store_aligned(&m_a2[i]);
-                b1Batch.store_aligned(&m_b1[i]);
-                b2Batch.store_aligned(&m_b2[i]);
-            }
-            for (size_t i = m_vecSize; i < N; ++i) {
-                m_a0[i] = a0;
-                m_a1[i] = a1;
-                m_a2[i] = a2;
-                m_b1[i] = b1;
-                m_b2[i] = b2;
+            for (size_t i = 0; i < N; ++i) {
+                storeCoeffs(i, coeffs);
             }
         }
 
@@ -79,12 +132,7 @@ namespace marvin::dsp::filters {
          */
         auto setCoeffs(size_t index, BiquadCoefficients<SampleType> coeffs) noexcept -> void {
             m_equalCoeffs = false;
-            const auto [a0, a1, a2, b0, b1, b2] = coeffs;
-            m_a0[index] = a0 / b0;
-            m_a1[index] = a1 / b0;
-            m_a2[index] = a2 / b0;
-            m_b1[index] = b1 / b0;
-            m_b2[index] = b2 / b0;
+            storeCoeffs(index, coeffs);
         }
 
         /**
@@ -92,69 +140,55 @@ namespace marvin::dsp::filters {
          * @param x An array-like containing N samples to be filtered.
          */
         auto operator()(std::span<SampleType, N> x) noexcept -> void {
-            constexpr static auto sizeBytes = sizeof(SampleType) * N;
-            std::memcpy(m_working.data(), x.data(), sizeBytes);
-            for (size_t i = 0; i < m_vecSize; i += m_simdSize) {
-                const auto& a0 = xsimd::load_aligned(&m_a0[i]);
-                const auto& x0 = xsimd::load_aligned(&m_working[i]);
-                const auto a0x0 = a0 * x0;
-                const auto& a1 = xsimd::load_aligned(&m_a1[i]);
-                const auto& x1 = xsimd::load_aligned(&m_x1[i]);
-                const auto a1x1 = a1 * x1;
-                const auto& a2 = xsimd::load_aligned(&m_a2[i]);
-                const auto& x2 = xsimd::load_aligned(&m_x2[i]);
-                const auto a2x2 = a2 * x2;
-                const auto& b1 = xsimd::load_aligned(&m_b1[i]);
-                const auto& y1 = xsimd::load_aligned(&m_y1[i]);
-                const auto b1y1 = b1 * y1;
-                const auto& b2 = xsimd::load_aligned(&m_b2[i]);
-                const auto& y2 = xsimd::load_aligned(&m_y2[i]);
-                const auto b2y2 = b2 * y2;
-                const auto res = a0x0 + a1x1 + a2x2 - b1y1 - b2y2;
-                x1.store_aligned(&m_x2[i]);
-                x0.store_aligned(&m_x1[i]);
-                y1.store_aligned(&m_y2[i]);
-                res.store_aligned(&m_y1[i]);
-            }
+            detail::processSIMDBiquads(getView(), x.data(), N);
+        }
 
-            for (size_t i = m_vecSize; i < N; ++i) {
-                const auto res = (m_a0[i] * m_working[i]) + (m_a1[i] * m_x1[i]) + (m_a2[i] * m_x2[i]) - (m_b1[i] * m_y1[i]) - (m_b2[i] * m_y2[i]);
-                m_x2[i] = m_x1[i];
-                m_x1[i] = m_working[i];
-                m_y2[i] = m_y1[i];
-                m_y1[i] = res;
-            }
-            std::memcpy(x.data(), m_y1.data(), sizeBytes);
+        /**
+         * Processes a block of samples through all N biquads, and overwrites the values in `buffer` - channel i runs through biquad i.
+         * Equivalent to calling the single sample overload for each sample in turn, but keeps the coefficients and state in registers across the block.
+         * @param buffer The block to filter. <b>Must</b> have exactly N channels.
+         */
+        auto operator()(containers::BufferView<SampleType> buffer) noexcept -> void {
+            assert(buffer.getNumChannels() == N);
+            detail::processSIMDBiquadsBlock(getView(), buffer.getArrayOfWritePointers(), N, buffer.getNumSamples());
         }
 
         /**
          * Zeroes all internal state (except coefficients).
          */
         auto reset() noexcept -> void {
-            auto batch = xsimd::broadcast(0.0);
-            for (size_t i = 0; i < m_vecSize; i += m_simdSize) {
-                batch.store_aligned(&m_working[i]);
-                batch.store_aligned(&m_x1[i]);
-                batch.store_aligned(&m_x2[i]);
-                batch.store_aligned(&m_y1[i]);
-                batch.store_aligned(&m_y2[i]);
-            }
-            for (size_t i = m_vecSize; i < N; ++i) {
-                m_working[i] = 0.0;
-                m_x1[i] = 0.0;
-                m_x2[i] = 0.0;
-                m_y1[i] = 0.0;
-                m_y2[i] = 0.0;
+            // The state is the last four fields of each block, so is one contiguous run per block.
+            for (size_t block = 0; block < s_numBlocks; ++block) {
+                auto* state = getField(View::X1, block * s_blockWidth);
+                std::fill(state, state + (View::NumFields - View::X1) * s_blockWidth, static_cast<SampleType>(0.0));
             }
         }
 
     private:
-        constexpr static auto m_simdSize = xsimd::simd_type<SampleType>::size;
-        constexpr static auto m_vecSize = N - N % m_simdSize;
+        using View = detail::SIMDBiquadView<SampleType>;
+        constexpr static auto s_blockWidth{ detail::getSIMDBiquadLanes<SampleType>(N) };
+        constexpr static auto s_numBlocks{ (N + s_blockWidth - 1) / s_blockWidth };
+
+        [[nodiscard]] auto getView() noexcept -> View {
+            return View{ .lanes = s_blockWidth, .data = m_storage.data() };
+        }
+
+        [[nodiscard]] auto getField(typename View::Field field, size_t filter) noexcept -> SampleType* {
+            return m_storage.data() + (filter / s_blockWidth * View::NumFields + field) * s_blockWidth + filter % s_blockWidth;
+        }
+
+        auto storeCoeffs(size_t index, BiquadCoefficients<SampleType> coeffs) noexcept -> void {
+            const auto [a0, a1, a2, b0, b1, b2] = coeffs;
+            *getField(View::A0, index) = a0 / b0;
+            *getField(View::A1, index) = a1 / b0;
+            *getField(View::A2, index) = a2 / b0;
+            *getField(View::B1, index) = b1 / b0;
+            *getField(View::B2, index) = b2 / b0;
+        }
+
         bool m_equalCoeffs{ false };
-        std::vector<SampleType, xsimd::aligned_allocator<SampleType>> m_working;
-        std::vector<SampleType, xsimd::aligned_allocator<SampleType>> m_a0, m_a1, m_a2, m_b1, m_b2;
-        std::vector<SampleType, xsimd::aligned_allocator<SampleType>> m_x1, m_x2, m_y1, m_y2;
+        // Padded out to a whole number of blocks - the padding filters' coefficients stay zeroed, and are never processed.
+        alignas(s_blockWidth * sizeof(SampleType)) std::array<SampleType, s_numBlocks * View::NumFields * s_blockWidth> m_storage{};
     };
 
 
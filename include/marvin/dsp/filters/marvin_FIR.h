@@ -0,0 +1,125 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_FIR_H
+#define MARVIN_FIR_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/containers/marvin_BufferView.h"
+#include <span>
+#include <vector>
+namespace marvin::dsp::filters {
+    /**
+        \brief A direct form FIR filter, for short impulse responses (up to a few hundred taps) - EQ matching, half-band filters, crossovers and so on.
+
+        The input history is kept in a linear buffer, so the most recent `numTaps` samples are always contiguous - each output is a single (SIMD) dot product with the
+        reversed coefficients, with no wrap-around handling, and `process` computes several outputs per pass over the coefficients. For longer impulse responses,
+        `dsp::spectral::Convolver` will be cheaper.
+    */
+    template <FloatType SampleType>
+    class FIR final {
+    public:
+        /**
+            Sets the filter's coefficients (its impulse response). If the number of taps changes, this allocates and resets the filter - otherwise, the history is kept,
+            so the coefficients can be swapped on the audio thread.
+            \param coefficients The coefficients to use, with `coefficients[0]` applied to the current input. <b>Must not</b> be empty.
+        */
+        void setCoefficients(std::span<const SampleType> coefficients);
+
+        /**
+            Zeroes the input history.
+        */
+        void reset() noexcept;
+
+        /**
+            Filters a single sample.
+            \param x The sample to filter.
+            \return The filtered sample.
+        */
+        [[nodiscard]] SampleType operator()(SampleType x) noexcept;
+
+        /**
+            Filters a block of samples.
+            \param source The samples to filter.
+            \param dest The array-like to write the results to. <b>Must</b> be the same size as `source`, and can be the same array as `source` for in-place processing.
+        */
+        void process(std::span<const SampleType> source, std::span<SampleType> dest) noexcept;
+
+        /**
+            Retrieves the number of coefficients passed to `setCoefficients`.
+            \return The number of taps.
+        */
+        [[nodiscard]] size_t getNumTaps() const noexcept;
+
+    private:
+        void shiftHistory() noexcept;
+
+        std::vector<SampleType> m_reversedCoefficients;
+        std::vector<SampleType> m_history;
+        size_t m_position{ 0 };
+    };
+
+    /**
+        \brief A direct form FIR filter which runs the same coefficients over several channels at once.
+
+        The history is stored interleaved (and doubled, back to back), and the filter is vectorised across channels rather than taps, so it's most efficient
+        with a channel count that's a multiple of the SIMD width of the instruction set it's dispatched to - for floats, 4 with SSE / NEON, 8 with AVX2, and 16 with
+        AVX-512 (half that for doubles). Any channels left over are processed one at a time.
+    */
+    template <FloatType SampleType>
+    class MultichannelFIR final {
+    public:
+        /**
+            Prepares the filter for the given number of channels, and sets its coefficients. Allocates, and resets the filter.
+            \param numChannels The number of channels to process.
+            \param coefficients The coefficients to use, with `coefficients[0]` applied to the current input. <b>Must not</b> be empty.
+        */
+        void initialise(size_t numChannels, std::span<const SampleType> coefficients);
+
+        /**
+            Zeroes the input history of every channel.
+        */
+        void reset() noexcept;
+
+        /**
+            Filters a single sample from each channel, in place.
+            \param frame An array-like containing one sample per channel. <b>Must</b> be `numChannels` long.
+        */
+        void operator()(std::span<SampleType> frame) noexcept;
+
+        /**
+            Filters a block of samples from each channel.
+            \param source The channels to filter. <b>Must</b> have `numChannels` channels.
+            \param dest The channels to write the results to, with the same number of channels and samples as `source`. Can be the same buffer as `source` for in-place processing.
+        */
+        void process(containers::BufferView<SampleType> source, containers::BufferView<SampleType> dest) noexcept;
+
+        /**
+            Retrieves the number of channels passed to `initialise`.
+            \return The number of channels.
+        */
+        [[nodiscard]] size_t getNumChannels() const noexcept;
+
+        /**
+            Retrieves the number of coefficients passed to `initialise`.
+            \return The number of taps.
+        */
+        [[nodiscard]] size_t getNumTaps() const noexcept;
+
+    private:
+        void pushFrame() noexcept;
+
+        size_t m_numChannels{ 0 };
+        size_t m_position{ 0 };
+        std::vector<SampleType> m_reversedCoefficients;
+        std::vector<SampleType> m_history;
+        std::vector<SampleType> m_frame;
+    };
+} // namespace marvin::dsp::filters
+#endif
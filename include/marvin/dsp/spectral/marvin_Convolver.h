@@ -0,0 +1,145 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_CONVOLVER_H
+#define MARVIN_CONVOLVER_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/containers/marvin_BufferView.h"
+#include "marvin/dsp/spectral/marvin_FFT.h"
+#include <complex>
+#include <memory>
+#include <span>
+#include <vector>
+namespace marvin::dsp::spectral {
+    /**
+        \brief Zero latency, uniformly partitioned FFT convolution, for long impulse responses.
+
+        The impulse response is split into partitions of `blockSize` samples, each transformed once up front. Incoming audio is transformed a block at a time (overlap-save, with
+        `2 * blockSize` point transforms), and its spectrum is kept in a frequency domain delay line, so each output block is a single multiply-accumulate per partition and one inverse transform.
+        The contributions of every partition except the first only depend on past blocks, so they're accumulated once per block - calls shorter than a block just redo the first partition.
+
+        Single channel - for multichannel audio, use one instance per channel (instances of the same block size share their FFT setup).
+    */
+    template <FloatType SampleType>
+    class Convolver final {
+    public:
+        /**
+            Prepares the convolver to process with the given impulse response. Allocates, so call this before processing (or from a background thread, and swap the instances).
+            \param blockSize The partition size. The cost per sample is lowest when `process` is called with exactly this many samples, and it should be a size the FFT handles well (ideally a power of two).
+            \param impulseResponse The impulse response to convolve with. Copied, so doesn't need to outlive the call.
+        */
+        void initialise(size_t blockSize, std::span<const SampleType> impulseResponse);
+
+        /**
+            Clears the input history, and anything left ringing out from the previous input. Doesn't allocate.
+        */
+        void reset() noexcept;
+
+        /**
+            Convolves `data` with the impulse response in place, with no added latency. Doesn't allocate, and can be called with any number of samples.
+            \param data The samples to process.
+        */
+        void process(std::span<SampleType> data) noexcept;
+
+        /**
+            Retrieves the partition size passed to `initialise`.
+            \return The block size.
+        */
+        [[nodiscard]] size_t getBlockSize() const noexcept;
+
+        /**
+            Retrieves the number of partitions the impulse response was split into.
+            \return The number of partitions.
+        */
+        [[nodiscard]] size_t getNumPartitions() const noexcept;
+
+    private:
+        void processBlockSegment(std::span<SampleType> data) noexcept;
+        void accumulatePastPartitions() noexcept;
+
+        std::unique_ptr<FFT<SampleType>> m_fft{ nullptr };
+        size_t m_blockSize{ 0 };
+        size_t m_numBins{ 0 };
+        size_t m_numPartitions{ 0 };
+        size_t m_inputPosition{ 0 };
+        size_t m_currentPartition{ 0 };
+        std::vector<std::complex<SampleType>> m_irSpectra;
+        std::vector<std::complex<SampleType>> m_inputSpectra;
+        std::vector<std::complex<SampleType>> m_accumulator;
+        std::vector<std::complex<SampleType>> m_outputSpectrum;
+        std::vector<SampleType> m_inputBuffer;
+        std::vector<SampleType> m_outputBuffer;
+    };
+
+    /**
+        \brief Zero latency, uniformly partitioned FFT convolution of `numInputs` channels with a `numInputs` x `numOutputs` matrix of impulse responses - for true stereo and ambisonic reverbs.
+
+        Works like `Convolver`, but shares everything it can between the paths through the matrix: each input channel is transformed once per block (rather than once per output),
+        and goes into a single frequency domain delay line, which every output accumulates from. Each output then needs one inverse transform, however many inputs feed it.
+        So a true stereo (2x2) matrix costs two forward and two inverse transforms per block, rather than the four of each that four `Convolver`s would take.
+    */
+    template <FloatType SampleType>
+    class MatrixConvolver final {
+    public:
+        /**
+            Prepares the convolver to process with the given impulse response matrix. Allocates, so call this before processing.
+            \param blockSize The partition size. The same rules as `Convolver::initialise` apply.
+            \param numInputs The number of input channels.
+            \param numOutputs The number of output channels.
+            \param impulseResponses `numInputs * numOutputs` impulse responses, in output-major order - the response from input `i` to output `o` is at index `o * numInputs + i`.
+            They don't need to be the same length (the longest sets the number of partitions), and an empty span disconnects that input from that output. Copied, so don't need to outlive the call.
+        */
+        void initialise(size_t blockSize, size_t numInputs, size_t numOutputs, std::span<const std::span<const SampleType>> impulseResponses);
+
+        /**
+            Clears the input history, and anything left ringing out from the previous input. Doesn't allocate.
+        */
+        void reset() noexcept;
+
+        /**
+            Convolves `source` with the impulse response matrix, and writes the results to `dest`, with no added latency. Doesn't allocate, and can be called with any number of samples.
+            \param source The input channels. <b>Must</b> have `numInputs` channels.
+            \param dest The output channels. <b>Must</b> have `numOutputs` channels, and the same number of samples as `source`. Can't alias `source`.
+        */
+        void process(containers::BufferView<SampleType> source, containers::BufferView<SampleType> dest) noexcept;
+
+        /**
+            Retrieves the number of partitions the longest impulse response was split into.
+            \return The number of partitions.
+        */
+        [[nodiscard]] size_t getNumPartitions() const noexcept;
+
+    private:
+        void processBlockSegment(containers::BufferView<SampleType> source, containers::BufferView<SampleType> dest, size_t offset, size_t size) noexcept;
+        void accumulatePastPartitions() noexcept;
+        [[nodiscard]] std::complex<SampleType>* getIRSpectrum(size_t output, size_t input, size_t partition) noexcept;
+        [[nodiscard]] std::complex<SampleType>* getInputSpectrum(size_t input, size_t slot) noexcept;
+
+        std::unique_ptr<FFT<SampleType>> m_fft{ nullptr };
+        size_t m_blockSize{ 0 };
+        size_t m_numBins{ 0 };
+        size_t m_numInputs{ 0 };
+        size_t m_numOutputs{ 0 };
+        size_t m_numPartitions{ 0 };
+        size_t m_inputPosition{ 0 };
+        size_t m_currentPartition{ 0 };
+        std::vector<std::complex<SampleType>> m_irSpectra;
+        std::vector<std::complex<SampleType>> m_inputSpectra;
+        std::vector<std::complex<SampleType>> m_accumulators;
+        std::vector<std::complex<SampleType>> m_outputSpectra;
+        std::vector<SampleType> m_inputBuffers;
+        std::vector<SampleType> m_outputBuffers;
+        std::vector<SampleType*> m_inputBufferPointers;
+        std::vector<std::complex<SampleType>*> m_inputSpectrumPointers;
+        std::vector<std::complex<SampleType>*> m_outputSpectrumPointers;
+        std::vector<SampleType*> m_outputBufferPointers;
+    };
+} // namespace marvin::dsp::spectral
+#endif
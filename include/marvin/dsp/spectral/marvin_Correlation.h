@@ -0,0 +1,123 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_CORRELATION_H
+#define MARVIN_CORRELATION_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/dsp/spectral/marvin_FFT.h"
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+namespace marvin::dsp::spectral {
+    /**
+        \brief FFT based cross-correlation and autocorrelation, in O(N log N) rather than O(N^2).
+
+        The inputs are zero-padded internally to the smallest size of the form `f * 2^n` (for `f` in `{1, 3, 5, 15}`, which every FFT engine handles efficiently) that's big enough to avoid any circular wrap-around,
+        so the results are identical to the direct (linear) correlation. All buffers are allocated up front, so an instance can be reused (on the audio thread, if need be)
+        for any inputs up to the sizes it was initialised with. Instances with the same transform size share their FFT setup.
+    */
+    template <FloatType SampleType>
+    class Correlator final {
+    public:
+        /**
+            Prepares the correlator for inputs up to the given sizes. Allocates.
+            \param maxLhsSize The largest `lhs` (or autocorrelation `source`) that will be passed in.
+            \param maxRhsSize The largest `rhs` that will be passed in. For autocorrelation only, pass the same as `maxLhsSize`.
+        */
+        void initialise(size_t maxLhsSize, size_t maxRhsSize);
+
+        /**
+            Computes the cross-correlation of `lhs` and `rhs` - `dest[i] = sum(lhs[n + lag] * rhs[n])`, where `lag = i - (rhs.size() - 1)`. So a positive lag means `lhs` is behind (later than) `rhs`.
+            Doesn't allocate.
+            \param lhs The first signal. <b>Must</b> be no longer than `maxLhsSize`.
+            \param rhs The second signal. <b>Must</b> be no longer than `maxRhsSize`.
+            \param dest The array-like to write the correlation to. <b>Must</b> be `lhs.size() + rhs.size() - 1` points long, covering lags `-(rhs.size() - 1)` to `lhs.size() - 1`.
+        */
+        void correlate(std::span<const SampleType> lhs, std::span<const SampleType> rhs, std::span<SampleType> dest) noexcept;
+
+        /**
+            Computes the (non-negative lags of the) autocorrelation of `source` - `dest[lag] = sum(source[n] * source[n + lag])`. Doesn't allocate.
+            \param source The signal to autocorrelate. <b>Must</b> be no longer than `maxLhsSize`, and no longer than `maxRhsSize`.
+            \param dest The array-like to write the autocorrelation to. Can be any length up to `source.size()` - only the lags that fit are written.
+        */
+        void autocorrelate(std::span<const SampleType> source, std::span<SampleType> dest) noexcept;
+
+        /**
+            Retrieves the transform size the correlator chose.
+            \return The FFT size.
+        */
+        [[nodiscard]] size_t getFFTSize() const noexcept;
+
+    private:
+        std::unique_ptr<FFT<SampleType>> m_fft{ nullptr };
+        size_t m_maxLhsSize{ 0 };
+        size_t m_maxRhsSize{ 0 };
+        std::vector<SampleType> m_lhsBuffer;
+        std::vector<SampleType> m_rhsBuffer;
+        std::vector<std::complex<SampleType>> m_lhsSpectrum;
+        std::vector<std::complex<SampleType>> m_rhsSpectrum;
+        std::vector<std::complex<SampleType>> m_crossSpectrum;
+    };
+
+    /**
+        \brief The location and height of a peak in a correlation.
+    */
+    template <FloatType SampleType>
+    struct CorrelationPeak final {
+        /**
+            The (fractional) lag of the peak.
+        */
+        SampleType lag;
+        /**
+            The (interpolated) value of the correlation at the peak.
+        */
+        SampleType value;
+    };
+
+    /**
+        Computes the cross-correlation of `lhs` and `rhs` - see `Correlator::correlate`. Allocates - use a `Correlator` to reuse the buffers between calls.
+        \param lhs The first signal.
+        \param rhs The second signal.
+        \return The correlation, `lhs.size() + rhs.size() - 1` points long, starting at a lag of `-(rhs.size() - 1)`.
+    */
+    template <FloatType SampleType>
+    [[nodiscard]] std::vector<SampleType> correlate(std::span<const SampleType> lhs, std::span<const SampleType> rhs);
+
+    /**
+        Computes the non-negative lags of the autocorrelation of `source` - see `Correlator::autocorrelate`. Allocates - use a `Correlator` to reuse the buffers between calls.
+        \param source The signal to autocorrelate.
+        \return The autocorrelation, `source.size()` points long, starting at a lag of 0.
+    */
+    template <FloatType SampleType>
+    [[nodiscard]] std::vector<SampleType> autocorrelate(std::span<const SampleType> source);
+
+    /**
+        Finds the highest point in a correlation, refined to a fractional lag by fitting a parabola through it and its neighbours.
+        \param correlation The correlation to search.
+        \param firstLag The lag `correlation[0]` corresponds to - `-(rhs.size() - 1)` for the output of `correlate`, 0 for `autocorrelate`.
+        \param minLag The lowest lag to consider - useful for skipping the zero lag peak of an autocorrelation.
+        \param maxLag The highest lag to consider.
+        \return The peak's fractional lag, and the value of the parabola there. If the range is empty, a lag of `firstLag` and a value of 0.
+    */
+    template <FloatType SampleType>
+    [[nodiscard]] CorrelationPeak<SampleType> findPeak(std::span<const SampleType> correlation, std::ptrdiff_t firstLag, std::ptrdiff_t minLag, std::ptrdiff_t maxLag) noexcept;
+
+    /**
+        Finds the highest point in the whole of a correlation - see the other overload of `findPeak`.
+        \param correlation The correlation to search.
+        \param firstLag The lag `correlation[0]` corresponds to.
+        \return The peak's fractional lag, and the value of the parabola there.
+    */
+    template <FloatType SampleType>
+    [[nodiscard]] CorrelationPeak<SampleType> findPeak(std::span<const SampleType> correlation, std::ptrdiff_t firstLag = 0) noexcept;
+} // namespace marvin::dsp::spectral
+#endif
@@ -0,0 +1,143 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_DCT_H
+#define MARVIN_DCT_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/dsp/spectral/marvin_FFT.h"
+#include <memory>
+#include <span>
+#include <vector>
+namespace marvin::dsp::spectral {
+    /**
+        \brief Enum for the available discrete cosine transform types.
+    */
+    enum class DCTType {
+        /**
+            `X[k] = sum(x[n] * cos(pi / N * (n + 0.5) * k))` - the "standard" DCT, as used for MFCCs.
+        */
+        II,
+        /**
+            `X[k] = x[0] / 2 + sum(x[n] * cos(pi / N * n * (k + 0.5)))` for `n >= 1` - the inverse of `II`, scaled by `N / 2`.
+        */
+        III,
+        /**
+            `X[k] = sum(x[n] * cos(pi / N * (n + 0.5) * (k + 0.5)))` - its own inverse, scaled by `N / 2`. The core of the MDCT.
+        */
+        IV
+    };
+
+    /**
+        \brief Class for performing 1D discrete cosine transforms, in `O(N log N)`.
+
+        The transforms are unnormalised (see `DCTType` for the exact definitions), and match vDSP's - so an orthonormal DCT-II is `X[0] * sqrt(1 / N)`, `X[k] * sqrt(2 / N)`.
+
+        The implementation is chosen the same way as `FFT`'s:
+        - On macOS, will use vDSP's DCT for single precision, where it supports the size (`f * 2^n` for `f` in `{1, 3, 5, 15}`, `n >= 4`).
+        - On Windows, if Intel's IPP was found, will use IPP's DCT for types `II` and `III`.
+        - Anywhere else (or for anything the above don't cover), will use the fallback, which runs types `II` and `III` through an `N` point real FFT (Makhoul's reordering),
+          and type `IV` through an `N / 2` point complex FFT.
+    */
+    template <FloatType SampleType>
+    class DCT final {
+    public:
+        /**
+            Constructs a DCT of the given type and size. Allocates.
+            \param type The type of transform to perform.
+            \param size The size of the transform. <b>Must</b> be even, and at least 4.
+        */
+        DCT(DCTType type, size_t size);
+
+        /**
+            Because the PImpl is wrapped in a unique_ptr, we need a non-default destructor.
+        */
+        ~DCT() noexcept;
+
+        /**
+            Checks the DCT implementation being used.
+            \return The engine type currently being used.
+        */
+        [[nodiscard]] EngineType getEngineType() const noexcept;
+
+        /**
+            Retrieves the type of transform passed into the constructor.
+            \return The transform type.
+        */
+        [[nodiscard]] DCTType getType() const noexcept;
+
+        /**
+            Retrieves the size passed into the constructor.
+            \return The transform size.
+        */
+        [[nodiscard]] size_t getSize() const noexcept;
+
+        /**
+            Performs the transform on `source`, and writes the results to `dest`. Doesn't allocate.
+            \param source The input array-like. <b>Must</b> be `N` points long.
+            \param dest The output array-like. <b>Must</b> be `N` points long. Can be the same array as `source`.
+        */
+        void transform(std::span<const SampleType> source, std::span<SampleType> dest) noexcept;
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> m_impl;
+    };
+
+    /**
+        \brief Class for performing the modified discrete cosine transform, and its inverse, with time domain aliasing cancellation.
+
+        Each forward transform takes `2N` windowed samples to `N` coefficients - `X[k] = sum(w[n] * x[n] * cos(pi / N * (n + 0.5 + N / 2) * (k + 0.5)))`. Each inverse transform
+        takes `N` coefficients back to `2N` windowed, aliased samples, scaled by `2 / N`, such that overlap-adding consecutive frames (hopped by `N`) reconstructs the input
+        exactly, as long as the window satisfies the Princen-Bradley condition (`w[n]^2 + w[n + N]^2 == 1`). Runs through a size `N` `DCT` of type `IV`.
+    */
+    template <FloatType SampleType>
+    class MDCT final {
+    public:
+        /**
+            Constructs an MDCT with a sine window (`w[n] = sin(pi * (n + 0.5) / 2N)`). Allocates.
+            \param size The number of coefficients, `N`. <b>Must</b> be even, and at least 4.
+        */
+        explicit MDCT(size_t size);
+
+        /**
+            Constructs an MDCT with a custom window. Allocates.
+            \param size The number of coefficients, `N`. <b>Must</b> be even, and at least 4.
+            \param window The window to use for both analysis and synthesis. <b>Must</b> be `2N` points long, and should satisfy the Princen-Bradley condition.
+        */
+        MDCT(size_t size, std::span<const SampleType> window);
+
+        /**
+            Retrieves the number of coefficients each frame is transformed to.
+            \return The number of coefficients, `N`.
+        */
+        [[nodiscard]] size_t getSize() const noexcept;
+
+        /**
+            Windows and transforms a frame of samples. Doesn't allocate.
+            \param source The frame to transform. <b>Must</b> be `2N` points long.
+            \param dest The array-like to write the coefficients to. <b>Must</b> be `N` points long.
+        */
+        void forward(std::span<const SampleType> source, std::span<SampleType> dest) noexcept;
+
+        /**
+            Transforms a frame of coefficients back to (windowed) samples, ready to be overlap-added with the previous frame's. Doesn't allocate.
+            \param source The coefficients to transform. <b>Must</b> be `N` points long.
+            \param dest The array-like to write the samples to. <b>Must</b> be `2N` points long.
+        */
+        void inverse(std::span<const SampleType> source, std::span<SampleType> dest) noexcept;
+
+    private:
+        size_t m_size;
+        DCT<SampleType> m_dct;
+        std::vector<SampleType> m_window;
+        std::vector<SampleType> m_folded;
+    };
+} // namespace marvin::dsp::spectral
+#endif
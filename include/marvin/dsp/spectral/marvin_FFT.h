@@ -12,6 +12,8 @@
 #define MARVIN_FFT_H
 #include "marvin/library/marvin_Concepts.h"
 #include "marvin/containers/marvin_StrideView.h"
+#include "marvin/containers/marvin_BufferView.h"
+#include "marvin/math/marvin_VecOps.h"
 #include <memory>
 #include <span>
 #include <complex>
@@ -46,18 +48,32 @@ namespace marvin::dsp::spectral {
         using ValueType = typename T::value_type;
     };
 
+    /**
+        Strong type for the size-based constructor of `FFT`, to keep it distinct from the order-based one.
+    */
+    struct FFTSize {
+        size_t size;
+    };
+
     /**
         \brief Class for performing real or complex 1D FFTs.
 
         The template type `SampleType` dictates whether the transform is real-only, or complex. Accepted types are `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
-        Performs no scaling on the forward data, and scales the inverse data by `1 / N`.
+        Performs no scaling on the forward data, and scales the inverse data by `1 / N` - see `setScalingEnabled` to skip this.
 
         The implementation is chosen at compile-time based on a few factors:
         - On macOS, will use the vDSP implementation from Accelerate.
         - On Windows, if Intel's IPP was found, will use the IPP implementation.
-        - Also on Windows, if Intel's IPP was *not* found, will use the (slow and rough and ready) fallback.
+        - Anywhere else (or if `MARVIN_FORCE_FALLBACK_FFT` is defined), will use the fallback.
+
+        The fallback is an iterative mixed radix (2, 3, 4, 5 and 7) Stockham transform, with precomputed per-pass twiddles and xsimd butterflies,
+        dispatched at runtime to the widest instruction set available. Sizes with larger prime factors go through Bluestein's algorithm.
 
-        The fallback implementation is still a WIP, and is actively being updated. Particularly, at the time of writing it only performs radix 2 transforms.
+        Sizes that aren't powers of two are supported via the `FFTSize` constructor. IPP handles these with its DFT, Accelerate with vDSP's DFT where it
+        supports the size (`f * 2^n` for `f` in `{1, 3, 5, 15}`), and the fallback engine otherwise.
+
+        Read-only setup data (twiddles, plans, and the IPP / vDSP setups) is shared between instances of the same size and type, so constructing many
+        engines of the same size is cheap. Each instance still owns its own scratch buffers, so separate instances can be used from separate threads.
     */
     template <RealOrComplexFloatType SampleType>
     class FFT final {
@@ -70,6 +86,13 @@ namespace marvin::dsp::spectral {
         */
         explicit FFT(size_t order);
 
+        /**
+            Constructs an instance of `FFT` with an arbitrary size, for block sizes like 480 or 1470 that would otherwise need zero padding to a power of two.
+            Sizes that factor into 2, 3, 5 and 7 are the cheapest, anything else is still `O(N log N)` but noticeably slower.
+            \param size The size of the FFT. For real transforms, this <b>must</b> be even - the `N / 2 + 1` bin layout is the same as the order-based constructor's.
+        */
+        explicit FFT(FFTSize size);
+
         /**
             Because the PImpl is wrapped in a unique_ptr, we need a non-default destructor.
         */
@@ -82,7 +105,7 @@ namespace marvin::dsp::spectral {
         [[nodiscard]] EngineType getEngineType() const noexcept;
 
         /**
-            Retrieves the FFT Size (`2^order` passed into the constructor).
+            Retrieves the FFT Size (`2^order` passed into the constructor, or the size passed to the `FFTSize` constructor).
             \return The fft size.
         */
         [[nodiscard]] size_t getFFTSize() const noexcept;
@@ -113,6 +136,71 @@ namespace marvin::dsp::spectral {
          */
         std::span<SampleType> inverse(std::span<std::complex<ValueType>> source);
 
+        /**
+            Performs a forward transform on every channel of `source`, and writes the results to the corresponding channels of `dest`. Equivalent to calling `forward` on each channel,
+            but transforms the channels together where the engine supports it - the fallback vectorises across channels, and vDSP uses its multiple-signal FFT for power-of-two sizes.\n
+            The first call with more channels than any call before it allocates, so call it once (or with the maximum channel count) before using it on the audio thread.
+            \param source The channels to transform, each <b>must</b> be `N` points long.
+            \param dest The destination channels, <b>must</b> have the same number of channels as `source`. The per-channel sizing rules from `forward` apply.
+        */
+        void forwardBatch(containers::BufferView<SampleType> source, containers::BufferView<std::complex<ValueType>> dest);
+
+        /**
+            Performs an inverse transform on every channel of `source`, and writes the results to the corresponding channels of `dest`. Scales the data by `1 / N`, like `inverse`.
+            The same engine support and allocation rules as `forwardBatch` apply.
+            \param source The channels to transform. The per-channel sizing rules from `inverse` apply.
+            \param dest The destination channels, <b>must</b> have the same number of channels as `source`, each `N` points long.
+        */
+        void inverseBatch(containers::BufferView<std::complex<ValueType>> source, containers::BufferView<SampleType> dest);
+
+        /**
+            Performs a forward transform in place, without needing a separate destination buffer.
+            \param data If `SampleType` is a `std::complex<>`, `N` points long. If `SampleType` is real, `(N / 2) + 1` points long, with the `N` real input samples packed into
+            the start of the buffer (so `reinterpret_cast<ValueType*>(data.data())[i]` is sample `i`). On return, holds the spectrum in the same layout as `forward`.
+        */
+        void forwardInPlace(std::span<std::complex<ValueType>> data);
+
+        /**
+            Performs an inverse transform in place, the reverse of `forwardInPlace`.
+            \param data The spectrum to transform, sized as in `forwardInPlace`. If `SampleType` is real, on return the `N` output samples are packed into the start of the buffer.
+        */
+        void inverseInPlace(std::span<std::complex<ValueType>> data);
+
+        /**
+            Performs a forward transform on the data passed to `source`, and writes the results to separate real and imaginary arrays.
+            Accelerate works on split data natively, so this skips the interleaving step `forward` needs there. The other engines deinterleave their output.
+            \param source The input array-like to perform the transform on. <b>Must be</b> `N` points long.
+            \param dest The split destination. Both arrays <b>must</b> be `(N / 2) + 1` points long if `SampleType` is real (with nyquist in the final real value), or `N` points long if it's a `std::complex<>`.
+        */
+        void forward(std::span<SampleType> source, math::vecops::SplitComplex<ValueType> dest);
+
+        /**
+            Performs an inverse transform on split real and imaginary arrays, and writes the results to `dest`.
+            \param source The split spectrum to transform, sized as in the split overload of `forward`. Left unchanged, but may be used as scratch space during the call.
+            \param dest The destination array-like to write the results to. <b>Must</b> be `N` points long.
+        */
+        void inverse(math::vecops::SplitComplex<ValueType> source, std::span<SampleType> dest);
+
+        /**
+            Enables or disables the built-in scaling. With scaling disabled, the inverse transforms skip their `1 / N` scaling, and the forward transforms skip any engine-specific
+            scaling (vDSP's real transform produces twice the spectrum of the others), so the caller can fold both into a later multiply instead.
+            May allocate (IPP bakes the scaling into its setup), so call this before using the FFT on the audio thread.
+            \param enabled Whether the transforms should scale their results. Defaults to true.
+        */
+        void setScalingEnabled(bool enabled);
+
+        /**
+            Retrieves the factor the forward transforms scale their output by, or need scaling by if scaling has been disabled, to produce the unscaled DFT.
+            \return 0.5 for vDSP's real transform, and 1 otherwise.
+        */
+        [[nodiscard]] ValueType getForwardScaling() const noexcept;
+
+        /**
+            Retrieves the factor the inverse transforms scale their output by, or need scaling by if scaling has been disabled.
+            \return `1 / N`.
+        */
+        [[nodiscard]] ValueType getInverseScaling() const noexcept;
+
     private:
         class Impl;
         std::unique_ptr<Impl> m_impl;
@@ -0,0 +1,112 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_FILTERBANK_H
+#define MARVIN_FILTERBANK_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/containers/marvin_BufferView.h"
+#include <span>
+#include <vector>
+namespace marvin::dsp::spectral {
+    /**
+        \brief A bank of triangular filters, mapping the bins of an FFT magnitude (or power) frame down to a smaller number of bands - mel or constant-Q, or any custom set of band edges.
+
+        Each band only covers a handful of bins, so the weights are stored sparsely - each band's nonzero weights are packed contiguously into one array, with the band's
+        first bin, length and offset into that array alongside. Applying a band is then one (vectorised) dot product over a contiguous run of bins.
+        `processBatch` loops over the bands on the outside, so each band's weights are loaded once and stay in cache for every frame in the batch.
+    */
+    template <FloatType SampleType>
+    class Filterbank final {
+    public:
+        /**
+            Sets up mel spaced bands, with their edges spread evenly on the (HTK) mel scale between `minFrequency` and `maxFrequency`. Allocates.
+            \param sampleRate The sample rate the FFT frames come from.
+            \param fftSize The size of the FFT - the frames will be `fftSize / 2 + 1` bins long.
+            \param numBands The number of bands.
+            \param minFrequency The lower edge of the lowest band, in Hz.
+            \param maxFrequency The upper edge of the highest band, in Hz. <b>Must</b> be no higher than nyquist.
+            \param normalise If true, scales each band by `2 / (upper edge - lower edge)`, so that each band has the same area (Slaney-style), rather than the same peak.
+        */
+        void initialiseMel(double sampleRate, size_t fftSize, size_t numBands, double minFrequency, double maxFrequency, bool normalise = true);
+
+        /**
+            Sets up constant-Q bands, centred on `minFrequency * 2^(k / binsPerOctave)`, with each band's edges at its neighbours' centres. Allocates.
+            At low frequencies the bands get narrower than the FFT's bins - bands that don't contain any bins fall back to the single bin nearest their centre,
+            so use an FFT large enough for the lowest band if the resolution matters there.
+            \param sampleRate The sample rate the FFT frames come from.
+            \param fftSize The size of the FFT - the frames will be `fftSize / 2 + 1` bins long.
+            \param minFrequency The centre of the lowest band, in Hz.
+            \param binsPerOctave The number of bands per octave.
+            \param numBands The number of bands. The highest band's upper edge <b>must</b> be no higher than nyquist.
+        */
+        void initialiseConstantQ(double sampleRate, size_t fftSize, double minFrequency, size_t binsPerOctave, size_t numBands);
+
+        /**
+            Sets up bands from an arbitrary set of edges - band `k` rises from `edges[k]` to a peak of 1 at `edges[k + 1]`, and falls back to 0 at `edges[k + 2]`. Allocates.
+            \param sampleRate The sample rate the FFT frames come from.
+            \param fftSize The size of the FFT - the frames will be `fftSize / 2 + 1` bins long.
+            \param edges The band edges in Hz, in ascending order. Produces `edges.size() - 2` bands, so <b>must</b> have at least 3 points.
+            \param normalise If true, scales each band by `2 / (upper edge - lower edge)`.
+        */
+        void initialise(double sampleRate, size_t fftSize, std::span<const double> edges, bool normalise);
+
+        /**
+            Retrieves the number of bands the filterbank produces.
+            \return The number of bands.
+        */
+        [[nodiscard]] size_t getNumBands() const noexcept;
+
+        /**
+            Retrieves the number of bins each input frame <b>must</b> have.
+            \return `fftSize / 2 + 1`.
+        */
+        [[nodiscard]] size_t getNumBins() const noexcept;
+
+        /**
+            Retrieves the first bin a band covers.
+            \param band The index of the band.
+            \return The index of the band's first bin.
+        */
+        [[nodiscard]] size_t getBandStart(size_t band) const noexcept;
+
+        /**
+            Retrieves a band's (nonzero) weights, starting at `getBandStart(band)`.
+            \param band The index of the band.
+            \return A view into the band's weights.
+        */
+        [[nodiscard]] std::span<const SampleType> getBandWeights(size_t band) const noexcept;
+
+        /**
+            Applies the filterbank to a single frame. Doesn't allocate.
+            \param bins The magnitude (or power) frame. <b>Must</b> be `getNumBins()` points long.
+            \param bands The array-like to write the band energies to. <b>Must</b> be `getNumBands()` points long.
+        */
+        void process(std::span<const SampleType> bins, std::span<SampleType> bands) const noexcept;
+
+        /**
+            Applies the filterbank to a batch of frames, one per channel. Doesn't allocate.
+            \param bins The magnitude (or power) frames. Each channel <b>must</b> be `getNumBins()` points long.
+            \param bands The destination, <b>must</b> have the same number of channels as `bins`, each `getNumBands()` points long.
+        */
+        void processBatch(containers::BufferView<SampleType> bins, containers::BufferView<SampleType> bands) const noexcept;
+
+    private:
+        struct Band final {
+            size_t start;
+            size_t length;
+            size_t offset;
+        };
+
+        size_t m_numBins{ 0 };
+        std::vector<Band> m_bands;
+        std::vector<SampleType> m_weights;
+    };
+} // namespace marvin::dsp::spectral
+#endif
@@ -0,0 +1,98 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_NONUNIFORMCONVOLVER_H
+#define MARVIN_NONUNIFORMCONVOLVER_H
+#include "marvin/library/marvin_Concepts.h"
+#include <memory>
+#include <span>
+#include <vector>
+namespace marvin::dsp::spectral {
+    /**
+        \brief Zero latency, non-uniformly partitioned FFT convolution, for very long impulse responses.
+
+        The impulse response is split into a direct-form head and a series of uniformly partitioned stages, with partition sizes growing by a factor of 8 from stage to stage:
+        - The first `blockSize` taps are convolved directly, sample by sample.
+        - The next stage uses `blockSize` partitions, and runs on the audio thread at the end of every block.
+        - Every later stage uses partitions 8 times the size of the one before, and starts at twice its own partition size into the impulse response. That offset means each block
+          of input only needs to be finished one whole block (of that stage's size) later, so these stages run on background threads, one thread per stage.
+
+        The result is the same as a direct convolution, with no added latency, at a fraction of the cost of uniform partitions of `blockSize` for the whole impulse response.
+        If a background stage misses its deadline (the machine's too loaded to finish it within one of its blocks), the audio thread doesn't drop its output - if the
+        stage's thread hasn't started the job yet, the audio thread takes it over and runs it itself. `getNumMissedDeadlines` counts how often that's happened.
+
+        Single channel - for multichannel audio, use one instance per channel.
+    */
+    template <FloatType SampleType>
+    class NonUniformConvolver final {
+    public:
+        NonUniformConvolver();
+
+        /**
+            Stops the background threads.
+        */
+        ~NonUniformConvolver() noexcept;
+
+        /**
+            Prepares the convolver to process with the given impulse response, and starts any background threads it needs. Allocates, so call this before processing.
+            \param blockSize The head length, and the smallest partition size. Should be a size the FFT handles well (ideally a power of two), and no bigger than the host's block size.
+            \param impulseResponse The impulse response to convolve with. Copied, so doesn't need to outlive the call.
+            \param raiseWorkerPriority Whether the background threads should ask to be scheduled ahead of ordinary threads - the lowest real-time (`SCHED_FIFO`)
+            priority on Linux (which needs `CAP_SYS_NICE` or an `RLIMIT_RTPRIO` allowance, and is otherwise ignored), the user-interactive QoS class on macOS, and
+            `THREAD_PRIORITY_HIGHEST` on Windows. Off by default, so hosts that manage their own thread priorities aren't overridden.
+        */
+        void initialise(size_t blockSize, std::span<const SampleType> impulseResponse, bool raiseWorkerPriority = false);
+
+        /**
+            Clears the input history, and anything left ringing out from the previous input. Waits for any in-flight background work to finish first.
+        */
+        void reset() noexcept;
+
+        /**
+            Convolves `data` with the impulse response in place, with no added latency. Doesn't allocate, and can be called with any number of samples.
+            Whenever `data` completes one of a background stage's blocks, it needs that stage's result for the block before. If the stage's thread hasn't started on
+            it yet, this runs it inline rather than waiting for the thread to be scheduled. It only blocks if the thread's part way through the job, which it can only
+            be if it's been held up for most of one of its blocks mid-job. `getNumMissedDeadlines` reports how often either has happened.
+            \param data The samples to process.
+        */
+        void process(std::span<SampleType> data) noexcept;
+
+        /**
+            Retrieves the number of FFT stages the impulse response was split into, including the first (audio thread) stage.
+            \return The number of FFT stages.
+        */
+        [[nodiscard]] size_t getNumStages() const noexcept;
+
+        /**
+            Retrieves how many times `process` has had to take over or wait for a background stage since the last `initialise` or `reset`. Safe to call from another thread while
+            processing, but not during `initialise`.
+            \return The number of missed deadlines, across all the background stages.
+        */
+        [[nodiscard]] size_t getNumMissedDeadlines() const noexcept;
+
+    private:
+        class UniformStage;
+        class BackgroundStage;
+
+        void processSegment(std::span<SampleType> data) noexcept;
+        void onBlockComplete() noexcept;
+
+        size_t m_blockSize{ 0 };
+        size_t m_position{ 0 };
+        size_t m_headPosition{ 0 };
+        std::vector<SampleType> m_headTaps;
+        std::vector<SampleType> m_headHistory;
+        std::vector<SampleType> m_inputBlock;
+        std::vector<SampleType> m_firstStageOutput;
+        std::unique_ptr<UniformStage> m_firstStage;
+        std::vector<std::unique_ptr<BackgroundStage>> m_backgroundStages;
+    };
+} // namespace marvin::dsp::spectral
+#endif
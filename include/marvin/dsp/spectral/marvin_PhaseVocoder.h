@@ -0,0 +1,177 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_PHASEVOCODER_H
+#define MARVIN_PHASEVOCODER_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/math/marvin_Windows.h"
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <vector>
+namespace marvin::dsp::spectral {
+    /**
+        \brief A phase vocoder, for time stretching and pitch shifting.
+
+        Frames of input are taken every analysis hop, and resynthesised every (fixed) synthesis hop, with each bin's phase advanced by its measured instantaneous frequency
+        times the synthesis hop. Pitch shifting stretches by the pitch ratio as well, then resamples (linearly) back to the requested length.<br>
+        Phase locking keeps the bins around each spectral peak coherent with the peak, which cuts down on the "phasiness" of the plain algorithm:
+        - `Identity` locks each bin's phase to its nearest peak's, offset by their difference in the analysis frame (Laroche & Dolson).
+        - `Scaled` scales that difference with the stretch factor, which suits larger stretches.
+
+        Transients are detected with spectral flux - when a frame's rise in magnitude (as a proportion of its total magnitude) goes over the transient threshold,
+        the synthesis phases are reset to the analysis phases, which keeps attacks sharp rather than smearing them.
+
+        There are two modes:
+        - Streaming, through `push` and `pull`, for live use. Nothing allocates after `initialise`.
+        - Offline, through `processOffline`, for whole files. The FFTs are spread across threads, but the phases are still propagated through every frame in order,
+          so the output doesn't depend on the number of threads.
+    */
+    template <FloatType SampleType>
+    class PhaseVocoder final {
+    public:
+        /**
+            The phase locking strategies available - see the class description.
+        */
+        enum class PhaseLocking {
+            None,
+            Identity,
+            Scaled
+        };
+
+        /**
+            \brief The parameters shared by both modes.
+        */
+        struct Settings final {
+            /**
+                The frame size. Should be a size the FFT handles well (ideally a power of two).
+            */
+            size_t fftSize{ 2048 };
+            /**
+                The synthesis hop - <b>must</b> be no bigger than `fftSize / 2`. The analysis hop is this divided by the stretch.
+            */
+            size_t hopSize{ 512 };
+            /**
+                The window used for both analysis and synthesis.
+            */
+            math::windows::WindowType windowType{ math::windows::WindowType::Hann };
+            /**
+                The ratio of the output's length to the input's.
+            */
+            double timeStretch{ 1.0 };
+            /**
+                The ratio of the output's pitch to the input's.
+            */
+            double pitchShift{ 1.0 };
+            /**
+                The phase locking strategy to use.
+            */
+            PhaseLocking phaseLocking{ PhaseLocking::Identity };
+            /**
+                The (0 to 1) proportion of a frame's magnitude that has to be new for the frame to count as a transient. Anything above 1 disables transient handling.
+            */
+            SampleType transientThreshold{ static_cast<SampleType>(0.6) };
+        };
+
+        PhaseVocoder();
+        ~PhaseVocoder() noexcept;
+
+        /**
+            Prepares the vocoder for streaming. Allocates, and resets the vocoder.
+            \param settings The settings to use. The stretch, pitch, phase locking and transient threshold can be changed afterwards.
+            \param maxBlockSize The most samples that will be passed to a single call to `push`.
+            \param maxStretch The largest `timeStretch * pitchShift` that will be used - sets the size of the output buffer.
+        */
+        void initialise(const Settings& settings, size_t maxBlockSize, double maxStretch);
+
+        /**
+            Sets the ratio of the output's length to the input's. Takes effect from the next frame.
+            \param ratio The time stretch ratio. `timeStretch * pitchShift` <b>must</b> be no bigger than the `maxStretch` passed to `initialise`, and no smaller than `hopSize / fftSize`.
+        */
+        void setTimeStretch(double ratio) noexcept;
+
+        /**
+            Sets the ratio of the output's pitch to the input's. Takes effect from the next frame.
+            \param ratio The pitch shift ratio - 2 is an octave up. The same limits as `setTimeStretch` apply.
+        */
+        void setPitchShift(double ratio) noexcept;
+
+        /**
+            Sets the phase locking strategy. Takes effect from the next frame.
+            \param phaseLocking The phase locking strategy to use.
+        */
+        void setPhaseLocking(PhaseLocking phaseLocking) noexcept;
+
+        /**
+            Sets the transient detection threshold. Takes effect from the next frame.
+            \param threshold The (0 to 1) proportion of a frame's magnitude that has to be new for the frame to count as a transient.
+        */
+        void setTransientThreshold(SampleType threshold) noexcept;
+
+        /**
+            Clears all buffered input and output, and the phase history.
+        */
+        void reset() noexcept;
+
+        /**
+            Pushes a block of input into the vocoder, and processes every frame it completes. Doesn't allocate.
+            The output from those frames has to be collected with `pull` before the next call - the output buffer only has room for around one block's worth.
+            \param input The samples to push. <b>Must</b> be no longer than the `maxBlockSize` passed to `initialise`.
+        */
+        void push(std::span<const SampleType> input) noexcept;
+
+        /**
+            Retrieves the number of output samples ready to be pulled.
+            \return The number of samples available.
+        */
+        [[nodiscard]] size_t getNumAvailable() const noexcept;
+
+        /**
+            Pulls as much output as is available, up to `output.size()` samples. Doesn't allocate.
+            \param output The array-like to write the output to.
+            \return The number of samples written.
+        */
+        size_t pull(std::span<SampleType> output) noexcept;
+
+        /**
+            Retrieves the number of samples the streaming output is delayed by, relative to the input. When time stretching, the delay in the output is this times the stretch.
+            \return The latency in samples - `fftSize - hopSize`.
+        */
+        [[nodiscard]] size_t getLatency() const noexcept;
+
+        /**
+            Time stretches and / or pitch shifts a whole signal, splitting the work across `numThreads` threads (including the calling thread).
+            \param input The signal to process.
+            \param settings The settings to use.
+            \param numThreads The number of threads to use. Capped so that every thread has a reasonable number of frames to process.
+            \return The processed signal, `round(input.size() * timeStretch)` samples long, and aligned with the input.
+        */
+        [[nodiscard]] static std::vector<SampleType> processOffline(std::span<const SampleType> input, const Settings& settings, size_t numThreads);
+
+    private:
+        class Engine;
+
+        void processFrames() noexcept;
+
+        Settings m_settings;
+        std::unique_ptr<Engine> m_engine;
+        std::vector<SampleType> m_input;
+        size_t m_inputSize{ 0 };
+        double m_analysisPosition{ 0.0 };
+        std::ptrdiff_t m_previousFrameStart{ 0 };
+        std::vector<SampleType> m_output;
+        std::vector<SampleType> m_frame;
+        size_t m_writePosition{ 0 };
+        size_t m_readPosition{ 0 };
+        size_t m_numFinished{ 0 };
+        double m_readFraction{ 0.0 };
+    };
+} // namespace marvin::dsp::spectral
+#endif
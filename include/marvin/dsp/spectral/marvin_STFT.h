@@ -0,0 +1,110 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_STFT_H
+#define MARVIN_STFT_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/dsp/spectral/marvin_FFT.h"
+#include "marvin/math/marvin_Windows.h"
+#include <complex>
+#include <functional>
+#include <memory>
+#include <span>
+#include <vector>
+namespace marvin::dsp::spectral {
+    /**
+        \brief A streaming short-time Fourier transform - analysis, a per-frame hook to modify the spectrum, and overlap-add resynthesis.
+
+        Every `hopSize` samples, the most recent `fftSize` samples of input are windowed and transformed, and the spectrum is passed to the frame callback, which can modify it in place.
+        The result is inverse transformed, windowed again, and overlap-added into the output. The overlap-add is normalised by the sum of the squared window over the overlapping frames,
+        so with an unmodified spectrum the output is the input, delayed by `getLatency()` samples, for any window and any hop that's no bigger than half the FFT size.
+
+        The input history is stored twice over (like `filters::FIR`), so each frame is windowed straight out of it, and the synthesis window and overlap-add are a single multiply-add per frame.
+        Nothing allocates after `initialise`, and `process` accepts any number of samples.
+    */
+    template <FloatType SampleType>
+    class STFT final {
+    public:
+        /**
+            The type of the per-frame hook. Receives the frame's `(fftSize / 2) + 1` bins (in the layout `FFT::forward` produces), and can modify them in place.
+        */
+        using FrameCallback = std::function<void(std::span<std::complex<SampleType>>)>;
+
+        /**
+            Prepares the STFT with one of `math::windows`' window functions. Allocates, and resets the STFT.
+            \param fftSize The size of each frame (and transform). Should be a size the FFT handles well (ideally a power of two).
+            \param hopSize The number of samples between frames. <b>Must</b> be no bigger than `fftSize / 2`.
+            \param windowType The window to use for both analysis and synthesis. Tukey and CosineSum windows use an alpha of 0.5.
+        */
+        void initialise(size_t fftSize, size_t hopSize, math::windows::WindowType windowType);
+
+        /**
+            Prepares the STFT with a custom window. Allocates, and resets the STFT.
+            \param fftSize The size of each frame (and transform). Should be a size the FFT handles well (ideally a power of two).
+            \param hopSize The number of samples between frames. <b>Must</b> be no bigger than `fftSize / 2`.
+            \param window The window to use for both analysis and synthesis. <b>Must</b> be `fftSize` points long, and its overlapping squares must never sum to zero.
+        */
+        void initialise(size_t fftSize, size_t hopSize, std::span<const SampleType> window);
+
+        /**
+            Sets the hook called on every frame's spectrum. If no callback is set, the spectrum is passed through unmodified.
+            Not thread safe - call it either before processing, or from the audio thread.
+            \param callback The function to call on each frame.
+        */
+        void setFrameCallback(FrameCallback&& callback);
+
+        /**
+            Clears the input history and anything left in the overlap-add buffer. Doesn't allocate.
+        */
+        void reset() noexcept;
+
+        /**
+            Runs `data` through the STFT in place. Calls the frame callback for every frame completed during the call. Doesn't allocate (provided the callback doesn't).
+            \param data The samples to process.
+        */
+        void process(std::span<SampleType> data) noexcept;
+
+        /**
+            Retrieves the number of samples the output is delayed by, relative to the input.
+            \return The latency in samples - `fftSize - 1`.
+        */
+        [[nodiscard]] size_t getLatency() const noexcept;
+
+        /**
+            Retrieves the frame size passed to `initialise`.
+            \return The FFT size.
+        */
+        [[nodiscard]] size_t getFFTSize() const noexcept;
+
+        /**
+            Retrieves the hop size passed to `initialise`.
+            \return The hop size.
+        */
+        [[nodiscard]] size_t getHopSize() const noexcept;
+
+    private:
+        void processFrame(size_t numUnread) noexcept;
+
+        std::unique_ptr<FFT<SampleType>> m_fft{ nullptr };
+        FrameCallback m_frameCallback;
+        size_t m_fftSize{ 0 };
+        size_t m_hopSize{ 0 };
+        size_t m_inputPosition{ 0 };
+        size_t m_outputPosition{ 0 };
+        size_t m_hopCounter{ 0 };
+        std::vector<SampleType> m_analysisWindow;
+        std::vector<SampleType> m_synthesisWindow;
+        std::vector<SampleType> m_inputHistory;
+        std::vector<SampleType> m_overlapAddBuffer;
+        std::vector<SampleType> m_frame;
+        std::vector<std::complex<SampleType>> m_spectrum;
+    };
+} // namespace marvin::dsp::spectral
+#endif
@@ -0,0 +1,113 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_SPECTRALANALYSER_H
+#define MARVIN_SPECTRALANALYSER_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/math/marvin_Windows.h"
+#include <cstddef>
+#include <span>
+#include <vector>
+namespace marvin::dsp::spectral {
+    /**
+        \brief Offline spectrogram and spectral feature extraction, for whole signals at a time.
+
+        Frame `i` covers samples `[i * hopSize, i * hopSize + fftSize)`, with the signal zero-padded past its end, and there are just enough frames to cover every sample.
+        For each frame, computes:
+        - The magnitude spectrum of the windowed frame (unnormalised, straight from the FFT).
+        - The spectral centroid - the magnitude weighted mean frequency, in Hz.
+        - The spectral flux - the L2 norm of the (half-wave rectified) rise in magnitude since the previous frame. The first frame is compared against silence.
+        - The spectral rolloff - the lowest frequency (in Hz) below which `rolloffProportion` of the frame's energy lies.
+        - The RMS of the (unwindowed) frame.
+
+        The frames are split into contiguous ranges, one per thread. Each thread owns its own `FFT` and scratch buffers, and writes straight into its rows of the results,
+        so the threads never share any mutable state, and the throughput scales with the number of cores.
+    */
+    template <FloatType SampleType>
+    class SpectralAnalyser final {
+    public:
+        /**
+            \brief The analysis parameters.
+        */
+        struct Settings final {
+            /**
+                The frame size. Should be a size the FFT handles well (ideally a power of two).
+            */
+            size_t fftSize{ 2048 };
+            /**
+                The distance between the starts of consecutive frames. <b>Must</b> be nonzero.
+            */
+            size_t hopSize{ 512 };
+            /**
+                The analysis window.
+            */
+            math::windows::WindowType windowType{ math::windows::WindowType::Hann };
+            /**
+                The sample rate of the signal - only used to express the centroid and rolloff in Hz.
+            */
+            double sampleRate{ 44100.0 };
+            /**
+                The (0 to 1) proportion of each frame's energy the rolloff frequency is measured at.
+            */
+            SampleType rolloffProportion{ static_cast<SampleType>(0.85) };
+        };
+
+        /**
+            \brief The results of an analysis - the spectrogram, and one value per frame for each of the features.
+        */
+        struct Analysis final {
+            /**
+                The number of frames analysed.
+            */
+            size_t numFrames{ 0 };
+            /**
+                The number of bins in each frame, `fftSize / 2 + 1`.
+            */
+            size_t numBins{ 0 };
+            /**
+                The magnitude spectra, as a contiguous `numFrames x numBins` matrix - frame `i`'s bins start at `i * numBins`.
+            */
+            std::vector<SampleType> magnitudes;
+            /**
+                The spectral centroid of each frame, in Hz. 0 for silent frames.
+            */
+            std::vector<SampleType> centroid;
+            /**
+                The spectral flux of each frame.
+            */
+            std::vector<SampleType> flux;
+            /**
+                The spectral rolloff of each frame, in Hz. 0 for silent frames.
+            */
+            std::vector<SampleType> rolloff;
+            /**
+                The RMS level of each frame.
+            */
+            std::vector<SampleType> rms;
+
+            /**
+                Retrieves a single frame's magnitude spectrum.
+                \param frame The index of the frame.
+                \return A view into the frame's row of `magnitudes`.
+            */
+            [[nodiscard]] std::span<const SampleType> getFrame(size_t frame) const noexcept;
+        };
+
+        /**
+            Analyses a whole signal, splitting the frames across `numThreads` threads (including the calling thread).
+            \param input The signal to analyse.
+            \param settings The analysis parameters.
+            \param numThreads The number of threads to use. Capped so that every thread has a reasonable number of frames to process.
+            \return The analysis results. Empty if `input` is.
+        */
+        [[nodiscard]] static Analysis analyse(std::span<const SampleType> input, const Settings& settings, size_t numThreads);
+    };
+} // namespace marvin::dsp::spectral
+#endif
@@ -71,6 +71,15 @@ namespace marvin {
         requires FloatType<typename T::value_type>;
     };
 
+    /**
+        \brief Constrains T to be an Array like, with a `std::complex<float>` or `std::complex<double>` value type.
+    */
+    template <class T>
+    concept ComplexArrayLike = requires {
+        requires ArrayLike<T>;
+        requires ComplexFloatType<typename T::value_type>;
+    };
+
     /**
         \brief Constrains T to a class that implements `get()`, `reset()` `operator*()` and `operator->()`.
     */
@@ -11,6 +11,9 @@
 #ifndef MARVIN_CONVERSIONS_H
 #define MARVIN_CONVERSIONS_H
 #include <marvin/library/marvin_Concepts.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 namespace marvin::math {
 
     /**
@@ -75,6 +78,71 @@ namespace marvin::math {
         return db;
     }
 
+    /**
+        Converts a block of levels from decibels to gain, with the same semantics as the scalar `dbToGain`. Vectorised via `math::vecops::exp`,
+        so is a lot cheaper than calling the scalar version per-sample, at the cost of a few ULP of accuracy (see `math::vecops::exp`).
+        \param dest A raw pointer to the array-like to write the gains to. May alias `db`.
+        \param db A raw pointer to the array-like of levels in decibels.
+        \param size The number of elements in `dest` and `db`.
+        \param referenceMinDb The level in decibels that should correspond to 0 gain. Optional, defaults to -100dB.
+    */
+    template <FloatType T>
+    void dbToGain(T* dest, const T* db, size_t size, T referenceMinDb = static_cast<T>(-100.0)) noexcept;
+
+    /**
+        Converts a block of levels from decibels to gain. `dest.size()` <b>must</b> == `db.size()`.
+        \param dest The array-like to write the gains to.
+        \param db The array-like of levels in decibels.
+        \param referenceMinDb The level in decibels that should correspond to 0 gain. Optional, defaults to -100dB.
+    */
+    template <FloatArrayLike T>
+    void dbToGain(T& dest, const T& db, typename T::value_type referenceMinDb = static_cast<typename T::value_type>(-100.0)) noexcept {
+        assert(dest.size() == db.size());
+        dbToGain(dest.data(), db.data(), dest.size(), referenceMinDb);
+    }
+
+    /**
+        Converts a block of gains to decibels, with the same semantics as the scalar `gainToDb`. Vectorised via `math::vecops::log10`.
+        \param dest A raw pointer to the array-like to write the levels in decibels to. May alias `gain`.
+        \param gain A raw pointer to the array-like of 0 to 1 gains.
+        \param size The number of elements in `dest` and `gain`.
+        \param minusInfDb The level in decibels that should correspond to 0 gain. Optional, defaults to -100dB.
+    */
+    template <FloatType T>
+    void gainToDb(T* dest, const T* gain, size_t size, T minusInfDb = static_cast<T>(-100.0)) noexcept;
+
+    /**
+        Converts a block of gains to decibels. `dest.size()` <b>must</b> == `gain.size()`.
+        \param dest The array-like to write the levels in decibels to.
+        \param gain The array-like of 0 to 1 gains.
+        \param minusInfDb The level in decibels that should correspond to 0 gain. Optional, defaults to -100dB.
+    */
+    template <FloatArrayLike T>
+    void gainToDb(T& dest, const T& gain, typename T::value_type minusInfDb = static_cast<typename T::value_type>(-100.0)) noexcept {
+        assert(dest.size() == gain.size());
+        gainToDb(dest.data(), gain.data(), dest.size(), minusInfDb);
+    }
+
+    /**
+        Converts a frequency in Hz to the (HTK) mel scale - `2595 * log10(1 + hz / 700)`.
+        \param hz The frequency in Hz.
+        \return The frequency in mels.
+    */
+    template <FloatType T>
+    [[nodiscard]] T hzToMel(T hz) noexcept {
+        return static_cast<T>(2595.0) * std::log10(static_cast<T>(1.0) + hz / static_cast<T>(700.0));
+    }
+
+    /**
+        Converts a frequency on the (HTK) mel scale to Hz - the inverse of `hzToMel`.
+        \param mel The frequency in mels.
+        \return The frequency in Hz.
+    */
+    template <FloatType T>
+    [[nodiscard]] T melToHz(T mel) noexcept {
+        return static_cast<T>(700.0) * (std::pow(static_cast<T>(10.0), mel / static_cast<T>(2595.0)) - static_cast<T>(1.0));
+    }
+
 } // namespace marvin::math
 
 #endif // INFERNO_MARVIN_CONVERSIONS_H
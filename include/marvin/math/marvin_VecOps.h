@@ -11,11 +11,109 @@
 #define MARVIN_SIMDOPS_H
 #include <marvin/library/marvin_Concepts.h>
 #include <marvin/library/marvin_Literals.h>
+#include <marvin/utils/marvin_Range.h>
+#include <marvin/containers/marvin_BufferView.h>
 #include <type_traits>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <cassert>
 namespace marvin::math::vecops {
 
+    /**
+        \brief POD type returned by the indexed reductions (like `maxAbs`), holding a value and the index it was found at.
+    */
+    template <FloatType T>
+    struct IndexedValue final {
+        T value;
+        size_t index;
+    };
+
+    /**
+        \brief The integer sample formats supported by the sample format conversion functions.
+
+        All formats are signed and little-endian, and scaled such that `2^(bits - 1)` corresponds to a float value of 1.
+    */
+    enum class SampleFormat {
+        Int16,
+        Int24, // Packed, 3 bytes per sample.
+        Int32
+    };
+
+    /**
+        Retrieves the number of bytes a single sample takes up in the given format.
+        \param format The sample format to query.
+        \return The number of bytes per sample.
+    */
+    [[nodiscard]] constexpr size_t getBytesPerSample(SampleFormat format) noexcept {
+        switch (format) {
+            case SampleFormat::Int16: return 2;
+            case SampleFormat::Int24: return 3;
+            case SampleFormat::Int32: return 4;
+        }
+        return 0;
+    }
+
+    /**
+        \brief Cheap triangular (TPDF) dither source, for the dithered float to int conversions.
+
+        Generates noise in the range `(-1, 1)` LSB, with a triangular distribution, from an xorshift32 generator.
+        Keep one of these per stream (it's not thread safe), and reuse it between blocks.
+    */
+    class TriangularDither final {
+    public:
+        /**
+            Constructs a TriangularDither with the given seed.
+            \param seed The seed to initialise the generator with. Must be non-zero - a zero seed is replaced with 1.
+        */
+        explicit TriangularDither(std::uint32_t seed = 0x9E3779B9) noexcept : m_state(seed == 0 ? 1 : seed) {
+        }
+
+        /**
+            Generates the next dither value.
+            \return A triangularly distributed value in the range `(-1, 1)`.
+        */
+        template <FloatType T>
+        [[nodiscard]] T next() noexcept {
+            return uniform<T>() - uniform<T>();
+        }
+
+        /**
+            Fills `dest` with successive values from `next()`. Defined out of line, so the sample format conversion kernels can call it without pulling
+            an instantiation of `next()` into the AVX kernel TUs. Takes a raw pointer rather than a `std::span`, as the kernels can't construct one
+            without sharing its (non-arch-specific) instantiation with the baseline TUs.
+            \param dest The array to fill.
+            \param size The number of values to write to `dest`.
+        */
+        template <FloatType T>
+        void fill(T* dest, size_t size) noexcept;
+
+    private:
+        template <FloatType T>
+        [[nodiscard]] T uniform() noexcept {
+            m_state ^= m_state << 13;
+            m_state ^= m_state >> 17;
+            m_state ^= m_state << 5;
+            return static_cast<T>(m_state) * static_cast<T>(1.0 / 4294967296.0);
+        }
+
+        std::uint32_t m_state;
+    };
+
+    /**
+        \brief Non-owning view over complex data stored in split format - two separate arrays for the real and imaginary components.
+
+        This is the layout vDSP uses internally (`DSPSplitComplex`), and avoids the deinterleave step the SIMD paths otherwise need for `std::complex` data.
+        The complex overloads in this namespace accept either this or interleaved `std::complex<T>*` data.
+    */
+    template <FloatType T>
+    struct SplitComplex final {
+        T* real;
+        T* imag;
+    };
+
     /**
         Adds the values of `rhs` to the values of `lhs`, and
         stores the result in `lhs`.
@@ -186,6 +284,843 @@ namespace marvin::math::vecops {
         divide(arr.data(), scalar, arr.size());
     }
 
+    /**
+        Adds the values of `lhs` and `rhs`, and stores the result in `dest`. `dest` may alias `lhs` or `rhs`.
+        \param dest A raw pointer to the destination array-like.
+        \param lhs A raw pointer to the first source array-like.
+        \param rhs A raw pointer to the second source array-like.
+        \param size The number of elements in `dest`, `lhs` and `rhs`.
+    */
+    template <FloatType T>
+    void add(T* dest, const T* lhs, const T* rhs, size_t size) noexcept;
+
+    /**
+        Adds the values of `lhs` and `rhs`, and stores the result in `dest`.
+        `dest.size()`, `lhs.size()` and `rhs.size()` <b>must</b> all be equal.
+        \param dest The destination array-like.
+        \param lhs The first source array-like.
+        \param rhs The second source array-like.
+    */
+    template <FloatArrayLike T>
+    void add(T& dest, const T& lhs, const T& rhs) noexcept {
+        assert(dest.size() == lhs.size() && dest.size() == rhs.size());
+        add(dest.data(), lhs.data(), rhs.data(), dest.size());
+    }
+
+    /**
+        Subtracts the values of `rhs` from the values of `lhs`, and stores the result in `dest`. `dest` may alias `lhs` or `rhs`.
+        \param dest A raw pointer to the destination array-like.
+        \param lhs A raw pointer to the array-like to subtract from.
+        \param rhs A raw pointer to the array-like to subtract.
+        \param size The number of elements in `dest`, `lhs` and `rhs`.
+    */
+    template <FloatType T>
+    void subtract(T* dest, const T* lhs, const T* rhs, size_t size) noexcept;
+
+    /**
+        Subtracts the values of `rhs` from the values of `lhs`, and stores the result in `dest`.
+        `dest.size()`, `lhs.size()` and `rhs.size()` <b>must</b> all be equal.
+        \param dest The destination array-like.
+        \param lhs The array-like to subtract from.
+        \param rhs The array-like to subtract.
+    */
+    template <FloatArrayLike T>
+    void subtract(T& dest, const T& lhs, const T& rhs) noexcept {
+        assert(dest.size() == lhs.size() && dest.size() == rhs.size());
+        subtract(dest.data(), lhs.data(), rhs.data(), dest.size());
+    }
+
+    /**
+        Multiplies the values of `lhs` by the values of `rhs`, and stores the result in `dest`. `dest` may alias `lhs` or `rhs`.
+        \param dest A raw pointer to the destination array-like.
+        \param lhs A raw pointer to the first source array-like.
+        \param rhs A raw pointer to the second source array-like.
+        \param size The number of elements in `dest`, `lhs` and `rhs`.
+    */
+    template <FloatType T>
+    void multiply(T* dest, const T* lhs, const T* rhs, size_t size) noexcept;
+
+    /**
+        Multiplies the values of `lhs` by the values of `rhs`, and stores the result in `dest`.
+        `dest.size()`, `lhs.size()` and `rhs.size()` <b>must</b> all be equal.
+        \param dest The destination array-like.
+        \param lhs The first source array-like.
+        \param rhs The second source array-like.
+    */
+    template <FloatArrayLike T>
+    void multiply(T& dest, const T& lhs, const T& rhs) noexcept {
+        assert(dest.size() == lhs.size() && dest.size() == rhs.size());
+        multiply(dest.data(), lhs.data(), rhs.data(), dest.size());
+    }
+
+    /**
+        Divides the values of `lhs` by the values of `rhs`, and stores the result in `dest`. `dest` may alias `lhs` or `rhs`.
+        \param dest A raw pointer to the destination array-like.
+        \param lhs A raw pointer to the numerator array-like.
+        \param rhs A raw pointer to the denominator array-like.
+        \param size The number of elements in `dest`, `lhs` and `rhs`.
+    */
+    template <FloatType T>
+    void divide(T* dest, const T* lhs, const T* rhs, size_t size) noexcept;
+
+    /**
+        Divides the values of `lhs` by the values of `rhs`, and stores the result in `dest`.
+        `dest.size()`, `lhs.size()` and `rhs.size()` <b>must</b> all be equal.
+        \param dest The destination array-like.
+        \param lhs The numerator array-like.
+        \param rhs The denominator array-like.
+    */
+    template <FloatArrayLike T>
+    void divide(T& dest, const T& lhs, const T& rhs) noexcept {
+        assert(dest.size() == lhs.size() && dest.size() == rhs.size());
+        divide(dest.data(), lhs.data(), rhs.data(), dest.size());
+    }
+
+    /**
+        Copies the values of `src` into `dest`, multiplied by `gain` - equivalent to a `copy` followed by a `multiply`, in a single pass.
+        \param dest A raw pointer to the destination array-like.
+        \param src A raw pointer to the source array-like.
+        \param gain The value to multiply each element of `src` by.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void copyWithGain(T* dest, const T* src, T gain, size_t size) noexcept;
+
+    /**
+        Copies the values of `src` into `dest`, multiplied by `gain`. `dest.size()` <b>must</b> == `src.size()`.
+        \param dest The destination array-like.
+        \param src The source array-like.
+        \param gain The value to multiply each element of `src` by.
+    */
+    template <FloatArrayLike T>
+    void copyWithGain(T& dest, const T& src, typename T::value_type gain) noexcept {
+        assert(dest.size() == src.size());
+        copyWithGain(dest.data(), src.data(), gain, dest.size());
+    }
+
+    /**
+        Multiplies the values of `src` by `gain`, and adds the result to the values of `dest` (`dest[i] += src[i] * gain`).
+        Useful for mixing a gained source into a bus in a single pass.
+        \param dest A raw pointer to the destination (accumulator) array-like.
+        \param src A raw pointer to the source array-like.
+        \param gain The value to multiply each element of `src` by.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void multiplyAdd(T* dest, const T* src, T gain, size_t size) noexcept;
+
+    /**
+        Multiplies the values of `src` by `gain`, and adds the result to the values of `dest`. `dest.size()` <b>must</b> == `src.size()`.
+        \param dest The destination (accumulator) array-like.
+        \param src The source array-like.
+        \param gain The value to multiply each element of `src` by.
+    */
+    template <FloatArrayLike T>
+    void multiplyAdd(T& dest, const T& src, typename T::value_type gain) noexcept {
+        assert(dest.size() == src.size());
+        multiplyAdd(dest.data(), src.data(), gain, dest.size());
+    }
+
+    /**
+        Multiplies the values of `lhs` by the values of `rhs`, and adds the result to the values of `dest` (`dest[i] += lhs[i] * rhs[i]`).
+        \param dest A raw pointer to the destination (accumulator) array-like.
+        \param lhs A raw pointer to the first source array-like.
+        \param rhs A raw pointer to the second source array-like.
+        \param size The number of elements in `dest`, `lhs` and `rhs`.
+    */
+    template <FloatType T>
+    void multiplyAdd(T* dest, const T* lhs, const T* rhs, size_t size) noexcept;
+
+    /**
+        Multiplies the values of `lhs` by the values of `rhs`, and adds the result to the values of `dest`.
+        `dest.size()`, `lhs.size()` and `rhs.size()` <b>must</b> all be equal.
+        \param dest The destination (accumulator) array-like.
+        \param lhs The first source array-like.
+        \param rhs The second source array-like.
+    */
+    template <FloatArrayLike T>
+    void multiplyAdd(T& dest, const T& lhs, const T& rhs) noexcept {
+        assert(dest.size() == lhs.size() && dest.size() == rhs.size());
+        multiplyAdd(dest.data(), lhs.data(), rhs.data(), dest.size());
+    }
+
+    /**
+        Scales `a` and `b` by their respective gains and sums them into `dest` (`dest[i] = a[i] * aGain + b[i] * bGain`). `dest` may alias `a` or `b`.
+        \param dest A raw pointer to the destination array-like.
+        \param a A raw pointer to the first source array-like.
+        \param aGain The value to multiply each element of `a` by.
+        \param b A raw pointer to the second source array-like.
+        \param bGain The value to multiply each element of `b` by.
+        \param size The number of elements in `dest`, `a` and `b`.
+    */
+    template <FloatType T>
+    void addScaled(T* dest, const T* a, T aGain, const T* b, T bGain, size_t size) noexcept;
+
+    /**
+        Scales `a` and `b` by their respective gains and sums them into `dest`.
+        `dest.size()`, `a.size()` and `b.size()` <b>must</b> all be equal.
+        \param dest The destination array-like.
+        \param a The first source array-like.
+        \param aGain The value to multiply each element of `a` by.
+        \param b The second source array-like.
+        \param bGain The value to multiply each element of `b` by.
+    */
+    template <FloatArrayLike T>
+    void addScaled(T& dest, const T& a, typename T::value_type aGain, const T& b, typename T::value_type bGain) noexcept {
+        assert(dest.size() == a.size() && dest.size() == b.size());
+        addScaled(dest.data(), a.data(), aGain, b.data(), bGain, dest.size());
+    }
+
+    /**
+        Linearly crossfades from `from` to `to`, using `ramp` as the per-sample mix position (`dest[i] = from[i] + (to[i] - from[i]) * ramp[i]`).
+        A `ramp` value of 0 gives `from`, and a value of 1 gives `to`. `dest` may alias `from` or `to`.
+        \param dest A raw pointer to the destination array-like.
+        \param from A raw pointer to the array-like to fade out.
+        \param to A raw pointer to the array-like to fade in.
+        \param ramp A raw pointer to the mix positions, generally in the range `[0, 1]`.
+        \param size The number of elements in `dest`, `from`, `to` and `ramp`.
+    */
+    template <FloatType T>
+    void crossfade(T* dest, const T* from, const T* to, const T* ramp, size_t size) noexcept;
+
+    /**
+        Linearly crossfades from `from` to `to`, using `ramp` as the per-sample mix position.
+        `dest.size()`, `from.size()`, `to.size()` and `ramp.size()` <b>must</b> all be equal.
+        \param dest The destination array-like.
+        \param from The array-like to fade out.
+        \param to The array-like to fade in.
+        \param ramp The mix positions, generally in the range `[0, 1]`.
+    */
+    template <FloatArrayLike T>
+    void crossfade(T& dest, const T& from, const T& to, const T& ramp) noexcept {
+        assert(dest.size() == from.size() && dest.size() == to.size() && dest.size() == ramp.size());
+        crossfade(dest.data(), from.data(), to.data(), ramp.data(), dest.size());
+    }
+
+    /**
+        Sums the values in `arr`.<br>
+        The reductions are deterministic for a given backend and input, but the summation order differs between vDSP, IPP and the fallback,
+        so results may differ in the last few bits between platforms.
+        \param arr A raw pointer to the source array-like.
+        \param size The number of elements in `arr`.
+        \return The sum of all elements in `arr`, or 0 if `size` is 0.
+    */
+    template <FloatType T>
+    [[nodiscard]] T sum(const T* arr, size_t size) noexcept;
+
+    /**
+        Sums the values in `arr`.
+        \param arr The source array-like.
+        \return The sum of all elements in `arr`, or 0 if `arr` is empty.
+    */
+    template <FloatArrayLike T>
+    [[nodiscard]] typename T::value_type sum(const T& arr) noexcept {
+        return sum(arr.data(), arr.size());
+    }
+
+    /**
+        Computes the dot product of `lhs` and `rhs` (`sum(lhs[i] * rhs[i])`).
+        \param lhs A raw pointer to the first source array-like.
+        \param rhs A raw pointer to the second source array-like.
+        \param size The number of elements in `lhs` and `rhs`.
+        \return The dot product of `lhs` and `rhs`, or 0 if `size` is 0.
+    */
+    template <FloatType T>
+    [[nodiscard]] T dot(const T* lhs, const T* rhs, size_t size) noexcept;
+
+    /**
+        Computes the dot product of `lhs` and `rhs`. `lhs.size()` <b>must</b> == `rhs.size()`.
+        \param lhs The first source array-like.
+        \param rhs The second source array-like.
+        \return The dot product of `lhs` and `rhs`.
+    */
+    template <FloatArrayLike T>
+    [[nodiscard]] typename T::value_type dot(const T& lhs, const T& rhs) noexcept {
+        assert(lhs.size() == rhs.size());
+        return dot(lhs.data(), rhs.data(), lhs.size());
+    }
+
+    /**
+        Sums the squares of the values in `arr` (`sum(arr[i] * arr[i])`).
+        \param arr A raw pointer to the source array-like.
+        \param size The number of elements in `arr`.
+        \return The sum of squares of `arr`, or 0 if `size` is 0.
+    */
+    template <FloatType T>
+    [[nodiscard]] T sumOfSquares(const T* arr, size_t size) noexcept;
+
+    /**
+        Sums the squares of the values in `arr`.
+        \param arr The source array-like.
+        \return The sum of squares of `arr`, or 0 if `arr` is empty.
+    */
+    template <FloatArrayLike T>
+    [[nodiscard]] typename T::value_type sumOfSquares(const T& arr) noexcept {
+        return sumOfSquares(arr.data(), arr.size());
+    }
+
+    /**
+        Computes the root-mean-square of the values in `arr`.
+        \param arr A raw pointer to the source array-like.
+        \param size The number of elements in `arr`.
+        \return The RMS of `arr`, or 0 if `size` is 0.
+    */
+    template <FloatType T>
+    [[nodiscard]] T rms(const T* arr, size_t size) noexcept;
+
+    /**
+        Computes the root-mean-square of the values in `arr`.
+        \param arr The source array-like.
+        \return The RMS of `arr`, or 0 if `arr` is empty.
+    */
+    template <FloatArrayLike T>
+    [[nodiscard]] typename T::value_type rms(const T& arr) noexcept {
+        return rms(arr.data(), arr.size());
+    }
+
+    /**
+        Finds the largest absolute value in `arr`, and the index it occurs at. If the peak occurs more than once, the first index is returned.
+        \param arr A raw pointer to the source array-like.
+        \param size The number of elements in `arr`.
+        \return The (absolute) peak value and its index, or `{ 0, 0 }` if `size` is 0.
+    */
+    template <FloatType T>
+    [[nodiscard]] IndexedValue<T> maxAbs(const T* arr, size_t size) noexcept;
+
+    /**
+        Finds the largest absolute value in `arr`, and the index it occurs at.
+        \param arr The source array-like.
+        \return The (absolute) peak value and its index, or `{ 0, 0 }` if `arr` is empty.
+    */
+    template <FloatArrayLike T>
+    [[nodiscard]] IndexedValue<typename T::value_type> maxAbs(const T& arr) noexcept {
+        return maxAbs(arr.data(), arr.size());
+    }
+
+    /**
+        Finds the smallest and largest values in `arr`.
+        \param arr A raw pointer to the source array-like.
+        \param size The number of elements in `arr`.
+        \return A `utils::Range<T>` containing the smallest and largest values, or `{ 0, 0 }` if `size` is 0.
+    */
+    template <FloatType T>
+    [[nodiscard]] utils::Range<T> minMax(const T* arr, size_t size) noexcept;
+
+    /**
+        Finds the smallest and largest values in `arr`.
+        \param arr The source array-like.
+        \return A `utils::Range<T>` containing the smallest and largest values, or `{ 0, 0 }` if `arr` is empty.
+    */
+    template <FloatArrayLike T>
+    [[nodiscard]] utils::Range<typename T::value_type> minMax(const T& arr) noexcept {
+        return minMax(arr.data(), arr.size());
+    }
+
+    /**
+        Computes `e` raised to the power of each value in `src`, and stores the result in `dest`. `dest` may alias `src`.<br>
+        The transcendental functions use vForce on macOS, IPP's VM functions (`_A24` / `_A53` accuracy) when IPP is available,
+        and xsimd's polynomial implementations otherwise. On all backends, results are within a few ULP of the `std::` equivalent - the tests hold them to a
+        relative error of `1e-6` for `float` and `1e-12` for `double` (absolute, for `sin` and `cos`) over each function's usual domain.
+        Behaviour outside the domain (e.g. `log` of a negative number) follows IEEE-754, and returns NaN or inf.
+        \param dest A raw pointer to the destination array-like.
+        \param src A raw pointer to the source array-like.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void exp(T* dest, const T* src, size_t size) noexcept;
+
+    /**
+        Computes `e` raised to the power of each value in `src`, and stores the result in `dest`. `dest.size()` <b>must</b> == `src.size()`.
+        \param dest The destination array-like.
+        \param src The source array-like.
+    */
+    template <FloatArrayLike T>
+    void exp(T& dest, const T& src) noexcept {
+        assert(dest.size() == src.size());
+        exp(dest.data(), src.data(), dest.size());
+    }
+
+    /**
+        Computes the natural logarithm of each value in `src`, and stores the result in `dest`. `dest` may alias `src`.
+        \param dest A raw pointer to the destination array-like.
+        \param src A raw pointer to the source array-like.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void log(T* dest, const T* src, size_t size) noexcept;
+
+    /**
+        Computes the natural logarithm of each value in `src`, and stores the result in `dest`. `dest.size()` <b>must</b> == `src.size()`.
+        \param dest The destination array-like.
+        \param src The source array-like.
+    */
+    template <FloatArrayLike T>
+    void log(T& dest, const T& src) noexcept {
+        assert(dest.size() == src.size());
+        log(dest.data(), src.data(), dest.size());
+    }
+
+    /**
+        Computes the base-10 logarithm of each value in `src`, and stores the result in `dest`. `dest` may alias `src`.
+        \param dest A raw pointer to the destination array-like.
+        \param src A raw pointer to the source array-like.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void log10(T* dest, const T* src, size_t size) noexcept;
+
+    /**
+        Computes the base-10 logarithm of each value in `src`, and stores the result in `dest`. `dest.size()` <b>must</b> == `src.size()`.
+        \param dest The destination array-like.
+        \param src The source array-like.
+    */
+    template <FloatArrayLike T>
+    void log10(T& dest, const T& src) noexcept {
+        assert(dest.size() == src.size());
+        log10(dest.data(), src.data(), dest.size());
+    }
+
+    /**
+        Computes the hyperbolic tangent of each value in `src`, and stores the result in `dest`. `dest` may alias `src`.
+        \param dest A raw pointer to the destination array-like.
+        \param src A raw pointer to the source array-like.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void tanh(T* dest, const T* src, size_t size) noexcept;
+
+    /**
+        Computes the hyperbolic tangent of each value in `src`, and stores the result in `dest`. `dest.size()` <b>must</b> == `src.size()`.
+        \param dest The destination array-like.
+        \param src The source array-like.
+    */
+    template <FloatArrayLike T>
+    void tanh(T& dest, const T& src) noexcept {
+        assert(dest.size() == src.size());
+        tanh(dest.data(), src.data(), dest.size());
+    }
+
+    /**
+        Computes the sine of each value (in radians) in `src`, and stores the result in `dest`. `dest` may alias `src`.
+        \param dest A raw pointer to the destination array-like.
+        \param src A raw pointer to the source array-like.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void sin(T* dest, const T* src, size_t size) noexcept;
+
+    /**
+        Computes the sine of each value (in radians) in `src`, and stores the result in `dest`. `dest.size()` <b>must</b> == `src.size()`.
+        \param dest The destination array-like.
+        \param src The source array-like.
+    */
+    template <FloatArrayLike T>
+    void sin(T& dest, const T& src) noexcept {
+        assert(dest.size() == src.size());
+        sin(dest.data(), src.data(), dest.size());
+    }
+
+    /**
+        Computes the cosine of each value (in radians) in `src`, and stores the result in `dest`. `dest` may alias `src`.
+        \param dest A raw pointer to the destination array-like.
+        \param src A raw pointer to the source array-like.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void cos(T* dest, const T* src, size_t size) noexcept;
+
+    /**
+        Computes the cosine of each value (in radians) in `src`, and stores the result in `dest`. `dest.size()` <b>must</b> == `src.size()`.
+        \param dest The destination array-like.
+        \param src The source array-like.
+    */
+    template <FloatArrayLike T>
+    void cos(T& dest, const T& src) noexcept {
+        assert(dest.size() == src.size());
+        cos(dest.data(), src.data(), dest.size());
+    }
+
+    /**
+        Raises each value in `base` to the power of the corresponding value in `exponent`, and stores the result in `dest`. `dest` may alias `base` or `exponent`.
+        \param dest A raw pointer to the destination array-like.
+        \param base A raw pointer to the base array-like.
+        \param exponent A raw pointer to the exponent array-like.
+        \param size The number of elements in `dest`, `base` and `exponent`.
+    */
+    template <FloatType T>
+    void pow(T* dest, const T* base, const T* exponent, size_t size) noexcept;
+
+    /**
+        Raises each value in `base` to the power of the corresponding value in `exponent`, and stores the result in `dest`.
+        `dest.size()`, `base.size()` and `exponent.size()` <b>must</b> all be equal.
+        \param dest The destination array-like.
+        \param base The base array-like.
+        \param exponent The exponent array-like.
+    */
+    template <FloatArrayLike T>
+    void pow(T& dest, const T& base, const T& exponent) noexcept {
+        assert(dest.size() == base.size() && dest.size() == exponent.size());
+        pow(dest.data(), base.data(), exponent.data(), dest.size());
+    }
+
+    /**
+        Performs a complex multiplication of `lhs` and `rhs`, and stores the result in `dest`. `dest` may alias `lhs` or `rhs`.
+        \param dest A raw pointer to the destination array-like.
+        \param lhs A raw pointer to the first source array-like.
+        \param rhs A raw pointer to the second source array-like.
+        \param size The number of complex elements in `dest`, `lhs` and `rhs`.
+    */
+    template <ComplexFloatType T>
+    void multiply(T* dest, const T* lhs, const T* rhs, size_t size) noexcept;
+
+    /**
+        Performs a complex multiplication of `lhs` and `rhs`, and stores the result in `dest`, for data in split format. `dest` may alias `lhs` or `rhs`.
+        \param dest The destination.
+        \param lhs The first source.
+        \param rhs The second source.
+        \param size The number of complex elements in `dest`, `lhs` and `rhs`.
+    */
+    template <FloatType T>
+    void multiply(SplitComplex<T> dest, SplitComplex<T> lhs, SplitComplex<T> rhs, size_t size) noexcept;
+
+    /**
+        Performs a complex multiplication of `lhs` and `rhs`, and stores the result in `dest`. `dest.size()`, `lhs.size()` and `rhs.size()` <b>must</b> all be equal.
+        \param dest The destination array-like.
+        \param lhs The first source array-like.
+        \param rhs The second source array-like.
+    */
+    template <ComplexArrayLike T>
+    void multiply(T& dest, const T& lhs, const T& rhs) noexcept {
+        assert(dest.size() == lhs.size() && dest.size() == rhs.size());
+        multiply(dest.data(), lhs.data(), rhs.data(), dest.size());
+    }
+
+    /**
+        Performs a complex multiplication of `lhs` and `rhs`, and adds the result to `dest` (`dest[i] += lhs[i] * rhs[i]`) - the multiply-accumulate step of a frequency domain convolution. `lhs` and `rhs` may alias each other, but not `dest`.
+        \param dest A raw pointer to the destination array-like.
+        \param lhs A raw pointer to the first source array-like.
+        \param rhs A raw pointer to the second source array-like.
+        \param size The number of complex elements in `dest`, `lhs` and `rhs`.
+    */
+    template <ComplexFloatType T>
+    void multiplyAdd(T* dest, const T* lhs, const T* rhs, size_t size) noexcept;
+
+    /**
+        Performs a complex multiplication of `lhs` and `rhs`, and adds the result to `dest` (`dest[i] += lhs[i] * rhs[i]`) - the multiply-accumulate step of a frequency domain convolution, for data in split format. `lhs` and `rhs` may alias each other, but not `dest`.
+        \param dest The destination.
+        \param lhs The first source.
+        \param rhs The second source.
+        \param size The number of complex elements in `dest`, `lhs` and `rhs`.
+    */
+    template <FloatType T>
+    void multiplyAdd(SplitComplex<T> dest, SplitComplex<T> lhs, SplitComplex<T> rhs, size_t size) noexcept;
+
+    /**
+        Performs a complex multiplication of `lhs` and `rhs`, and adds the result to `dest` (`dest[i] += lhs[i] * rhs[i]`) - the multiply-accumulate step of a frequency domain convolution. `dest.size()`, `lhs.size()` and `rhs.size()` <b>must</b> all be equal.
+        \param dest The destination array-like.
+        \param lhs The first source array-like.
+        \param rhs The second source array-like.
+    */
+    template <ComplexArrayLike T>
+    void multiplyAdd(T& dest, const T& lhs, const T& rhs) noexcept {
+        assert(dest.size() == lhs.size() && dest.size() == rhs.size());
+        multiplyAdd(dest.data(), lhs.data(), rhs.data(), dest.size());
+    }
+
+    /**
+        Multiplies `lhs` by the complex conjugate of `rhs`, and adds the result to `dest` (`dest[i] += lhs[i] * conj(rhs[i])`) - the accumulate step of a cross-spectrum / cross-correlation. `lhs` and `rhs` may alias each other, but not `dest`.
+        \param dest A raw pointer to the destination array-like.
+        \param lhs A raw pointer to the first source array-like.
+        \param rhs A raw pointer to the second source array-like.
+        \param size The number of complex elements in `dest`, `lhs` and `rhs`.
+    */
+    template <ComplexFloatType T>
+    void conjugateMultiplyAdd(T* dest, const T* lhs, const T* rhs, size_t size) noexcept;
+
+    /**
+        Multiplies `lhs` by the complex conjugate of `rhs`, and adds the result to `dest` (`dest[i] += lhs[i] * conj(rhs[i])`) - the accumulate step of a cross-spectrum / cross-correlation, for data in split format. `lhs` and `rhs` may alias each other, but not `dest`.
+        \param dest The destination.
+        \param lhs The first source.
+        \param rhs The second source.
+        \param size The number of complex elements in `dest`, `lhs` and `rhs`.
+    */
+    template <FloatType T>
+    void conjugateMultiplyAdd(SplitComplex<T> dest, SplitComplex<T> lhs, SplitComplex<T> rhs, size_t size) noexcept;
+
+    /**
+        Multiplies `lhs` by the complex conjugate of `rhs`, and adds the result to `dest` (`dest[i] += lhs[i] * conj(rhs[i])`) - the accumulate step of a cross-spectrum / cross-correlation. `dest.size()`, `lhs.size()` and `rhs.size()` <b>must</b> all be equal.
+        \param dest The destination array-like.
+        \param lhs The first source array-like.
+        \param rhs The second source array-like.
+    */
+    template <ComplexArrayLike T>
+    void conjugateMultiplyAdd(T& dest, const T& lhs, const T& rhs) noexcept {
+        assert(dest.size() == lhs.size() && dest.size() == rhs.size());
+        conjugateMultiplyAdd(dest.data(), lhs.data(), rhs.data(), dest.size());
+    }
+
+    /**
+        Computes the magnitude (`abs`) of each complex value in `src`, and stores the result in `dest`.
+        \param dest A raw pointer to the real destination array-like.
+        \param src A raw pointer to the complex source array-like.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <ComplexFloatType T>
+    void magnitude(typename T::value_type* dest, const T* src, size_t size) noexcept;
+
+    /**
+        Computes the magnitude (`abs`) of each complex value in `src`, for data in split format, and stores the result in `dest`.
+        \param dest A raw pointer to the real destination array-like.
+        \param src The complex source.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void magnitude(T* dest, SplitComplex<T> src, size_t size) noexcept;
+
+    /**
+        Computes the magnitude (`abs`) of each complex value in `src`, and stores the result in `dest`. `dest.size()` <b>must</b> == `src.size()`, and the value types must match (`float` and `std::complex<float>`, for example).
+        \param dest The real destination array-like.
+        \param src The complex source array-like.
+    */
+    template <FloatArrayLike T, ComplexArrayLike U>
+    requires std::same_as<typename T::value_type, typename U::value_type::value_type>
+    void magnitude(T& dest, const U& src) noexcept {
+        assert(dest.size() == src.size());
+        magnitude(dest.data(), src.data(), dest.size());
+    }
+
+    /**
+        Computes the squared magnitude (`norm`) of each complex value in `src`, skipping the square root `magnitude` needs, and stores the result in `dest`.
+        \param dest A raw pointer to the real destination array-like.
+        \param src A raw pointer to the complex source array-like.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <ComplexFloatType T>
+    void magnitudeSquared(typename T::value_type* dest, const T* src, size_t size) noexcept;
+
+    /**
+        Computes the squared magnitude (`norm`) of each complex value in `src`, skipping the square root `magnitude` needs, for data in split format, and stores the result in `dest`.
+        \param dest A raw pointer to the real destination array-like.
+        \param src The complex source.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void magnitudeSquared(T* dest, SplitComplex<T> src, size_t size) noexcept;
+
+    /**
+        Computes the squared magnitude (`norm`) of each complex value in `src`, skipping the square root `magnitude` needs, and stores the result in `dest`. `dest.size()` <b>must</b> == `src.size()`, and the value types must match (`float` and `std::complex<float>`, for example).
+        \param dest The real destination array-like.
+        \param src The complex source array-like.
+    */
+    template <FloatArrayLike T, ComplexArrayLike U>
+    requires std::same_as<typename T::value_type, typename U::value_type::value_type>
+    void magnitudeSquared(T& dest, const U& src) noexcept {
+        assert(dest.size() == src.size());
+        magnitudeSquared(dest.data(), src.data(), dest.size());
+    }
+
+    /**
+        Computes the phase angle (`arg`, in radians, in the range `[-pi, pi]`) of each complex value in `src`, and stores the result in `dest`.
+        \param dest A raw pointer to the real destination array-like.
+        \param src A raw pointer to the complex source array-like.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <ComplexFloatType T>
+    void phase(typename T::value_type* dest, const T* src, size_t size) noexcept;
+
+    /**
+        Computes the phase angle (`arg`, in radians, in the range `[-pi, pi]`) of each complex value in `src`, for data in split format, and stores the result in `dest`.
+        \param dest A raw pointer to the real destination array-like.
+        \param src The complex source.
+        \param size The number of elements in `dest` and `src`.
+    */
+    template <FloatType T>
+    void phase(T* dest, SplitComplex<T> src, size_t size) noexcept;
+
+    /**
+        Computes the phase angle (`arg`, in radians, in the range `[-pi, pi]`) of each complex value in `src`, and stores the result in `dest`. `dest.size()` <b>must</b> == `src.size()`, and the value types must match (`float` and `std::complex<float>`, for example).
+        \param dest The real destination array-like.
+        \param src The complex source array-like.
+    */
+    template <FloatArrayLike T, ComplexArrayLike U>
+    requires std::same_as<typename T::value_type, typename U::value_type::value_type>
+    void phase(T& dest, const U& src) noexcept {
+        assert(dest.size() == src.size());
+        phase(dest.data(), src.data(), dest.size());
+    }
+
+    /**
+        Converts from polar to cartesian form (`dest[i] = magnitudes[i] * e^(i * phases[i])`), and stores the result in `dest`.
+        \param dest A raw pointer to the complex destination array-like.
+        \param magnitudes A raw pointer to the magnitudes.
+        \param phases A raw pointer to the phases, in radians.
+        \param size The number of elements in `dest`, `magnitudes` and `phases`.
+    */
+    template <ComplexFloatType T>
+    void polarToCartesian(T* dest, const typename T::value_type* magnitudes, const typename T::value_type* phases, size_t size) noexcept;
+
+    /**
+        Converts from polar to cartesian form, and stores the result in `dest`, in split format.
+        \param dest The complex destination.
+        \param magnitudes A raw pointer to the magnitudes.
+        \param phases A raw pointer to the phases, in radians.
+        \param size The number of elements in `dest`, `magnitudes` and `phases`.
+    */
+    template <FloatType T>
+    void polarToCartesian(SplitComplex<T> dest, const T* magnitudes, const T* phases, size_t size) noexcept;
+
+    /**
+        Converts from polar to cartesian form, and stores the result in `dest`. `dest.size()`, `magnitudes.size()` and `phases.size()` <b>must</b> all be equal.
+        \param dest The complex destination array-like.
+        \param magnitudes The magnitudes.
+        \param phases The phases, in radians.
+    */
+    template <ComplexArrayLike T, FloatArrayLike U>
+    requires std::same_as<typename U::value_type, typename T::value_type::value_type>
+    void polarToCartesian(T& dest, const U& magnitudes, const U& phases) noexcept {
+        assert(dest.size() == magnitudes.size() && dest.size() == phases.size());
+        polarToCartesian(dest.data(), magnitudes.data(), phases.data(), dest.size());
+    }
+
+    /**
+        Interleaves `numChannels` planar channels into `dest` (`dest[i * numChannels + channel] = channels[channel][i]`). Stereo takes a dedicated SIMD path.
+        \param dest A raw pointer to the interleaved destination, <b>must</b> be `numChannels * numSamples` long.
+        \param channels The planar source channels, each `numSamples` long.
+        \param numChannels The number of channels.
+        \param numSamples The number of samples per channel.
+    */
+    template <FloatType T>
+    void interleave(T* dest, const T* const* channels, size_t numChannels, size_t numSamples) noexcept;
+
+    /**
+        Interleaves the channels in `src` into `dest`.
+        \param dest A raw pointer to the interleaved destination, <b>must</b> be `src.getNumChannels() * src.getNumSamples()` long.
+        \param src The planar source buffer.
+    */
+    template <FloatType T>
+    void interleave(T* dest, const containers::BufferView<T>& src) noexcept {
+        interleave(dest, src.getArrayOfReadPointers(), src.getNumChannels(), src.getNumSamples());
+    }
+
+    /**
+        Deinterleaves `src` into `numChannels` planar channels (`channels[channel][i] = src[i * numChannels + channel]`). Stereo takes a dedicated SIMD path.
+        \param channels The planar destination channels, each `numSamples` long.
+        \param src A raw pointer to the interleaved source, <b>must</b> be `numChannels * numSamples` long.
+        \param numChannels The number of channels.
+        \param numSamples The number of samples per channel.
+    */
+    template <FloatType T>
+    void deinterleave(T* const* channels, const T* src, size_t numChannels, size_t numSamples) noexcept;
+
+    /**
+        Deinterleaves `src` into the channels of `dest`.
+        \param dest The planar destination buffer.
+        \param src A raw pointer to the interleaved source, <b>must</b> be `dest.getNumChannels() * dest.getNumSamples()` long.
+    */
+    template <FloatType T>
+    void deinterleave(containers::BufferView<T> dest, const T* src) noexcept {
+        deinterleave(dest.getArrayOfWritePointers(), src, dest.getNumChannels(), dest.getNumSamples());
+    }
+
+    /**
+        Converts integer samples in `srcFormat` to floating point, in the range `[-1, 1)`.
+        \param dest A raw pointer to the destination array-like.
+        \param src A raw pointer to the source samples, <b>must</b> be `size * getBytesPerSample(srcFormat)` bytes long.
+        \param srcFormat The format of the samples in `src`.
+        \param size The number of samples to convert.
+    */
+    template <FloatType T>
+    void intToFloat(T* dest, const std::byte* src, SampleFormat srcFormat, size_t size) noexcept;
+
+    /**
+        Converts floating point samples to integer samples in `destFormat`, rounding to the nearest integer. Values outside of `[-1, 1)` are clipped.
+        \param dest A raw pointer to the destination, <b>must</b> be `size * getBytesPerSample(destFormat)` bytes long.
+        \param destFormat The format to write to `dest`.
+        \param src A raw pointer to the source array-like.
+        \param size The number of samples to convert.
+    */
+    template <FloatType T>
+    void floatToInt(std::byte* dest, SampleFormat destFormat, const T* src, size_t size) noexcept;
+
+    /**
+        Converts floating point samples to integer samples in `destFormat`, adding triangular dither of +/- 1 LSB before rounding. Values outside of `[-1, 1)` are clipped.
+        \param dest A raw pointer to the destination, <b>must</b> be `size * getBytesPerSample(destFormat)` bytes long.
+        \param destFormat The format to write to `dest`.
+        \param src A raw pointer to the source array-like.
+        \param size The number of samples to convert.
+        \param dither The dither source to use.
+    */
+    template <FloatType T>
+    void floatToInt(std::byte* dest, SampleFormat destFormat, const T* src, size_t size, TriangularDither& dither) noexcept;
+
+    /**
+        Deinterleaves and converts interleaved integer samples into planar floating point channels, in a single pass.
+        \param channels The planar destination channels, each `numSamples` long.
+        \param src A raw pointer to the interleaved source, <b>must</b> be `numChannels * numSamples * getBytesPerSample(srcFormat)` bytes long.
+        \param srcFormat The format of the samples in `src`.
+        \param numChannels The number of channels.
+        \param numSamples The number of samples per channel.
+    */
+    template <FloatType T>
+    void deinterleave(T* const* channels, const std::byte* src, SampleFormat srcFormat, size_t numChannels, size_t numSamples) noexcept;
+
+    /**
+        Deinterleaves and converts interleaved integer samples into the channels of `dest`, in a single pass.
+        \param dest The planar destination buffer.
+        \param src A raw pointer to the interleaved source, <b>must</b> be `dest.getNumChannels() * dest.getNumSamples() * getBytesPerSample(srcFormat)` bytes long.
+        \param srcFormat The format of the samples in `src`.
+    */
+    template <FloatType T>
+    void deinterleave(containers::BufferView<T> dest, const std::byte* src, SampleFormat srcFormat) noexcept {
+        deinterleave(dest.getArrayOfWritePointers(), src, srcFormat, dest.getNumChannels(), dest.getNumSamples());
+    }
+
+    /**
+        Converts and interleaves planar floating point channels into integer samples in `destFormat`, in a single pass. Values outside of `[-1, 1)` are clipped.
+        \param dest A raw pointer to the interleaved destination, <b>must</b> be `numChannels * numSamples * getBytesPerSample(destFormat)` bytes long.
+        \param destFormat The format to write to `dest`.
+        \param channels The planar source channels, each `numSamples` long.
+        \param numChannels The number of channels.
+        \param numSamples The number of samples per channel.
+    */
+    template <FloatType T>
+    void interleave(std::byte* dest, SampleFormat destFormat, const T* const* channels, size_t numChannels, size_t numSamples) noexcept;
+
+    /**
+        Converts and interleaves planar floating point channels into integer samples in `destFormat`, with triangular dither, in a single pass.
+        \param dest A raw pointer to the interleaved destination, <b>must</b> be `numChannels * numSamples * getBytesPerSample(destFormat)` bytes long.
+        \param destFormat The format to write to `dest`.
+        \param channels The planar source channels, each `numSamples` long.
+        \param numChannels The number of channels.
+        \param numSamples The number of samples per channel.
+        \param dither The dither source to use.
+    */
+    template <FloatType T>
+    void interleave(std::byte* dest, SampleFormat destFormat, const T* const* channels, size_t numChannels, size_t numSamples, TriangularDither& dither) noexcept;
+
+    /**
+        Converts and interleaves the channels of `src` into integer samples in `destFormat`, in a single pass.
+        \param dest A raw pointer to the interleaved destination, <b>must</b> be `src.getNumChannels() * src.getNumSamples() * getBytesPerSample(destFormat)` bytes long.
+        \param destFormat The format to write to `dest`.
+        \param src The planar source buffer.
+    */
+    template <FloatType T>
+    void interleave(std::byte* dest, SampleFormat destFormat, const containers::BufferView<T>& src) noexcept {
+        interleave(dest, destFormat, src.getArrayOfReadPointers(), src.getNumChannels(), src.getNumSamples());
+    }
+
+    /**
+        Converts and interleaves the channels of `src` into integer samples in `destFormat`, with triangular dither, in a single pass.
+        \param dest A raw pointer to the interleaved destination, <b>must</b> be `src.getNumChannels() * src.getNumSamples() * getBytesPerSample(destFormat)` bytes long.
+        \param destFormat The format to write to `dest`.
+        \param src The planar source buffer.
+        \param dither The dither source to use.
+    */
+    template <FloatType T>
+    void interleave(std::byte* dest, SampleFormat destFormat, const containers::BufferView<T>& src, TriangularDither& dither) noexcept {
+        interleave(dest, destFormat, src.getArrayOfReadPointers(), src.getNumChannels(), src.getNumSamples(), dither);
+    }
+
     /**
         Copies the contents of rhs into lhs.
         \param lhs A raw pointer to the destination array-like.
@@ -15,6 +15,7 @@
 #include <marvin/library/marvin_Literals.h>
 #include <numbers>
 #include <cmath>
+#include <span>
 namespace marvin::math::windows {
 
     /**
@@ -177,5 +178,27 @@ namespace marvin::math::windows {
         constexpr static auto alpha = static_cast<SampleType>(25.0 / 46.0);
         return cosineSum(n, N, alpha);
     }
+
+    /**
+        Fills `dest` with the periodic form of a window (the first `dest.size()` points of a `dest.size() + 1` point window), which overlap-adds evenly - for use in STFT based processing.
+        \param windowType The window function to use. Tukey and CosineSum windows use an alpha of 0.5.
+        \param dest The array-like to fill.
+    */
+    template <FloatType SampleType>
+    void fillPeriodic(WindowType windowType, std::span<SampleType> dest) {
+        const auto numPoints = static_cast<SampleType>(dest.size() + 1);
+        constexpr static auto alpha = static_cast<SampleType>(0.5);
+        for (auto i = 0_sz; i < dest.size(); ++i) {
+            const auto n = static_cast<SampleType>(i);
+            switch (windowType) {
+                case WindowType::Sine: dest[i] = sine(n, numPoints); break;
+                case WindowType::Tukey: dest[i] = tukey(n, numPoints, alpha); break;
+                case WindowType::BlackmanHarris: dest[i] = blackmanHarris(n, numPoints); break;
+                case WindowType::CosineSum: dest[i] = cosineSum(n, numPoints, alpha); break;
+                case WindowType::Hann: dest[i] = hann(n, numPoints); break;
+                case WindowType::Hamming: dest[i] = hamming(n, numPoints); break;
+            }
+        }
+    }
 } // namespace marvin::math::windows
 #endif
\ No newline at end of file
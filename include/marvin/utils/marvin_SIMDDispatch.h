@@ -0,0 +1,37 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_SIMDDISPATCH_H
+#define MARVIN_SIMDDISPATCH_H
+namespace marvin::utils {
+    /**
+        \brief Enum for the instruction sets marvin's SIMD kernels can be bound to.
+
+        Useful for verifying that the kernels being used are what you expect them to be.
+    */
+    enum class InstructionSet {
+        Other,
+        SSE2,
+        AVX2,
+        AVX512,
+        NEON
+    };
+
+    /**
+        Retrieves the instruction set marvin's runtime-dispatched kernels (`math::vecops`' xsimd fallback, and `dsp::filters::SIMDBiquad`) are bound to.<br>
+        The CPU is queried once, on the first call, and the widest instruction set that is both supported by the CPU and compiled into marvin is chosen.
+        AVX2 and AVX-512 kernels are only compiled in on x86-64, when configured with `MARVIN_RUNTIME_DISPATCH=ON` (the default). AVX-512 needs AVX-512F
+        (plus FMA), or on MSVC, which can only build the kernels for `/arch:AVX512`, AVX-512F, BW, DQ and VL.
+        Otherwise, this will be whatever instruction set marvin itself was compiled for (SSE2 on a default x86-64 build, NEON on arm64).
+        \return The instruction set currently in use.
+    */
+    [[nodiscard]] InstructionSet getInstructionSet() noexcept;
+} // namespace marvin::utils
+#endif
@@ -12,40 +12,41 @@
 #include "marvin/containers/marvin_BufferView.h"
 #include "marvin/library/marvin_Concepts.h"
 #include <cassert>
+#include <complex>
 namespace marvin::containers {
-    template <FloatType SampleType>
+    template <RealOrComplexFloatType SampleType>
     BufferView<SampleType>::BufferView(SampleType* const* samples, size_t nChannels, size_t nSamples) : m_samples(samples),
                                                                                                         m_nChannels(nChannels),
                                                                                                         m_nSamples(nSamples) {
     }
 
-    template <FloatType SampleType>
+    template <RealOrComplexFloatType SampleType>
     size_t BufferView<SampleType>::getNumChannels() const noexcept {
         return m_nChannels;
     }
 
-    template <FloatType SampleType>
+    template <RealOrComplexFloatType SampleType>
     size_t BufferView<SampleType>::getNumSamples() const noexcept {
         return m_nSamples;
     }
 
-    template <FloatType SampleType>
+    template <RealOrComplexFloatType SampleType>
     const SampleType* const* BufferView<SampleType>::getArrayOfReadPointers() const noexcept {
         return m_samples;
     }
 
-    template <FloatType SampleType>
+    template <RealOrComplexFloatType SampleType>
     SampleType* const* BufferView<SampleType>::getArrayOfWritePointers() noexcept {
         return m_samples;
     }
 
-    template <FloatType SampleType>
+    template <RealOrComplexFloatType SampleType>
     std::span<SampleType> BufferView<SampleType>::operator[](size_t channel) noexcept {
         assert(channel <= m_nChannels);
         return { m_samples[channel], m_nSamples };
     }
 
-    template <FloatType SampleType>
+    template <RealOrComplexFloatType SampleType>
     std::span<const SampleType> BufferView<SampleType>::operator[](size_t channel) const noexcept {
         assert(channel <= m_nChannels);
         return { m_samples[channel], m_nSamples };
@@ -53,4 +54,6 @@ namespace marvin::containers {
 
     template struct BufferView<float>;
     template struct BufferView<double>;
+    template struct BufferView<std::complex<float>>;
+    template struct BufferView<std::complex<double>>;
 } // namespace marvin::containers
\ No newline at end of file
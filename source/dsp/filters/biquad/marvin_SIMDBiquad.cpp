@@ -1,4 +1,32 @@
 //
 // Created by Syl Morrison on 10/05/2025.
 //
-#include <marvin/dsp/filters/biquad/marvin_SIMDBiquad.h>
\ No newline at end of file
+#include <marvin/dsp/filters/biquad/marvin_SIMDBiquad.h>
+#include "dsp/filters/biquad/marvin_SIMDBiquadKernels.h"
+
+namespace marvin::dsp::filters::detail {
+    template <FloatType SampleType>
+    void processSIMDBiquads(SIMDBiquadView<SampleType> view, SampleType* x, size_t numFilters) noexcept {
+        static const auto kernel = utils::simd::dispatch([]<class Arch>() { return kernels::getSIMDBiquadKernel<Arch, SampleType>(); });
+        kernel(view, x, numFilters);
+    }
+
+    template <FloatType SampleType>
+    void processSIMDBiquadsBlock(SIMDBiquadView<SampleType> view, SampleType* const* channels, size_t numFilters, size_t numSamples) noexcept {
+        static const auto kernel = utils::simd::dispatch([]<class Arch>() { return kernels::getSIMDBiquadBlockKernel<Arch, SampleType>(); });
+        kernel(view, channels, numFilters, numSamples);
+    }
+
+    template <FloatType SampleType>
+    size_t getSIMDBiquadNumVectorised(size_t lanes, size_t numFilters) noexcept {
+        static const auto query = utils::simd::dispatch([]<class Arch>() { return kernels::getSIMDBiquadNumVectorisedQuery<Arch, SampleType>(); });
+        return query(lanes, numFilters);
+    }
+
+    template void processSIMDBiquads<float>(SIMDBiquadView<float>, float*, size_t) noexcept;
+    template void processSIMDBiquads<double>(SIMDBiquadView<double>, double*, size_t) noexcept;
+    template void processSIMDBiquadsBlock<float>(SIMDBiquadView<float>, float* const*, size_t, size_t) noexcept;
+    template void processSIMDBiquadsBlock<double>(SIMDBiquadView<double>, double* const*, size_t, size_t) noexcept;
+    template size_t getSIMDBiquadNumVectorised<float>(size_t, size_t) noexcept;
+    template size_t getSIMDBiquadNumVectorised<double>(size_t, size_t) noexcept;
+} // namespace marvin::dsp::filters::detail
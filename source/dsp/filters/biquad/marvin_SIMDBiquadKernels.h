@@ -0,0 +1,262 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_SIMDBIQUADKERNELS_H
+#define MARVIN_SIMDBIQUADKERNELS_H
+#include "marvin/dsp/filters/biquad/marvin_SIMDBiquad.h"
+#include "marvin/library/marvin_Literals.h"
+#include "utils/marvin_SIMDDispatchImpl.h"
+#include <xsimd/xsimd.hpp>
+#include <type_traits>
+namespace marvin::dsp::filters::kernels {
+    /*
+        The address of filter `filter`'s value for `field` - see `detail::SIMDBiquadView` for the layout. Templated on the arch like the kernels, so the AVX
+        builds' copies can't stand in for the baseline one.
+    */
+    template <class Arch, FloatType SampleType>
+    [[nodiscard]] SampleType* getField(detail::SIMDBiquadView<SampleType> view, typename detail::SIMDBiquadView<SampleType>::Field field, size_t filter) noexcept {
+        return view.data + (filter / view.lanes * detail::SIMDBiquadView<SampleType>::NumFields + field) * view.lanes + filter % view.lanes;
+    }
+
+    /*
+        Hands the filters to `fn` a run of whole batches at a time, widest arch first - `fn(std::type_identity<BatchArch>{}, begin, end)` for `BatchArch` and each
+        arch narrower than it (see `utils::simd::NarrowerArch`) whose batches fit within a block of `lanes` filters, with each run starting where the last left off.
+        So a bank that doesn't fill a whole number of the widest batches still goes through the narrower ones (eg 12 floats on AVX-512 as 8 + 4) rather than
+        falling straight back to scalar. Blocks and batches are both powers of two wide, and each run starts on a multiple of its batch width, so no batch straddles
+        two blocks. Returns the number of filters handed to `fn` - the ones left over are for the caller to run one at a time.
+    */
+    template <class Arch, FloatType SampleType, class BatchArch, typename Fn>
+    size_t forEachBatchArch(size_t lanes, size_t begin, size_t numFilters, Fn& fn) noexcept {
+        if constexpr (std::is_void_v<BatchArch>) {
+            return begin;
+        } else {
+            constexpr static auto simdSize = xsimd::batch<SampleType, BatchArch>::size;
+            if (lanes >= simdSize) {
+                const auto end = begin + (numFilters - begin) / simdSize * simdSize;
+                if (end != begin) {
+                    fn(std::type_identity<BatchArch>{}, begin, end);
+                }
+                begin = end;
+            }
+            return forEachBatchArch<Arch, SampleType, typename utils::simd::NarrowerArch<BatchArch>::type>(lanes, begin, numFilters, fn);
+        }
+    }
+
+    /*
+        The vector part of `processSIMDBiquads`, filters `begin` to `end` a batch of `BatchArch` at a time. Each batch lies within a single block of the view, so its
+        coefficients and state are contiguous and aligned.
+    */
+    template <class Arch, class BatchArch, FloatType SampleType>
+    void processSIMDBiquadBatches(detail::SIMDBiquadView<SampleType> view, SampleType* x, size_t begin, size_t end) noexcept {
+        using View = detail::SIMDBiquadView<SampleType>;
+        using BatchType = xsimd::batch<SampleType, BatchArch>;
+        constexpr static auto simdSize = BatchType::size;
+        for (auto i = begin; i < end; i += simdSize) {
+            const auto x0 = BatchType::load_unaligned(x + i);
+            const auto x1 = BatchType::load_aligned(getField<Arch>(view, View::X1, i));
+            const auto x2 = BatchType::load_aligned(getField<Arch>(view, View::X2, i));
+            const auto y1 = BatchType::load_aligned(getField<Arch>(view, View::Y1, i));
+            const auto y2 = BatchType::load_aligned(getField<Arch>(view, View::Y2, i));
+            auto res = BatchType::load_aligned(getField<Arch>(view, View::A0, i)) * x0;
+            res = xsimd::fma(BatchType::load_aligned(getField<Arch>(view, View::A1, i)), x1, res);
+            res = xsimd::fma(BatchType::load_aligned(getField<Arch>(view, View::A2, i)), x2, res);
+            res = xsimd::fnma(BatchType::load_aligned(getField<Arch>(view, View::B1, i)), y1, res);
+            res = xsimd::fnma(BatchType::load_aligned(getField<Arch>(view, View::B2, i)), y2, res);
+            x1.store_aligned(getField<Arch>(view, View::X2, i));
+            x0.store_aligned(getField<Arch>(view, View::X1, i));
+            y1.store_aligned(getField<Arch>(view, View::Y2, i));
+            res.store_aligned(getField<Arch>(view, View::Y1, i));
+            res.store_unaligned(x + i);
+        }
+    }
+
+    /*
+        Runs one sample through `numFilters` parallel biquads. Filters that don't fill one of `Arch`'s batches (eg 4 of a bank of 12 floats on AVX2) go through a
+        narrower arch's batches rather than falling back to scalar - see `forEachBatchArch`. `x` is a caller-owned span and may be unaligned.
+    */
+    template <class Arch, FloatType SampleType>
+    void processSIMDBiquads(detail::SIMDBiquadView<SampleType> view, SampleType* x, size_t numFilters) noexcept {
+        using View = detail::SIMDBiquadView<SampleType>;
+        auto processBatches = [&]<class BatchArch>(std::type_identity<BatchArch>, size_t begin, size_t end) { processSIMDBiquadBatches<Arch, BatchArch>(view, x, begin, end); };
+        const auto vecSize = forEachBatchArch<Arch, SampleType, Arch>(view.lanes, 0, numFilters, processBatches);
+        for (auto i = vecSize; i < numFilters; ++i) {
+            auto& x1 = *getField<Arch>(view, View::X1, i);
+            auto& x2 = *getField<Arch>(view, View::X2, i);
+            auto& y1 = *getField<Arch>(view, View::Y1, i);
+            auto& y2 = *getField<Arch>(view, View::Y2, i);
+            const auto res = (*getField<Arch>(view, View::A0, i) * x[i]) + (*getField<Arch>(view, View::A1, i) * x1) + (*getField<Arch>(view, View::A2, i) * x2) - (*getField<Arch>(view, View::B1, i) * y1) - (*getField<Arch>(view, View::B2, i) * y2);
+            x2 = x1;
+            x1 = x[i];
+            y2 = y1;
+            y1 = res;
+            x[i] = res;
+        }
+    }
+
+    /*
+        The vector part of `processSIMDBiquadsBlock`, filters `begin` to `end` a batch of `BatchArch` at a time. Each group of lanes keeps its coefficients and state in registers for the
+        whole block, and only writes the state back at the end. The channels are separate arrays, so the input is read a tile at a time - `simdSize` samples from
+        each of the group's channels, one batch per channel, transposed in registers so that each batch holds one sample from every channel. The recurrence runs
+        over the tile's batches, and they're transposed back and stored the same way, so no sample goes through memory a lane at a time. The final partial tile
+        is staged through a zeroed aligned buffer.
+    */
+    template <class Arch, class BatchArch, FloatType SampleType>
+    void processSIMDBiquadBlockBatches(detail::SIMDBiquadView<SampleType> view, SampleType* const* channels, size_t begin, size_t end, size_t numSamples) noexcept {
+        using View = detail::SIMDBiquadView<SampleType>;
+        using BatchType = xsimd::batch<SampleType, BatchArch>;
+        constexpr static auto simdSize = BatchType::size;
+        const auto tiledSamples = numSamples - numSamples % simdSize;
+        const auto remaining = numSamples - tiledSamples;
+        BatchType tile[simdSize];
+        for (auto i = begin; i < end; i += simdSize) {
+            const auto a0 = BatchType::load_aligned(getField<Arch>(view, View::A0, i));
+            const auto a1 = BatchType::load_aligned(getField<Arch>(view, View::A1, i));
+            const auto a2 = BatchType::load_aligned(getField<Arch>(view, View::A2, i));
+            const auto b1 = BatchType::load_aligned(getField<Arch>(view, View::B1, i));
+            const auto b2 = BatchType::load_aligned(getField<Arch>(view, View::B2, i));
+            auto x1 = BatchType::load_aligned(getField<Arch>(view, View::X1, i));
+            auto x2 = BatchType::load_aligned(getField<Arch>(view, View::X2, i));
+            auto y1 = BatchType::load_aligned(getField<Arch>(view, View::Y1, i));
+            auto y2 = BatchType::load_aligned(getField<Arch>(view, View::Y2, i));
+            SampleType* const* groupChannels = channels + i;
+            const auto processTile = [&](size_t count) {
+                xsimd::transpose(tile, tile + simdSize);
+                for (auto sample = 0_sz; sample < count; ++sample) {
+                    const auto x0 = tile[sample];
+                    auto res = a0 * x0;
+                    res = xsimd::fma(a1, x1, res);
+                    res = xsimd::fma(a2, x2, res);
+                    res = xsimd::fnma(b1, y1, res);
+                    res = xsimd::fnma(b2, y2, res);
+                    x2 = x1;
+                    x1 = x0;
+                    y2 = y1;
+                    y1 = res;
+                    tile[sample] = res;
+                }
+                xsimd::transpose(tile, tile + simdSize);
+            };
+            for (auto sample = 0_sz; sample < tiledSamples; sample += simdSize) {
+                for (auto lane = 0_sz; lane < simdSize; ++lane) {
+                    tile[lane] = BatchType::load_unaligned(groupChannels[lane] + sample);
+                }
+                processTile(simdSize);
+                for (auto lane = 0_sz; lane < simdSize; ++lane) {
+                    tile[lane].store_unaligned(groupChannels[lane] + sample);
+                }
+            }
+            if (remaining != 0) {
+                alignas(detail::SIMDBiquadAlignment) SampleType staging[simdSize * simdSize];
+                for (auto j = 0_sz; j < simdSize * simdSize; ++j) {
+                    staging[j] = static_cast<SampleType>(0.0);
+                }
+                for (auto lane = 0_sz; lane < simdSize; ++lane) {
+                    for (auto sample = 0_sz; sample < remaining; ++sample) {
+                        staging[lane * simdSize + sample] = groupChannels[lane][tiledSamples + sample];
+                    }
+                    tile[lane] = BatchType::load_aligned(staging + lane * simdSize);
+                }
+                processTile(remaining);
+                for (auto lane = 0_sz; lane < simdSize; ++lane) {
+                    tile[lane].store_aligned(staging + lane * simdSize);
+                    for (auto sample = 0_sz; sample < remaining; ++sample) {
+                        groupChannels[lane][tiledSamples + sample] = staging[lane * simdSize + sample];
+                    }
+                }
+            }
+            x1.store_aligned(getField<Arch>(view, View::X1, i));
+            x2.store_aligned(getField<Arch>(view, View::X2, i));
+            y1.store_aligned(getField<Arch>(view, View::Y1, i));
+            y2.store_aligned(getField<Arch>(view, View::Y2, i));
+        }
+    }
+
+    /*
+        Runs `numSamples` samples through `numFilters` parallel biquads, with `channels[i]` (in place) through filter i. Picks its batch arch the same way as
+        `processSIMDBiquads`, and runs any filters left over one at a time.
+    */
+    template <class Arch, FloatType SampleType>
+    void processSIMDBiquadsBlock(detail::SIMDBiquadView<SampleType> view, SampleType* const* channels, size_t numFilters, size_t numSamples) noexcept {
+        using View = detail::SIMDBiquadView<SampleType>;
+        auto processBatches = [&]<class BatchArch>(std::type_identity<BatchArch>, size_t begin, size_t end) {
+            processSIMDBiquadBlockBatches<Arch, BatchArch>(view, channels, begin, end, numSamples);
+        };
+        const auto vecSize = forEachBatchArch<Arch, SampleType, Arch>(view.lanes, 0, numFilters, processBatches);
+        for (auto i = vecSize; i < numFilters; ++i) {
+            const auto a0 = *getField<Arch>(view, View::A0, i), a1 = *getField<Arch>(view, View::A1, i), a2 = *getField<Arch>(view, View::A2, i), b1 = *getField<Arch>(view, View::B1, i), b2 = *getField<Arch>(view, View::B2, i);
+            auto x1 = *getField<Arch>(view, View::X1, i), x2 = *getField<Arch>(view, View::X2, i), y1 = *getField<Arch>(view, View::Y1, i), y2 = *getField<Arch>(view, View::Y2, i);
+            auto* channel = channels[i];
+            for (auto sample = 0_sz; sample < numSamples; ++sample) {
+                const auto x0 = channel[sample];
+                const auto res = (a0 * x0) + (a1 * x1) + (a2 * x2) - (b1 * y1) - (b2 * y2);
+                x2 = x1;
+                x1 = x0;
+                y2 = y1;
+                y1 = res;
+                channel[sample] = res;
+            }
+            *getField<Arch>(view, View::X1, i) = x1;
+            *getField<Arch>(view, View::X2, i) = x2;
+            *getField<Arch>(view, View::Y1, i) = y1;
+            *getField<Arch>(view, View::Y2, i) = y2;
+        }
+    }
+
+    /*
+        The number of filters out of a bank of `numFilters`, stored in blocks of `lanes` filters, that the kernels process in batches rather than one at a time.
+    */
+    template <class Arch, FloatType SampleType>
+    [[nodiscard]] size_t getSIMDBiquadNumVectorised(size_t lanes, size_t numFilters) noexcept {
+        auto ignore = []<class BatchArch>(std::type_identity<BatchArch>, size_t, size_t) {};
+        return forEachBatchArch<Arch, SampleType, Arch>(lanes, 0, numFilters, ignore);
+    }
+
+    template <FloatType SampleType>
+    using SIMDBiquadKernel = void (*)(detail::SIMDBiquadView<SampleType>, SampleType*, size_t) noexcept;
+
+    template <FloatType SampleType>
+    using SIMDBiquadBlockKernel = void (*)(detail::SIMDBiquadView<SampleType>, SampleType* const*, size_t, size_t) noexcept;
+
+    template <class Arch, FloatType SampleType>
+    [[nodiscard]] SIMDBiquadKernel<SampleType> getSIMDBiquadKernel() noexcept {
+        return &processSIMDBiquads<Arch, SampleType>;
+    }
+
+    template <class Arch, FloatType SampleType>
+    [[nodiscard]] SIMDBiquadBlockKernel<SampleType> getSIMDBiquadBlockKernel() noexcept {
+        return &processSIMDBiquadsBlock<Arch, SampleType>;
+    }
+
+    template <FloatType SampleType>
+    using SIMDBiquadNumVectorisedQuery = size_t (*)(size_t, size_t) noexcept;
+
+    template <class Arch, FloatType SampleType>
+    [[nodiscard]] SIMDBiquadNumVectorisedQuery<SampleType> getSIMDBiquadNumVectorisedQuery() noexcept {
+        return &getSIMDBiquadNumVectorised<Arch, SampleType>;
+    }
+
+#if defined(MARVIN_HAS_AVX2_KERNELS)
+    extern template SIMDBiquadKernel<float> getSIMDBiquadKernel<utils::simd::AVX2Arch, float>() noexcept;
+    extern template SIMDBiquadKernel<double> getSIMDBiquadKernel<utils::simd::AVX2Arch, double>() noexcept;
+    extern template SIMDBiquadBlockKernel<float> getSIMDBiquadBlockKernel<utils::simd::AVX2Arch, float>() noexcept;
+    extern template SIMDBiquadBlockKernel<double> getSIMDBiquadBlockKernel<utils::simd::AVX2Arch, double>() noexcept;
+    extern template SIMDBiquadNumVectorisedQuery<float> getSIMDBiquadNumVectorisedQuery<utils::simd::AVX2Arch, float>() noexcept;
+    extern template SIMDBiquadNumVectorisedQuery<double> getSIMDBiquadNumVectorisedQuery<utils::simd::AVX2Arch, double>() noexcept;
+#endif
+#if defined(MARVIN_HAS_AVX512_KERNELS)
+    extern template SIMDBiquadKernel<float> getSIMDBiquadKernel<utils::simd::AVX512Arch, float>() noexcept;
+    extern template SIMDBiquadKernel<double> getSIMDBiquadKernel<utils::simd::AVX512Arch, double>() noexcept;
+    extern template SIMDBiquadBlockKernel<float> getSIMDBiquadBlockKernel<utils::simd::AVX512Arch, float>() noexcept;
+    extern template SIMDBiquadBlockKernel<double> getSIMDBiquadBlockKernel<utils::simd::AVX512Arch, double>() noexcept;
+    extern template SIMDBiquadNumVectorisedQuery<float> getSIMDBiquadNumVectorisedQuery<utils::simd::AVX512Arch, float>() noexcept;
+    extern template SIMDBiquadNumVectorisedQuery<double> getSIMDBiquadNumVectorisedQuery<utils::simd::AVX512Arch, double>() noexcept;
+#endif
+} // namespace marvin::dsp::filters::kernels
+#endif
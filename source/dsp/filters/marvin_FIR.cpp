@@ -0,0 +1,158 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include "marvin/dsp/filters/marvin_FIR.h"
+#include "marvin/library/marvin_Literals.h"
+#include "marvin/math/marvin_VecOps.h"
+#include "dsp/filters/marvin_FIRKernels.h"
+#include <algorithm>
+#include <cassert>
+
+namespace marvin::dsp::filters {
+    /*
+        The history is a linear buffer of `numTaps - 1` samples of context followed by room for at least `s_minBlockSize` new ones - when it fills up, the context is
+        moved back to the start. Each output's window is contiguous, and so is a whole block's.
+    */
+    constexpr static auto s_minBlockSize = 64_sz;
+
+    template <FloatType SampleType>
+    void FIR<SampleType>::setCoefficients(std::span<const SampleType> coefficients) {
+        assert(!coefficients.empty());
+        const auto resized = coefficients.size() != m_reversedCoefficients.size();
+        m_reversedCoefficients.resize(coefficients.size());
+        std::reverse_copy(coefficients.begin(), coefficients.end(), m_reversedCoefficients.begin());
+        if (resized) {
+            m_history.resize(coefficients.size() - 1 + std::max<size_t>(coefficients.size(), s_minBlockSize));
+            reset();
+        }
+    }
+
+    template <FloatType SampleType>
+    void FIR<SampleType>::reset() noexcept {
+        std::fill(m_history.begin(), m_history.end(), static_cast<SampleType>(0.0));
+        m_position = m_reversedCoefficients.size() - 1;
+    }
+
+    template <FloatType SampleType>
+    SampleType FIR<SampleType>::operator()(SampleType x) noexcept {
+        const auto numTaps = m_reversedCoefficients.size();
+        if (m_position == m_history.size()) {
+            shiftHistory();
+        }
+        m_history[m_position] = x;
+        ++m_position;
+        return math::vecops::dot(m_history.data() + m_position - numTaps, m_reversedCoefficients.data(), numTaps);
+    }
+
+    /*
+        Copies as much of `source` into the history as fits, and runs the block kernel over it - one dispatch, and one contiguous history, per chunk. The chunk is
+        copied in before anything is written to `dest`, so in-place processing is fine.
+    */
+    template <FloatType SampleType>
+    void FIR<SampleType>::process(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+        static const auto kernel = utils::simd::dispatch([]<class Arch>() { return kernels::getFIRBlockKernel<Arch, SampleType>(); });
+        assert(source.size() == dest.size());
+        const auto numTaps = m_reversedCoefficients.size();
+        for (auto offset = 0_sz; offset < source.size();) {
+            if (m_position == m_history.size()) {
+                shiftHistory();
+            }
+            const auto count = std::min<size_t>(source.size() - offset, m_history.size() - m_position);
+            std::copy_n(source.begin() + static_cast<std::ptrdiff_t>(offset), count, m_history.begin() + static_cast<std::ptrdiff_t>(m_position));
+            kernel(m_reversedCoefficients.data(), m_history.data() + m_position + 1 - numTaps, dest.data() + offset, numTaps, count);
+            m_position += count;
+            offset += count;
+        }
+    }
+
+    template <FloatType SampleType>
+    size_t FIR<SampleType>::getNumTaps() const noexcept {
+        return m_reversedCoefficients.size();
+    }
+
+    template <FloatType SampleType>
+    void FIR<SampleType>::shiftHistory() noexcept {
+        const auto context = static_cast<std::ptrdiff_t>(m_reversedCoefficients.size() - 1);
+        std::copy(m_history.end() - context, m_history.end(), m_history.begin());
+        m_position = static_cast<size_t>(context);
+    }
+
+    template <FloatType SampleType>
+    void MultichannelFIR<SampleType>::initialise(size_t numChannels, std::span<const SampleType> coefficients) {
+        assert(numChannels != 0);
+        assert(!coefficients.empty());
+        m_numChannels = numChannels;
+        m_reversedCoefficients.resize(coefficients.size());
+        std::reverse_copy(coefficients.begin(), coefficients.end(), m_reversedCoefficients.begin());
+        m_history.resize(coefficients.size() * numChannels * 2);
+        m_frame.resize(numChannels);
+        reset();
+    }
+
+    template <FloatType SampleType>
+    void MultichannelFIR<SampleType>::reset() noexcept {
+        std::fill(m_history.begin(), m_history.end(), static_cast<SampleType>(0.0));
+        m_position = 0;
+    }
+
+    template <FloatType SampleType>
+    void MultichannelFIR<SampleType>::operator()(std::span<SampleType> frame) noexcept {
+        assert(frame.size() == m_numChannels);
+        std::copy(frame.begin(), frame.end(), m_frame.begin());
+        pushFrame();
+        std::copy(m_frame.begin(), m_frame.end(), frame.begin());
+    }
+
+    template <FloatType SampleType>
+    void MultichannelFIR<SampleType>::process(containers::BufferView<SampleType> source, containers::BufferView<SampleType> dest) noexcept {
+        assert(source.getNumChannels() == m_numChannels);
+        assert(dest.getNumChannels() == m_numChannels);
+        assert(source.getNumSamples() == dest.getNumSamples());
+        const auto* const* sourceChannels = source.getArrayOfReadPointers();
+        auto* const* destChannels = dest.getArrayOfWritePointers();
+        for (auto sample = 0_sz; sample < source.getNumSamples(); ++sample) {
+            for (auto channel = 0_sz; channel < m_numChannels; ++channel) {
+                m_frame[channel] = sourceChannels[channel][sample];
+            }
+            pushFrame();
+            for (auto channel = 0_sz; channel < m_numChannels; ++channel) {
+                destChannels[channel][sample] = m_frame[channel];
+            }
+        }
+    }
+
+    template <FloatType SampleType>
+    size_t MultichannelFIR<SampleType>::getNumChannels() const noexcept {
+        return m_numChannels;
+    }
+
+    template <FloatType SampleType>
+    size_t MultichannelFIR<SampleType>::getNumTaps() const noexcept {
+        return m_reversedCoefficients.size();
+    }
+
+    /*
+        Writes `m_frame` into both copies of the (interleaved) history, and replaces it with the filtered frame - so the `numTaps` most recent frames are always contiguous.
+    */
+    template <FloatType SampleType>
+    void MultichannelFIR<SampleType>::pushFrame() noexcept {
+        static const auto kernel = utils::simd::dispatch([]<class Arch>() { return kernels::getFIRFrameKernel<Arch, SampleType>(); });
+        const auto numTaps = m_reversedCoefficients.size();
+        m_position = m_position + 1 == numTaps ? 0 : m_position + 1;
+        std::copy(m_frame.begin(), m_frame.end(), m_history.begin() + static_cast<std::ptrdiff_t>(m_position * m_numChannels));
+        std::copy(m_frame.begin(), m_frame.end(), m_history.begin() + static_cast<std::ptrdiff_t>((m_position + numTaps) * m_numChannels));
+        kernel(m_reversedCoefficients.data(), m_history.data() + (m_position + 1) * m_numChannels, m_frame.data(), numTaps, m_numChannels);
+    }
+
+    template class FIR<float>;
+    template class FIR<double>;
+    template class MultichannelFIR<float>;
+    template class MultichannelFIR<double>;
+} // namespace marvin::dsp::filters
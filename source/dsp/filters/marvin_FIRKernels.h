@@ -0,0 +1,115 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_FIRKERNELS_H
+#define MARVIN_FIRKERNELS_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/library/marvin_Literals.h"
+#include "utils/marvin_SIMDDispatchImpl.h"
+#include <xsimd/xsimd.hpp>
+#include <type_traits>
+namespace marvin::dsp::filters::kernels {
+    /*
+        Computes `numSamples` outputs of a single channel FIR. `history` points at the oldest of the `numTaps` samples the first output's taps apply to, and is contiguous
+        over the whole block, so output `n` is the dot product of `[history + n, history + n + numTaps)` with `reversedCoefficients`. Outputs are computed `tileSize`
+        at a time, so each batch of coefficients is loaded once per tile rather than once per output, and the horizontal sums are independent.
+    */
+    template <class Arch, FloatType SampleType>
+    void processFIRBlock(const SampleType* reversedCoefficients, const SampleType* history, SampleType* dest, size_t numTaps, size_t numSamples) noexcept {
+        using BatchType = xsimd::batch<SampleType, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        constexpr static auto tileSize = 4_sz;
+        const auto vecTaps = numTaps - numTaps % simdSize;
+        auto processTile = [&]<size_t TileSize>(std::integral_constant<size_t, TileSize>, size_t sample) {
+            BatchType acc[TileSize];
+            for (auto k = 0_sz; k < TileSize; ++k) {
+                acc[k] = BatchType(static_cast<SampleType>(0.0));
+            }
+            const auto* window = history + sample;
+            for (auto tap = 0_sz; tap < vecTaps; tap += simdSize) {
+                const auto coeffs = BatchType::load_unaligned(reversedCoefficients + tap);
+                for (auto k = 0_sz; k < TileSize; ++k) {
+                    acc[k] = xsimd::fma(coeffs, BatchType::load_unaligned(window + k + tap), acc[k]);
+                }
+            }
+            for (auto k = 0_sz; k < TileSize; ++k) {
+                auto sum = xsimd::reduce_add(acc[k]);
+                for (auto tap = vecTaps; tap < numTaps; ++tap) {
+                    sum += reversedCoefficients[tap] * window[k + tap];
+                }
+                dest[sample + k] = sum;
+            }
+        };
+        const auto tiledSamples = numSamples - numSamples % tileSize;
+        for (auto sample = 0_sz; sample < tiledSamples; sample += tileSize) {
+            processTile(std::integral_constant<size_t, tileSize>{}, sample);
+        }
+        for (auto sample = tiledSamples; sample < numSamples; ++sample) {
+            processTile(std::integral_constant<size_t, 1>{}, sample);
+        }
+    }
+
+    template <FloatType SampleType>
+    using FIRBlockKernel = void (*)(const SampleType*, const SampleType*, SampleType*, size_t, size_t) noexcept;
+
+    template <class Arch, FloatType SampleType>
+    [[nodiscard]] FIRBlockKernel<SampleType> getFIRBlockKernel() noexcept {
+        return &processFIRBlock<Arch, SampleType>;
+    }
+
+    /*
+        Computes one output frame of a multichannel FIR. `history` points at the oldest of the `numTaps` interleaved frames the taps apply to, and `reversedCoefficients`
+        is in the same (oldest first) order. Vectorised across channels - nothing here is guaranteed to be aligned, as the frames are `numChannels` apart.
+    */
+    template <class Arch, FloatType SampleType>
+    void processFIRFrame(const SampleType* reversedCoefficients, const SampleType* history, SampleType* dest, size_t numTaps, size_t numChannels) noexcept {
+        using BatchType = xsimd::batch<SampleType, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        const auto vecSize = numChannels - numChannels % simdSize;
+        for (auto channel = 0_sz; channel < vecSize; channel += simdSize) {
+            BatchType acc(static_cast<SampleType>(0.0));
+            const auto* frame = history + channel;
+            for (auto tap = 0_sz; tap < numTaps; ++tap) {
+                acc = xsimd::fma(BatchType(reversedCoefficients[tap]), BatchType::load_unaligned(frame), acc);
+                frame += numChannels;
+            }
+            acc.store_unaligned(dest + channel);
+        }
+        for (auto channel = vecSize; channel < numChannels; ++channel) {
+            auto acc = static_cast<SampleType>(0.0);
+            for (auto tap = 0_sz; tap < numTaps; ++tap) {
+                acc += reversedCoefficients[tap] * history[tap * numChannels + channel];
+            }
+            dest[channel] = acc;
+        }
+    }
+
+    template <FloatType SampleType>
+    using FIRFrameKernel = void (*)(const SampleType*, const SampleType*, SampleType*, size_t, size_t) noexcept;
+
+    template <class Arch, FloatType SampleType>
+    [[nodiscard]] FIRFrameKernel<SampleType> getFIRFrameKernel() noexcept {
+        return &processFIRFrame<Arch, SampleType>;
+    }
+
+#if defined(MARVIN_HAS_AVX2_KERNELS)
+    extern template FIRFrameKernel<float> getFIRFrameKernel<utils::simd::AVX2Arch, float>() noexcept;
+    extern template FIRFrameKernel<double> getFIRFrameKernel<utils::simd::AVX2Arch, double>() noexcept;
+    extern template FIRBlockKernel<float> getFIRBlockKernel<utils::simd::AVX2Arch, float>() noexcept;
+    extern template FIRBlockKernel<double> getFIRBlockKernel<utils::simd::AVX2Arch, double>() noexcept;
+#endif
+#if defined(MARVIN_HAS_AVX512_KERNELS)
+    extern template FIRFrameKernel<float> getFIRFrameKernel<utils::simd::AVX512Arch, float>() noexcept;
+    extern template FIRFrameKernel<double> getFIRFrameKernel<utils::simd::AVX512Arch, double>() noexcept;
+    extern template FIRBlockKernel<float> getFIRBlockKernel<utils::simd::AVX512Arch, float>() noexcept;
+    extern template FIRBlockKernel<double> getFIRBlockKernel<utils::simd::AVX512Arch, double>() noexcept;
+#endif
+} // namespace marvin::dsp::filters::kernels
+#endif
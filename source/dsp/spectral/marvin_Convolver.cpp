@@ -0,0 +1,278 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include "marvin/dsp/spectral/marvin_Convolver.h"
+#include "marvin/library/marvin_Literals.h"
+#include "marvin/math/marvin_VecOps.h"
+#include <algorithm>
+#include <cassert>
+namespace marvin::dsp::spectral {
+    template <FloatType SampleType>
+    void Convolver<SampleType>::initialise(size_t blockSize, std::span<const SampleType> impulseResponse) {
+        assert(blockSize != 0);
+        m_blockSize = blockSize;
+        m_numBins = blockSize + 1;
+        m_numPartitions = std::max<size_t>((impulseResponse.size() + blockSize - 1) / blockSize, 1);
+        m_fft = std::make_unique<FFT<SampleType>>(FFTSize{ blockSize * 2 });
+        // Both transforms run unscaled - everything they leave out is folded into the impulse response spectra instead.
+        m_fft->setScalingEnabled(false);
+        const auto forwardScaling = m_fft->getForwardScaling();
+        const auto irScaling = forwardScaling * forwardScaling * m_fft->getInverseScaling();
+        m_irSpectra.resize(m_numPartitions * m_numBins);
+        m_inputSpectra.resize(m_numPartitions * m_numBins);
+        m_accumulator.resize(m_numBins);
+        m_outputSpectrum.resize(m_numBins);
+        m_inputBuffer.resize(blockSize * 2);
+        m_outputBuffer.resize(blockSize * 2);
+        for (auto partition = 0_sz; partition < m_numPartitions; ++partition) {
+            // Overlap-save: each partition sits in the first half of the window, with the second half zeroed.
+            std::fill(m_inputBuffer.begin(), m_inputBuffer.end(), static_cast<SampleType>(0.0));
+            const auto start = std::min<size_t>(partition * blockSize, impulseResponse.size());
+            const auto end = std::min<size_t>(start + blockSize, impulseResponse.size());
+            std::copy(impulseResponse.begin() + static_cast<std::ptrdiff_t>(start), impulseResponse.begin() + static_cast<std::ptrdiff_t>(end), m_inputBuffer.begin());
+            std::span<std::complex<SampleType>> spectrum{ m_irSpectra.data() + partition * m_numBins, m_numBins };
+            m_fft->forward(m_inputBuffer, spectrum);
+            math::vecops::multiply(reinterpret_cast<SampleType*>(spectrum.data()), irScaling, m_numBins * 2);
+        }
+        reset();
+    }
+
+    template <FloatType SampleType>
+    void Convolver<SampleType>::reset() noexcept {
+        constexpr static std::complex<SampleType> zero{ static_cast<SampleType>(0.0), static_cast<SampleType>(0.0) };
+        std::fill(m_inputSpectra.begin(), m_inputSpectra.end(), zero);
+        std::fill(m_accumulator.begin(), m_accumulator.end(), zero);
+        std::fill(m_inputBuffer.begin(), m_inputBuffer.end(), static_cast<SampleType>(0.0));
+        m_inputPosition = 0;
+        m_currentPartition = 0;
+    }
+
+    template <FloatType SampleType>
+    void Convolver<SampleType>::process(std::span<SampleType> data) noexcept {
+        assert(m_fft);
+        auto processed = 0_sz;
+        while (processed < data.size()) {
+            const auto remaining = std::min<size_t>(data.size() - processed, m_blockSize - m_inputPosition);
+            processBlockSegment(data.subspan(processed, remaining));
+            processed += remaining;
+        }
+    }
+
+    template <FloatType SampleType>
+    size_t Convolver<SampleType>::getBlockSize() const noexcept {
+        return m_blockSize;
+    }
+
+    template <FloatType SampleType>
+    size_t Convolver<SampleType>::getNumPartitions() const noexcept {
+        return m_numPartitions;
+    }
+
+    /*
+        `data` never crosses a block boundary. The window is [previous block | current block so far | zeros], so the newest samples of the (circular) convolution
+        with the first partition are exact, and the rest of the partitions come from the accumulator.
+    */
+    template <FloatType SampleType>
+    void Convolver<SampleType>::processBlockSegment(std::span<SampleType> data) noexcept {
+        std::copy(data.begin(), data.end(), m_inputBuffer.begin() + static_cast<std::ptrdiff_t>(m_blockSize + m_inputPosition));
+        std::span<std::complex<SampleType>> inputSpectrum{ m_inputSpectra.data() + m_currentPartition * m_numBins, m_numBins };
+        m_fft->forward(m_inputBuffer, inputSpectrum);
+        std::copy(m_accumulator.begin(), m_accumulator.end(), m_outputSpectrum.begin());
+        math::vecops::multiplyAdd(m_outputSpectrum.data(), inputSpectrum.data(), m_irSpectra.data(), m_numBins);
+        m_fft->inverse(m_outputSpectrum, m_outputBuffer);
+        const auto outputStart = m_outputBuffer.begin() + static_cast<std::ptrdiff_t>(m_blockSize + m_inputPosition);
+        std::copy(outputStart, outputStart + static_cast<std::ptrdiff_t>(data.size()), data.begin());
+        m_inputPosition += data.size();
+        if (m_inputPosition == m_blockSize) {
+            // The block's complete, and its spectrum in the delay line is final - slide the window along, and get the next block's accumulator ready.
+            std::copy(m_inputBuffer.begin() + static_cast<std::ptrdiff_t>(m_blockSize), m_inputBuffer.end(), m_inputBuffer.begin());
+            std::fill(m_inputBuffer.begin() + static_cast<std::ptrdiff_t>(m_blockSize), m_inputBuffer.end(), static_cast<SampleType>(0.0));
+            m_inputPosition = 0;
+            m_currentPartition = (m_currentPartition + m_numPartitions - 1) % m_numPartitions;
+            accumulatePastPartitions();
+        }
+    }
+
+    /*
+        The delay line runs backwards, so the spectrum of the block `p` blocks ago lives `p` slots after the current one. The current slot holds the oldest block,
+        which is about to be overwritten, and isn't needed.
+    */
+    template <FloatType SampleType>
+    void Convolver<SampleType>::accumulatePastPartitions() noexcept {
+        std::fill(m_accumulator.begin(), m_accumulator.end(), std::complex<SampleType>{ static_cast<SampleType>(0.0), static_cast<SampleType>(0.0) });
+        for (auto partition = 1_sz; partition < m_numPartitions; ++partition) {
+            const auto slot = (m_currentPartition + partition) % m_numPartitions;
+            math::vecops::multiplyAdd(m_accumulator.data(), m_inputSpectra.data() + slot * m_numBins, m_irSpectra.data() + partition * m_numBins, m_numBins);
+        }
+    }
+
+    template class Convolver<float>;
+    template class Convolver<double>;
+
+    template <FloatType SampleType>
+    void MatrixConvolver<SampleType>::initialise(size_t blockSize, size_t numInputs, size_t numOutputs, std::span<const std::span<const SampleType>> impulseResponses) {
+        assert(blockSize != 0);
+        assert(numInputs != 0 && numOutputs != 0);
+        assert(impulseResponses.size() == numInputs * numOutputs);
+        m_blockSize = blockSize;
+        m_numBins = blockSize + 1;
+        m_numInputs = numInputs;
+        m_numOutputs = numOutputs;
+        auto longest = 0_sz;
+        for (const auto& impulseResponse : impulseResponses) {
+            longest = std::max<size_t>(longest, impulseResponse.size());
+        }
+        m_numPartitions = std::max<size_t>((longest + blockSize - 1) / blockSize, 1);
+        m_fft = std::make_unique<FFT<SampleType>>(FFTSize{ blockSize * 2 });
+        m_fft->setScalingEnabled(false);
+        const auto forwardScaling = m_fft->getForwardScaling();
+        const auto irScaling = forwardScaling * forwardScaling * m_fft->getInverseScaling();
+        m_irSpectra.resize(numOutputs * numInputs * m_numPartitions * m_numBins);
+        m_inputSpectra.resize(numInputs * m_numPartitions * m_numBins);
+        m_accumulators.resize(numOutputs * m_numBins);
+        m_outputSpectra.resize(numOutputs * m_numBins);
+        m_inputBuffers.resize(numInputs * blockSize * 2);
+        m_outputBuffers.resize(numOutputs * blockSize * 2);
+        m_inputBufferPointers.resize(numInputs);
+        m_inputSpectrumPointers.resize(numInputs);
+        m_outputSpectrumPointers.resize(numOutputs);
+        m_outputBufferPointers.resize(numOutputs);
+        for (auto input = 0_sz; input < numInputs; ++input) {
+            m_inputBufferPointers[input] = m_inputBuffers.data() + input * blockSize * 2;
+        }
+        for (auto output = 0_sz; output < numOutputs; ++output) {
+            m_outputSpectrumPointers[output] = m_outputSpectra.data() + output * m_numBins;
+            m_outputBufferPointers[output] = m_outputBuffers.data() + output * blockSize * 2;
+        }
+        std::span<SampleType> window{ m_outputBuffers.data(), blockSize * 2 };
+        for (auto output = 0_sz; output < numOutputs; ++output) {
+            for (auto input = 0_sz; input < numInputs; ++input) {
+                const auto& impulseResponse = impulseResponses[output * numInputs + input];
+                for (auto partition = 0_sz; partition < m_numPartitions; ++partition) {
+                    std::fill(window.begin(), window.end(), static_cast<SampleType>(0.0));
+                    const auto start = std::min<size_t>(partition * blockSize, impulseResponse.size());
+                    const auto end = std::min<size_t>(start + blockSize, impulseResponse.size());
+                    std::copy(impulseResponse.begin() + static_cast<std::ptrdiff_t>(start), impulseResponse.begin() + static_cast<std::ptrdiff_t>(end), window.begin());
+                    std::span<std::complex<SampleType>> spectrum{ getIRSpectrum(output, input, partition), m_numBins };
+                    m_fft->forward(window, spectrum);
+                    math::vecops::multiply(reinterpret_cast<SampleType*>(spectrum.data()), irScaling, m_numBins * 2);
+                }
+            }
+        }
+        reset();
+        // The first batch call with this many channels allocates - get it out of the way here, on (zeroed) buffers that are about to be overwritten anyway.
+        m_fft->forwardBatch({ m_inputBufferPointers.data(), numInputs, blockSize * 2 }, { m_inputSpectrumPointers.data(), numInputs, m_numBins });
+        m_fft->inverseBatch({ m_outputSpectrumPointers.data(), numOutputs, m_numBins }, { m_outputBufferPointers.data(), numOutputs, blockSize * 2 });
+    }
+
+    template <FloatType SampleType>
+    void MatrixConvolver<SampleType>::reset() noexcept {
+        constexpr static std::complex<SampleType> zero{ static_cast<SampleType>(0.0), static_cast<SampleType>(0.0) };
+        std::fill(m_inputSpectra.begin(), m_inputSpectra.end(), zero);
+        std::fill(m_accumulators.begin(), m_accumulators.end(), zero);
+        std::fill(m_outputSpectra.begin(), m_outputSpectra.end(), zero);
+        std::fill(m_inputBuffers.begin(), m_inputBuffers.end(), static_cast<SampleType>(0.0));
+        m_inputPosition = 0;
+        m_currentPartition = 0;
+        for (auto input = 0_sz; input < m_numInputs; ++input) {
+            m_inputSpectrumPointers[input] = getInputSpectrum(input, m_currentPartition);
+        }
+    }
+
+    template <FloatType SampleType>
+    void MatrixConvolver<SampleType>::process(containers::BufferView<SampleType> source, containers::BufferView<SampleType> dest) noexcept {
+        assert(m_fft);
+        assert(source.getNumChannels() == m_numInputs);
+        assert(dest.getNumChannels() == m_numOutputs);
+        assert(source.getNumSamples() == dest.getNumSamples());
+        const auto numSamples = source.getNumSamples();
+        auto processed = 0_sz;
+        while (processed < numSamples) {
+            const auto remaining = std::min<size_t>(numSamples - processed, m_blockSize - m_inputPosition);
+            processBlockSegment(source, dest, processed, remaining);
+            processed += remaining;
+        }
+    }
+
+    template <FloatType SampleType>
+    size_t MatrixConvolver<SampleType>::getNumPartitions() const noexcept {
+        return m_numPartitions;
+    }
+
+    /*
+        The same scheme as `Convolver::processBlockSegment`, with the inputs transformed (and the outputs inverse transformed) together as a batch.
+    */
+    template <FloatType SampleType>
+    void MatrixConvolver<SampleType>::processBlockSegment(containers::BufferView<SampleType> source, containers::BufferView<SampleType> dest, size_t offset, size_t size) noexcept {
+        const auto* const* sourceChannels = source.getArrayOfReadPointers();
+        auto* const* destChannels = dest.getArrayOfWritePointers();
+        for (auto input = 0_sz; input < m_numInputs; ++input) {
+            std::copy(sourceChannels[input] + offset, sourceChannels[input] + offset + size, m_inputBufferPointers[input] + m_blockSize + m_inputPosition);
+        }
+        m_fft->forwardBatch({ m_inputBufferPointers.data(), m_numInputs, m_blockSize * 2 }, { m_inputSpectrumPointers.data(), m_numInputs, m_numBins });
+        for (auto output = 0_sz; output < m_numOutputs; ++output) {
+            auto* outputSpectrum = m_outputSpectrumPointers[output];
+            const auto* accumulator = m_accumulators.data() + output * m_numBins;
+            std::copy(accumulator, accumulator + m_numBins, outputSpectrum);
+            for (auto input = 0_sz; input < m_numInputs; ++input) {
+                math::vecops::multiplyAdd(outputSpectrum, m_inputSpectrumPointers[input], getIRSpectrum(output, input, 0), m_numBins);
+            }
+        }
+        m_fft->inverseBatch({ m_outputSpectrumPointers.data(), m_numOutputs, m_numBins }, { m_outputBufferPointers.data(), m_numOutputs, m_blockSize * 2 });
+        for (auto output = 0_sz; output < m_numOutputs; ++output) {
+            const auto* outputStart = m_outputBufferPointers[output] + m_blockSize + m_inputPosition;
+            std::copy(outputStart, outputStart + size, destChannels[output] + offset);
+        }
+        m_inputPosition += size;
+        if (m_inputPosition == m_blockSize) {
+            for (auto input = 0_sz; input < m_numInputs; ++input) {
+                auto* window = m_inputBufferPointers[input];
+                std::copy(window + m_blockSize, window + m_blockSize * 2, window);
+                std::fill(window + m_blockSize, window + m_blockSize * 2, static_cast<SampleType>(0.0));
+            }
+            m_inputPosition = 0;
+            m_currentPartition = (m_currentPartition + m_numPartitions - 1) % m_numPartitions;
+            for (auto input = 0_sz; input < m_numInputs; ++input) {
+                m_inputSpectrumPointers[input] = getInputSpectrum(input, m_currentPartition);
+            }
+            accumulatePastPartitions();
+        }
+    }
+
+    /*
+        Every input's delay line is indexed in lockstep, so slot `(current + p) % P` holds the block `p` blocks ago for all of them.
+    */
+    template <FloatType SampleType>
+    void MatrixConvolver<SampleType>::accumulatePastPartitions() noexcept {
+        std::fill(m_accumulators.begin(), m_accumulators.end(), std::complex<SampleType>{ static_cast<SampleType>(0.0), static_cast<SampleType>(0.0) });
+        for (auto output = 0_sz; output < m_numOutputs; ++output) {
+            auto* accumulator = m_accumulators.data() + output * m_numBins;
+            for (auto input = 0_sz; input < m_numInputs; ++input) {
+                for (auto partition = 1_sz; partition < m_numPartitions; ++partition) {
+                    const auto slot = (m_currentPartition + partition) % m_numPartitions;
+                    math::vecops::multiplyAdd(accumulator, getInputSpectrum(input, slot), getIRSpectrum(output, input, partition), m_numBins);
+                }
+            }
+        }
+    }
+
+    template <FloatType SampleType>
+    std::complex<SampleType>* MatrixConvolver<SampleType>::getIRSpectrum(size_t output, size_t input, size_t partition) noexcept {
+        return m_irSpectra.data() + ((output * m_numInputs + input) * m_numPartitions + partition) * m_numBins;
+    }
+
+    template <FloatType SampleType>
+    std::complex<SampleType>* MatrixConvolver<SampleType>::getInputSpectrum(size_t input, size_t slot) noexcept {
+        return m_inputSpectra.data() + (input * m_numPartitions + slot) * m_numBins;
+    }
+
+    template class MatrixConvolver<float>;
+    template class MatrixConvolver<double>;
+} // namespace marvin::dsp::spectral
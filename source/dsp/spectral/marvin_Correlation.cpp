@@ -0,0 +1,163 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include "marvin/dsp/spectral/marvin_Correlation.h"
+#include "marvin/library/marvin_Literals.h"
+#include "marvin/math/marvin_VecOps.h"
+#include <algorithm>
+#include <cassert>
+namespace marvin::dsp::spectral {
+    namespace {
+        /*
+            The smallest `f * 2^n` (`f` in {1, 3, 5, 15}, n >= 1) that's at least `minSize` - sizes every engine has a fast path for, and that keep the padding well under 2x.
+        */
+        [[nodiscard]] size_t getCorrelationFFTSize(size_t minSize) noexcept {
+            auto best = 0_sz;
+            for (const auto factor : { 1_sz, 3_sz, 5_sz, 15_sz }) {
+                auto size = factor * 2;
+                while (size < minSize) {
+                    size *= 2;
+                }
+                best = best == 0 ? size : std::min<size_t>(best, size);
+            }
+            return best;
+        }
+    } // namespace
+
+    template <FloatType SampleType>
+    void Correlator<SampleType>::initialise(size_t maxLhsSize, size_t maxRhsSize) {
+        assert(maxLhsSize != 0 && maxRhsSize != 0);
+        m_maxLhsSize = maxLhsSize;
+        m_maxRhsSize = maxRhsSize;
+        const auto fftSize = getCorrelationFFTSize(maxLhsSize + maxRhsSize - 1);
+        m_fft = std::make_unique<FFT<SampleType>>(FFTSize{ fftSize });
+        m_lhsBuffer.resize(fftSize);
+        m_rhsBuffer.resize(fftSize);
+        const auto numBins = fftSize / 2 + 1;
+        m_lhsSpectrum.resize(numBins);
+        m_rhsSpectrum.resize(numBins);
+        m_crossSpectrum.resize(numBins);
+    }
+
+    /*
+        The inverse of X * conj(Y) is the circular correlation, with lag k at index k and lag -k at index N - k. With the padding, none of the lags overlap, so
+        the negative lags are just read from the end of the buffer.
+    */
+    template <FloatType SampleType>
+    void Correlator<SampleType>::correlate(std::span<const SampleType> lhs, std::span<const SampleType> rhs, std::span<SampleType> dest) noexcept {
+        assert(m_fft);
+        assert(!lhs.empty() && !rhs.empty());
+        assert(lhs.size() <= m_maxLhsSize && rhs.size() <= m_maxRhsSize);
+        assert(dest.size() == lhs.size() + rhs.size() - 1);
+        std::copy(lhs.begin(), lhs.end(), m_lhsBuffer.begin());
+        std::fill(m_lhsBuffer.begin() + static_cast<std::ptrdiff_t>(lhs.size()), m_lhsBuffer.end(), static_cast<SampleType>(0.0));
+        std::copy(rhs.begin(), rhs.end(), m_rhsBuffer.begin());
+        std::fill(m_rhsBuffer.begin() + static_cast<std::ptrdiff_t>(rhs.size()), m_rhsBuffer.end(), static_cast<SampleType>(0.0));
+        m_fft->forward(m_lhsBuffer, m_lhsSpectrum);
+        m_fft->forward(m_rhsBuffer, m_rhsSpectrum);
+        std::fill(m_crossSpectrum.begin(), m_crossSpectrum.end(), std::complex<SampleType>{ 0.0, 0.0 });
+        math::vecops::conjugateMultiplyAdd(m_crossSpectrum.data(), m_lhsSpectrum.data(), m_rhsSpectrum.data(), m_crossSpectrum.size());
+        m_fft->inverse(m_crossSpectrum, m_lhsBuffer);
+        const auto numNegativeLags = rhs.size() - 1;
+        std::copy(m_lhsBuffer.end() - static_cast<std::ptrdiff_t>(numNegativeLags), m_lhsBuffer.end(), dest.begin());
+        std::copy(m_lhsBuffer.begin(), m_lhsBuffer.begin() + static_cast<std::ptrdiff_t>(lhs.size()), dest.begin() + static_cast<std::ptrdiff_t>(numNegativeLags));
+    }
+
+    template <FloatType SampleType>
+    void Correlator<SampleType>::autocorrelate(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+        assert(m_fft);
+        assert(!source.empty() && dest.size() <= source.size());
+        // Lag k wraps around onto lag k - N, so the padding only needs to keep the written lags clear of the negative ones.
+        assert(source.size() + dest.size() <= m_lhsBuffer.size() + 1);
+        std::copy(source.begin(), source.end(), m_lhsBuffer.begin());
+        std::fill(m_lhsBuffer.begin() + static_cast<std::ptrdiff_t>(source.size()), m_lhsBuffer.end(), static_cast<SampleType>(0.0));
+        m_fft->forward(m_lhsBuffer, m_lhsSpectrum);
+        std::fill(m_crossSpectrum.begin(), m_crossSpectrum.end(), std::complex<SampleType>{ 0.0, 0.0 });
+        math::vecops::conjugateMultiplyAdd(m_crossSpectrum.data(), m_lhsSpectrum.data(), m_lhsSpectrum.data(), m_crossSpectrum.size());
+        m_fft->inverse(m_crossSpectrum, m_lhsBuffer);
+        std::copy(m_lhsBuffer.begin(), m_lhsBuffer.begin() + static_cast<std::ptrdiff_t>(dest.size()), dest.begin());
+    }
+
+    template <FloatType SampleType>
+    size_t Correlator<SampleType>::getFFTSize() const noexcept {
+        return m_lhsBuffer.size();
+    }
+
+    template <FloatType SampleType>
+    std::vector<SampleType> correlate(std::span<const SampleType> lhs, std::span<const SampleType> rhs) {
+        if (lhs.empty() || rhs.empty()) {
+            return {};
+        }
+        Correlator<SampleType> correlator;
+        correlator.initialise(lhs.size(), rhs.size());
+        std::vector<SampleType> result(lhs.size() + rhs.size() - 1);
+        correlator.correlate(lhs, rhs, result);
+        return result;
+    }
+
+    template <FloatType SampleType>
+    std::vector<SampleType> autocorrelate(std::span<const SampleType> source) {
+        if (source.empty()) {
+            return {};
+        }
+        Correlator<SampleType> correlator;
+        correlator.initialise(source.size(), source.size());
+        std::vector<SampleType> result(source.size());
+        correlator.autocorrelate(source, result);
+        return result;
+    }
+
+    /*
+        Fits a parabola through the highest point and its two neighbours - its vertex is at an offset of 0.5 * (a - c) / (a - 2b + c) from the middle point.
+        The neighbours are used even if they're outside [minLag, maxLag], as long as they're in the correlation.
+    */
+    template <FloatType SampleType>
+    CorrelationPeak<SampleType> findPeak(std::span<const SampleType> correlation, std::ptrdiff_t firstLag, std::ptrdiff_t minLag, std::ptrdiff_t maxLag) noexcept {
+        const auto size = static_cast<std::ptrdiff_t>(correlation.size());
+        const auto start = std::max<std::ptrdiff_t>(minLag - firstLag, 0);
+        const auto end = std::min<std::ptrdiff_t>(maxLag - firstLag + 1, size);
+        if (start >= end) {
+            return { static_cast<SampleType>(firstLag), static_cast<SampleType>(0.0) };
+        }
+        const auto peakIt = std::max_element(correlation.begin() + start, correlation.begin() + end);
+        const auto peakIndex = std::distance(correlation.begin(), peakIt);
+        const auto peakLag = static_cast<SampleType>(peakIndex + firstLag);
+        if (peakIndex == 0 || peakIndex == size - 1) {
+            return { peakLag, *peakIt };
+        }
+        const auto a = correlation[static_cast<size_t>(peakIndex - 1)];
+        const auto b = *peakIt;
+        const auto c = correlation[static_cast<size_t>(peakIndex + 1)];
+        const auto denominator = a - static_cast<SampleType>(2.0) * b + c;
+        if (denominator >= static_cast<SampleType>(0.0)) {
+            // Flat (or not actually a maximum) - there's nothing to refine.
+            return { peakLag, b };
+        }
+        const auto delta = static_cast<SampleType>(0.5) * (a - c) / denominator;
+        const auto value = b - static_cast<SampleType>(0.25) * (a - c) * delta;
+        return { peakLag + delta, value };
+    }
+
+    template <FloatType SampleType>
+    CorrelationPeak<SampleType> findPeak(std::span<const SampleType> correlation, std::ptrdiff_t firstLag) noexcept {
+        return findPeak(correlation, firstLag, firstLag, firstLag + static_cast<std::ptrdiff_t>(correlation.size()) - 1);
+    }
+
+    template class Correlator<float>;
+    template class Correlator<double>;
+    template std::vector<float> correlate(std::span<const float>, std::span<const float>);
+    template std::vector<double> correlate(std::span<const double>, std::span<const double>);
+    template std::vector<float> autocorrelate(std::span<const float>);
+    template std::vector<double> autocorrelate(std::span<const double>);
+    template CorrelationPeak<float> findPeak(std::span<const float>, std::ptrdiff_t, std::ptrdiff_t, std::ptrdiff_t) noexcept;
+    template CorrelationPeak<double> findPeak(std::span<const double>, std::ptrdiff_t, std::ptrdiff_t, std::ptrdiff_t) noexcept;
+    template CorrelationPeak<float> findPeak(std::span<const float>, std::ptrdiff_t) noexcept;
+    template CorrelationPeak<double> findPeak(std::span<const double>, std::ptrdiff_t) noexcept;
+} // namespace marvin::dsp::spectral
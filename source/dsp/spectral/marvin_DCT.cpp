@@ -0,0 +1,391 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include "marvin/dsp/spectral/marvin_DCT.h"
+#include "marvin/library/marvin_Literals.h"
+#include "marvin/math/marvin_VecOps.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <type_traits>
+#if defined(MARVIN_MACOS) && !defined(MARVIN_FORCE_FALLBACK_FFT)
+#include <Accelerate/Accelerate.h>
+#elif defined(MARVIN_HAS_IPP) && !defined(MARVIN_FORCE_FALLBACK_FFT)
+#include <ipp/ippcore.h>
+#include <ipp/ipps.h>
+#include <ipp/ipptypes.h>
+#endif
+namespace marvin::dsp::spectral {
+    /*
+        The fallback (FFT based) transforms, also used for anything the platform engines don't cover. All the twiddles are computed in double precision up front.
+        - II: Makhoul's reordering (evens forwards, then odds backwards) turns the DCT into a real DFT of the same size, with a post-twiddle of e^(-i * pi * k / 2N).
+          Only bins [0, N / 2] come out of the real FFT - bin k's twiddled product gives X[k] as its real part, and X[N - k] as its negated imaginary part.
+        - III: the same steps in reverse, with the N / 2 scaling folded into the pre-twiddles.
+        - IV: pairs up x[2n] and x[N - 1 - 2n] as a complex sequence, pre-twiddles by e^(-i * pi * (n + 1/4) / N), runs an N / 2 point complex FFT, and post-twiddles
+          by e^(-i * pi * k / N) - the real and (negated) imaginary parts are the even and (reversed) odd outputs.
+    */
+    template <FloatType SampleType>
+    class FallbackDCT final {
+    public:
+        FallbackDCT(DCTType type, size_t size) : m_type(type), m_size(size) {
+            const auto n = static_cast<double>(size);
+            if (type == DCTType::IV) {
+                const auto half = size / 2;
+                m_complexFFT = std::make_unique<FFT<std::complex<SampleType>>>(FFTSize{ half });
+                m_complexBuffer.resize(half);
+                m_complexSpectrum.resize(half);
+                m_preTwiddles.resize(half);
+                m_postTwiddles.resize(half);
+                for (auto i = 0_sz; i < half; ++i) {
+                    const auto index = static_cast<double>(i);
+                    m_preTwiddles[i] = std::polar(1.0, -std::numbers::pi * (index + 0.25) / n);
+                    m_postTwiddles[i] = std::polar(1.0, -std::numbers::pi * index / n);
+                }
+                return;
+            }
+            m_realFFT = std::make_unique<FFT<SampleType>>(FFTSize{ size });
+            m_realBuffer.resize(size);
+            m_complexSpectrum.resize(size / 2 + 1);
+            m_postTwiddles.resize(size / 2 + 1);
+            const auto gain = type == DCTType::II ? 1.0 : n / 2.0;
+            for (auto k = 0_sz; k <= size / 2; ++k) {
+                const auto angle = std::numbers::pi * static_cast<double>(k) / (2.0 * n);
+                m_postTwiddles[k] = std::polar(gain, type == DCTType::II ? -angle : angle);
+            }
+        }
+
+        void transform(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+            switch (m_type) {
+                case DCTType::II: transformII(source, dest); break;
+                case DCTType::III: transformIII(source, dest); break;
+                case DCTType::IV: transformIV(source, dest); break;
+            }
+        }
+
+    private:
+        void transformII(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+            const auto half = m_size / 2;
+            for (auto i = 0_sz; i < half; ++i) {
+                m_realBuffer[i] = source[2 * i];
+                m_realBuffer[m_size - 1 - i] = source[2 * i + 1];
+            }
+            m_realFFT->forward(m_realBuffer, m_complexSpectrum);
+            for (auto k = 0_sz; k <= half; ++k) {
+                const auto product = std::complex<SampleType>{ m_postTwiddles[k] } * m_complexSpectrum[k];
+                dest[k] = product.real();
+                if (k != 0 && k != half) {
+                    dest[m_size - k] = -product.imag();
+                }
+            }
+        }
+
+        void transformIII(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+            const auto half = m_size / 2;
+            for (auto k = 0_sz; k <= half; ++k) {
+                const auto mirrored = k == 0 ? static_cast<SampleType>(0.0) : source[m_size - k];
+                m_complexSpectrum[k] = std::complex<SampleType>{ m_postTwiddles[k] } * std::complex<SampleType>{ source[k], -mirrored };
+            }
+            m_realFFT->inverse(m_complexSpectrum, m_realBuffer);
+            for (auto i = 0_sz; i < half; ++i) {
+                dest[2 * i] = m_realBuffer[i];
+                dest[2 * i + 1] = m_realBuffer[m_size - 1 - i];
+            }
+        }
+
+        void transformIV(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+            const auto half = m_size / 2;
+            for (auto i = 0_sz; i < half; ++i) {
+                m_complexBuffer[i] = std::complex<SampleType>{ m_preTwiddles[i] } * std::complex<SampleType>{ source[2 * i], source[m_size - 1 - 2 * i] };
+            }
+            m_complexFFT->forward(m_complexBuffer, m_complexSpectrum);
+            for (auto k = 0_sz; k < half; ++k) {
+                const auto product = std::complex<SampleType>{ m_postTwiddles[k] } * m_complexSpectrum[k];
+                dest[2 * k] = product.real();
+                dest[m_size - 1 - 2 * k] = -product.imag();
+            }
+        }
+
+        DCTType m_type;
+        size_t m_size;
+        std::unique_ptr<FFT<SampleType>> m_realFFT{ nullptr };
+        std::unique_ptr<FFT<std::complex<SampleType>>> m_complexFFT{ nullptr };
+        std::vector<SampleType> m_realBuffer;
+        std::vector<std::complex<SampleType>> m_complexBuffer;
+        std::vector<std::complex<SampleType>> m_complexSpectrum;
+        std::vector<std::complex<double>> m_preTwiddles;
+        std::vector<std::complex<double>> m_postTwiddles;
+    };
+
+#if defined(MARVIN_MACOS) && !defined(MARVIN_FORCE_FALLBACK_FFT)
+    /*
+        vDSP's DCT is single precision only, and returns a null setup for sizes it doesn't support - either way, the fallback takes over.
+        Its definitions (including the x[0] / 2 in type III) are the ones `DCTType` documents, so no rescaling is needed.
+    */
+    template <FloatType SampleType>
+    class DCT<SampleType>::Impl final {
+    public:
+        Impl(DCTType type, size_t size) : m_type(type), m_size(size) {
+            if constexpr (std::is_same_v<SampleType, float>) {
+                const auto vdspType = type == DCTType::II ? vDSP_DCT_II : (type == DCTType::III ? vDSP_DCT_III : vDSP_DCT_IV);
+                m_setup = vDSP_DCT_CreateSetup(nullptr, static_cast<vDSP_Length>(size), vdspType);
+            }
+            if (m_setup) {
+                m_scratch.resize(size);
+            } else {
+                m_fallback = std::make_unique<FallbackDCT<SampleType>>(type, size);
+            }
+        }
+
+        Impl(const Impl&) = delete;
+        Impl& operator=(const Impl&) = delete;
+
+        ~Impl() noexcept {
+            if (m_setup) {
+                vDSP_DFT_DestroySetup(m_setup);
+            }
+        }
+
+        [[nodiscard]] EngineType getEngineType() const noexcept {
+            return m_setup ? EngineType::Accelerate_FFT : EngineType::Fallback_FFT;
+        }
+
+        void transform(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+            if constexpr (std::is_same_v<SampleType, float>) {
+                if (m_setup) {
+                    std::copy(source.begin(), source.end(), m_scratch.begin());
+                    vDSP_DCT_Execute(m_setup, m_scratch.data(), dest.data());
+                    return;
+                }
+            }
+            m_fallback->transform(source, dest);
+        }
+
+        DCTType m_type;
+        size_t m_size;
+
+    private:
+        vDSP_DFT_Setup m_setup{ nullptr };
+        std::vector<SampleType> m_scratch;
+        std::unique_ptr<FallbackDCT<SampleType>> m_fallback{ nullptr };
+    };
+#elif defined(MARVIN_HAS_IPP) && !defined(MARVIN_FORCE_FALLBACK_FFT)
+    /*
+        IPP only has types II (`ippsDCTFwd`) and III (`ippsDCTInv`), and both are orthonormal - C(0) = sqrt(1 / N), C(k) = sqrt(2 / N) - so the output of II is rescaled by
+        1 / C(k), and the input to III is prescaled by 1 / C(k) (and the extra 1/2 on x[0]). Type IV goes through the fallback.
+    */
+    template <FloatType SampleType>
+    class DCT<SampleType>::Impl final {
+    public:
+        using IppsFwdSpec = std::conditional_t<std::is_same_v<SampleType, float>, IppsDCTFwdSpec_32f, IppsDCTFwdSpec_64f>;
+        using IppsInvSpec = std::conditional_t<std::is_same_v<SampleType, float>, IppsDCTInvSpec_32f, IppsDCTInvSpec_64f>;
+
+        Impl(DCTType type, size_t size) : m_type(type), m_size(size) {
+            if (type == DCTType::IV) {
+                m_fallback = std::make_unique<FallbackDCT<SampleType>>(type, size);
+                return;
+            }
+            const auto length = static_cast<int>(size);
+            constexpr static auto hint = ippAlgHintNone;
+            int specSize, initBuffSize, workBuffSize;
+            [[maybe_unused]] IppStatus status;
+            if constexpr (std::is_same_v<SampleType, float>) {
+                status = type == DCTType::II ? ippsDCTFwdGetSize_32f(length, hint, &specSize, &initBuffSize, &workBuffSize) : ippsDCTInvGetSize_32f(length, hint, &specSize, &initBuffSize, &workBuffSize);
+            } else {
+                status = type == DCTType::II ? ippsDCTFwdGetSize_64f(length, hint, &specSize, &initBuffSize, &workBuffSize) : ippsDCTInvGetSize_64f(length, hint, &specSize, &initBuffSize, &workBuffSize);
+            }
+            assert(status == ippStsNoErr);
+            m_specBuff = ippsMalloc_8u(specSize);
+            Ipp8u* initBuffer = initBuffSize != 0 ? ippsMalloc_8u(initBuffSize) : nullptr;
+            if (workBuffSize != 0) {
+                m_workBuff = ippsMalloc_8u(workBuffSize);
+            }
+            if constexpr (std::is_same_v<SampleType, float>) {
+                status = type == DCTType::II ? ippsDCTFwdInit_32f(&m_fwdSpec, length, hint, m_specBuff, initBuffer) : ippsDCTInvInit_32f(&m_invSpec, length, hint, m_specBuff, initBuffer);
+            } else {
+                status = type == DCTType::II ? ippsDCTFwdInit_64f(&m_fwdSpec, length, hint, m_specBuff, initBuffer) : ippsDCTInvInit_64f(&m_invSpec, length, hint, m_specBuff, initBuffer);
+            }
+            assert(status == ippStsNoErr);
+            if (initBuffer) {
+                ippsFree(initBuffer);
+            }
+            const auto n = static_cast<double>(size);
+            m_scaling.resize(size);
+            m_scaling[0] = static_cast<SampleType>(type == DCTType::II ? std::sqrt(n) : std::sqrt(n) / 2.0);
+            std::fill(m_scaling.begin() + 1, m_scaling.end(), static_cast<SampleType>(std::sqrt(n / 2.0)));
+            m_scratch.resize(size);
+        }
+
+        Impl(const Impl&) = delete;
+        Impl& operator=(const Impl&) = delete;
+
+        ~Impl() noexcept {
+            if (m_specBuff) {
+                ippsFree(m_specBuff);
+            }
+            if (m_workBuff) {
+                ippsFree(m_workBuff);
+            }
+        }
+
+        [[nodiscard]] EngineType getEngineType() const noexcept {
+            return m_fallback ? EngineType::Fallback_FFT : EngineType::Ipp_FFT;
+        }
+
+        void transform(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+            if (m_fallback) {
+                m_fallback->transform(source, dest);
+                return;
+            }
+            if (m_type == DCTType::II) {
+                std::copy(source.begin(), source.end(), m_scratch.begin());
+                if constexpr (std::is_same_v<SampleType, float>) {
+                    ippsDCTFwd_32f(m_scratch.data(), dest.data(), m_fwdSpec, m_workBuff);
+                } else {
+                    ippsDCTFwd_64f(m_scratch.data(), dest.data(), m_fwdSpec, m_workBuff);
+                }
+                math::vecops::multiply(dest.data(), m_scaling.data(), m_size);
+            } else {
+                math::vecops::multiply(m_scratch.data(), source.data(), m_scaling.data(), m_size);
+                if constexpr (std::is_same_v<SampleType, float>) {
+                    ippsDCTInv_32f(m_scratch.data(), dest.data(), m_invSpec, m_workBuff);
+                } else {
+                    ippsDCTInv_64f(m_scratch.data(), dest.data(), m_invSpec, m_workBuff);
+                }
+            }
+        }
+
+        DCTType m_type;
+        size_t m_size;
+
+    private:
+        Ipp8u* m_specBuff{ nullptr };
+        Ipp8u* m_workBuff{ nullptr };
+        IppsFwdSpec* m_fwdSpec{ nullptr };
+        IppsInvSpec* m_invSpec{ nullptr };
+        std::vector<SampleType> m_scaling;
+        std::vector<SampleType> m_scratch;
+        std::unique_ptr<FallbackDCT<SampleType>> m_fallback{ nullptr };
+    };
+#else
+    template <FloatType SampleType>
+    class DCT<SampleType>::Impl final {
+    public:
+        Impl(DCTType type, size_t size) : m_type(type), m_size(size), m_fallback(type, size) {
+        }
+
+        [[nodiscard]] EngineType getEngineType() const noexcept {
+            return EngineType::Fallback_FFT;
+        }
+
+        void transform(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+            m_fallback.transform(source, dest);
+        }
+
+        DCTType m_type;
+        size_t m_size;
+
+    private:
+        FallbackDCT<SampleType> m_fallback;
+    };
+#endif
+
+    template <FloatType SampleType>
+    DCT<SampleType>::DCT(DCTType type, size_t size) {
+        assert(size >= 4 && size % 2 == 0);
+        m_impl = std::make_unique<Impl>(type, size);
+    }
+
+    template <FloatType SampleType>
+    DCT<SampleType>::~DCT() noexcept {
+    }
+
+    template <FloatType SampleType>
+    EngineType DCT<SampleType>::getEngineType() const noexcept {
+        return m_impl->getEngineType();
+    }
+
+    template <FloatType SampleType>
+    DCTType DCT<SampleType>::getType() const noexcept {
+        return m_impl->m_type;
+    }
+
+    template <FloatType SampleType>
+    size_t DCT<SampleType>::getSize() const noexcept {
+        return m_impl->m_size;
+    }
+
+    template <FloatType SampleType>
+    void DCT<SampleType>::transform(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+        assert(source.size() == m_impl->m_size && dest.size() == m_impl->m_size);
+        m_impl->transform(source, dest);
+    }
+
+    template <FloatType SampleType>
+    MDCT<SampleType>::MDCT(size_t size) : m_size(size), m_dct(DCTType::IV, size), m_window(size * 2), m_folded(size) {
+        const auto windowSize = static_cast<double>(size * 2);
+        for (auto i = 0_sz; i < m_window.size(); ++i) {
+            m_window[i] = static_cast<SampleType>(std::sin(std::numbers::pi * (static_cast<double>(i) + 0.5) / windowSize));
+        }
+    }
+
+    template <FloatType SampleType>
+    MDCT<SampleType>::MDCT(size_t size, std::span<const SampleType> window) : m_size(size), m_dct(DCTType::IV, size), m_window(window.begin(), window.end()), m_folded(size) {
+        assert(window.size() == size * 2);
+    }
+
+    template <FloatType SampleType>
+    size_t MDCT<SampleType>::getSize() const noexcept {
+        return m_size;
+    }
+
+    /*
+        With the windowed frame split into quarters (a, b, c, d), the MDCT is the DCT-IV of (-c_r - d, a - b_r), where _r is reversed.
+    */
+    template <FloatType SampleType>
+    void MDCT<SampleType>::forward(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+        assert(source.size() == m_size * 2 && dest.size() == m_size);
+        const auto quarter = m_size / 2;
+        for (auto i = 0_sz; i < quarter; ++i) {
+            const auto c = 3 * quarter - 1 - i;
+            const auto d = 3 * quarter + i;
+            m_folded[i] = -source[c] * m_window[c] - source[d] * m_window[d];
+            const auto a = i;
+            const auto b = 2 * quarter - 1 - i;
+            m_folded[quarter + i] = source[a] * m_window[a] - source[b] * m_window[b];
+        }
+        m_dct.transform(m_folded, dest);
+    }
+
+    /*
+        The reverse - the DCT-IV of the coefficients, (u1, u2), unfolds to (u2, -u2_r, -u1_r, -u1). The DCT-IV has a gain of N / 2, and the windowed overlap-add
+        (w[n]^2 + w[n + N]^2 == 1) halves the unaliased signal, so that's a 2 / N to scale by.
+    */
+    template <FloatType SampleType>
+    void MDCT<SampleType>::inverse(std::span<const SampleType> source, std::span<SampleType> dest) noexcept {
+        assert(source.size() == m_size && dest.size() == m_size * 2);
+        m_dct.transform(source, m_folded);
+        const auto quarter = m_size / 2;
+        const auto scale = static_cast<SampleType>(2.0) / static_cast<SampleType>(m_size);
+        for (auto i = 0_sz; i < quarter; ++i) {
+            dest[i] = m_folded[quarter + i] * scale;
+            dest[quarter + i] = -m_folded[m_size - 1 - i] * scale;
+            dest[2 * quarter + i] = -m_folded[quarter - 1 - i] * scale;
+            dest[3 * quarter + i] = -m_folded[i] * scale;
+        }
+        math::vecops::multiply(dest.data(), m_window.data(), dest.size());
+    }
+
+    template class DCT<float>;
+    template class DCT<double>;
+    template class MDCT<float>;
+    template class MDCT<double>;
+} // namespace marvin::dsp::spectral
@@ -13,13 +13,19 @@
 #include "marvin/library/marvin_Literals.h"
 #include "marvin/math/marvin_Math.h"
 #include "marvin/math/marvin_VecOps.h"
+#include "dsp/spectral/marvin_FFTKernels.h"
+#include <bit>
 #include <memory>
+#include <mutex>
 #include <cmath>
 #include <cassert>
 #include <type_traits>
 #include <vector>
 #include <span>
 #include <complex>
+#include <cstring>
+#include <numbers>
+#include <unordered_map>
 #if defined(MARVIN_MACOS)
 #include <Accelerate/Accelerate.h>
 #endif
@@ -35,7 +41,10 @@ namespace marvin::dsp::spectral {
     class ImplBase {
     public:
         using ValueType = typename getValueType<SampleType>::ValueType;
-        explicit ImplBase(size_t order) : m_order(order), m_n(static_cast<size_t>(std::pow(2, static_cast<int>(order)))) {
+        /*
+            `m_order` is only meaningful for powers of two, and is 0 otherwise.
+        */
+        explicit ImplBase(size_t size) : m_order(std::has_single_bit(size) ? static_cast<size_t>(std::countr_zero(size)) : 0), m_n(size) {
         }
 
         virtual ~ImplBase() noexcept = default;
@@ -43,25 +52,726 @@ namespace marvin::dsp::spectral {
         virtual std::span<std::complex<ValueType>> forward(std::span<SampleType> source) = 0;
         virtual void inverse(std::span<std::complex<ValueType>> source, std::span<SampleType> dest) = 0;
         virtual std::span<SampleType> inverse(std::span<std::complex<ValueType>> source) = 0;
+
+        /*
+            Engines without a multi-signal entry point transform the channels one at a time.
+        */
+        virtual void forwardBatch(containers::BufferView<SampleType> source, containers::BufferView<std::complex<ValueType>> dest) {
+            assert(source.getNumChannels() == dest.getNumChannels());
+            for (auto channel = 0_sz; channel < source.getNumChannels(); ++channel) {
+                forward(source[channel], dest[channel]);
+            }
+        }
+
+        virtual void inverseBatch(containers::BufferView<std::complex<ValueType>> source, containers::BufferView<SampleType> dest) {
+            assert(source.getNumChannels() == dest.getNumChannels());
+            for (auto channel = 0_sz; channel < source.getNumChannels(); ++channel) {
+                inverse(source[channel], dest[channel]);
+            }
+        }
+
+        /*
+            Every engine's `forward` and `inverse` handle `source` and `dest` aliasing, so these just alias them - IPP overrides them to use its own in-place functions.
+        */
+        virtual void forwardInPlace(std::span<std::complex<ValueType>> data) {
+            if constexpr (ComplexFloatType<SampleType>) {
+                forward(data, data);
+            } else {
+                forward(std::span<SampleType>{ reinterpret_cast<SampleType*>(data.data()), m_n }, data);
+            }
+        }
+
+        virtual void inverseInPlace(std::span<std::complex<ValueType>> data) {
+            if constexpr (ComplexFloatType<SampleType>) {
+                inverse(data, data);
+            } else {
+                inverse(data, std::span<SampleType>{ reinterpret_cast<SampleType*>(data.data()), m_n });
+            }
+        }
+
+        virtual void forward(std::span<SampleType> source, math::vecops::SplitComplex<ValueType> dest) = 0;
+        virtual void inverse(math::vecops::SplitComplex<ValueType> source, std::span<SampleType> dest) = 0;
+
+        virtual void setScalingEnabled(bool enabled) {
+            m_scalingEnabled = enabled;
+        }
+
+        [[nodiscard]] virtual ValueType getForwardScaling() const noexcept {
+            return static_cast<ValueType>(1.0);
+        }
+
+        [[nodiscard]] ValueType getInverseScaling() const noexcept {
+            return static_cast<ValueType>(1.0) / static_cast<ValueType>(m_n);
+        }
+
         [[nodiscard]] virtual EngineType getEngineType() const noexcept = 0;
         [[nodiscard]] size_t nfft() const noexcept {
             return m_n;
         }
 
     protected:
+        [[nodiscard]] size_t getNumBins() const noexcept {
+            return ComplexFloatType<SampleType> ? m_n : (m_n / 2) + 1;
+        }
+
         const size_t m_order;
         const size_t m_n;
+        bool m_scalingEnabled{ true };
+    };
+
+    /*
+        Conversions between interleaved and split complex data, for the engines that don't work on split data natively. Complex data is just a stereo interleaved signal.
+    */
+    template <FloatType T>
+    static void interleavedToSplit(const std::complex<T>* source, math::vecops::SplitComplex<T> dest, size_t size) noexcept {
+        T* const channels[2]{ dest.real, dest.imag };
+        math::vecops::deinterleave(channels, reinterpret_cast<const T*>(source), 2, size);
+    }
+
+    template <FloatType T>
+    static void splitToInterleaved(math::vecops::SplitComplex<T> source, std::complex<T>* dest, size_t size) noexcept {
+        const T* const channels[2]{ source.real, source.imag };
+        math::vecops::interleave(reinterpret_cast<T*>(dest), channels, 2, size);
+    }
+
+    /*
+        Thread-safe registry of immutable setup data (plans, twiddles, vDSP setups, IPP specs), shared between every FFT of the same size, sample type and engine.
+        Each cache is a function-local static in a function templated on the type and engine, so only the size needs to go in the key.
+        Holds weak references, so the setup data goes away with the last instance using it. Setup data is built outside the lock, as plans can depend on
+        other cached plans - if two threads race to build the same one, the first one in wins and the other is discarded.
+    */
+    template <typename Value>
+    class PlanCache final {
+    public:
+        template <typename Factory>
+        [[nodiscard]] std::shared_ptr<const Value> get(size_t key, Factory&& factory) {
+            {
+                std::scoped_lock lock{ m_mutex };
+                if (auto existing = m_plans[key].lock()) {
+                    return existing;
+                }
+            }
+            std::shared_ptr<const Value> created = factory();
+            std::scoped_lock lock{ m_mutex };
+            auto& entry = m_plans[key];
+            if (auto existing = entry.lock()) {
+                return existing;
+            }
+            entry = created;
+            return created;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::unordered_map<size_t, std::weak_ptr<const Value>> m_plans;
+    };
+
+    template <FloatType T>
+    [[nodiscard]] static const kernels::FFTKernels<T>& getKernels() noexcept {
+        static const auto table = utils::simd::dispatch([]<class Arch>() { return kernels::getFFTKernels<Arch, T>(); });
+        return table;
+    }
+
+    /*
+        Interface for the fallback's complex transforms. Plans are immutable once constructed - any scratch memory they need is passed in by the caller,
+        and needs to be at least `getWorkspaceSize() * numChannels` points long. Both directions are unscaled, and `source` and `dest` may alias.
+        Transforms `numChannels` signals at once, interleaved (`source[k * numChannels + channel]`), with the results interleaved the same way.
+    */
+    template <FloatType T>
+    class ComplexPlan {
+    public:
+        virtual ~ComplexPlan() noexcept = default;
+        virtual void forward(const std::complex<T>* source, std::complex<T>* dest, std::complex<T>* workspace, size_t numChannels) const noexcept = 0;
+        virtual void inverse(const std::complex<T>* source, std::complex<T>* dest, std::complex<T>* workspace, size_t numChannels) const noexcept = 0;
+        [[nodiscard]] virtual size_t getWorkspaceSize() const noexcept = 0;
+    };
+
+    /*
+        Mixed radix Stockham autosort transform, for sizes that factor entirely into 2, 3, 5 and 7. Radix-4 passes come first for as long as they can,
+        then the odd radices, and finally a single radix-2 pass if there's a factor of two left over (the last pass never needs twiddles).
+        Each pass gets its own contiguous (planar) slice of the twiddle table, computed in double precision regardless of `T`.
+        Interleaved channels fall out of the Stockham indexing for free - starting every pass's stride at `numChannels` rather than 1 runs the channels
+        side by side, so the butterflies are vectorised across channels from the very first pass.
+    */
+    template <FloatType T>
+    class MixedRadixPlan final : public ComplexPlan<T> {
+    public:
+        explicit MixedRadixPlan(size_t size) : m_size(size) {
+            assert(canFactorise(size));
+            const auto& kernels = getKernels<T>();
+            auto n = size;
+            auto stride = 1_sz;
+            const auto addPasses = [&](size_t radix, size_t count, typename kernels::FFTKernels<T>::Pass forwardKernel, typename kernels::FFTKernels<T>::Pass inverseKernel) {
+                for (auto i = 0_sz; i < count; ++i) {
+                    m_passes.push_back({ .forward = forwardKernel, .inverse = inverseKernel, .n = n, .stride = stride, .twiddleOffset = m_twiddleFactors.size() });
+                    const auto m = n / radix;
+                    for (auto j = 1_sz; j < radix; ++j) {
+                        for (auto p = 0_sz; p < m; ++p) {
+                            const auto phase = -2.0 * std::numbers::pi * static_cast<double>(j * p) / static_cast<double>(n);
+                            m_twiddleFactors.emplace_back(static_cast<T>(std::cos(phase)), static_cast<T>(std::sin(phase)));
+                        }
+                    }
+                    n /= radix;
+                    stride *= radix;
+                }
+            };
+            const auto countFactors = [size](size_t radix) {
+                auto count = 0_sz;
+                for (auto remaining = size; remaining % radix == 0; remaining /= radix) {
+                    ++count;
+                }
+                return count;
+            };
+            const auto twos = static_cast<size_t>(std::countr_zero(size));
+            addPasses(4, twos / 2, kernels.radix4Forward, kernels.radix4Inverse);
+            addPasses(3, countFactors(3), kernels.radix3Forward, kernels.radix3Inverse);
+            addPasses(5, countFactors(5), kernels.radix5Forward, kernels.radix5Inverse);
+            addPasses(7, countFactors(7), kernels.radix7Forward, kernels.radix7Inverse);
+            addPasses(2, twos % 2, kernels.radix2Forward, kernels.radix2Inverse);
+            assert(n == 1);
+        }
+
+        /*
+            Whether `size` factors entirely into 2, 3, 5 and 7.
+        */
+        [[nodiscard]] static bool canFactorise(size_t size) noexcept {
+            if (size == 0) return false;
+            for (const auto radix : { 2_sz, 3_sz, 5_sz, 7_sz }) {
+                while (size % radix == 0) {
+                    size /= radix;
+                }
+            }
+            return size == 1;
+        }
+
+        void forward(const std::complex<T>* source, std::complex<T>* dest, std::complex<T>* workspace, size_t numChannels) const noexcept override {
+            execute<false>(source, dest, workspace, numChannels);
+        }
+
+        void inverse(const std::complex<T>* source, std::complex<T>* dest, std::complex<T>* workspace, size_t numChannels) const noexcept override {
+            execute<true>(source, dest, workspace, numChannels);
+        }
+
+        [[nodiscard]] size_t getWorkspaceSize() const noexcept override {
+            return m_size;
+        }
+
+    private:
+        struct Pass {
+            typename kernels::FFTKernels<T>::Pass forward;
+            typename kernels::FFTKernels<T>::Pass inverse;
+            size_t n;
+            size_t stride;
+            size_t twiddleOffset;
+        };
+
+        /*
+            The passes ping-pong between `dest` and `workspace`, assigned backwards from the last pass so the result always lands in `dest` without a final copy.
+        */
+        template <bool Inverse>
+        void execute(const std::complex<T>* source, std::complex<T>* dest, std::complex<T>* workspace, size_t numChannels) const noexcept {
+            const auto numPasses = m_passes.size();
+            if (numPasses == 0) {
+                std::copy(source, source + numChannels, dest);
+                return;
+            }
+            const auto* in = source;
+            if (source == dest && numPasses % 2 == 1) {
+                // The first pass writes to dest, so get the input out of the way first.
+                std::copy(source, source + m_size * numChannels, workspace);
+                in = workspace;
+            }
+            for (auto i = 0_sz; i < numPasses; ++i) {
+                const auto& pass = m_passes[i];
+                auto* out = (numPasses - 1 - i) % 2 == 0 ? dest : workspace;
+                const auto kernel = Inverse ? pass.inverse : pass.forward;
+                kernel(in, out, m_twiddleFactors.data() + pass.twiddleOffset, pass.n, pass.stride * numChannels);
+                in = out;
+            }
+        }
+
+        const size_t m_size;
+        std::vector<Pass> m_passes;
+        std::vector<std::complex<T>> m_twiddleFactors;
+    };
+
+    template <FloatType T>
+    [[nodiscard]] static std::shared_ptr<const ComplexPlan<T>> getComplexPlan(size_t size);
+
+    /*
+        Bluestein's algorithm, for sizes with a prime factor larger than 7. Rewrites the N point DFT as a convolution with a chirp, which is done with a
+        power-of-two transform of at least 2N - 1 points (shared with any other users of that size). The chirp's spectrum is precomputed for both directions, with the 1 / M of the inner inverse folded in.
+    */
+    template <FloatType T>
+    class BluesteinPlan final : public ComplexPlan<T> {
+    public:
+        explicit BluesteinPlan(size_t size) : m_size(size), m_paddedSize(std::bit_ceil(size * 2 - 1)), m_inner(getComplexPlan<T>(m_paddedSize)) {
+            m_chirp.resize(m_size);
+            for (auto n = 0_sz; n < m_size; ++n) {
+                // n^2 mod 2N keeps the phase accurate for large n.
+                const auto phase = -std::numbers::pi * static_cast<double>((n * n) % (m_size * 2)) / static_cast<double>(m_size);
+                m_chirp[n] = { static_cast<T>(std::cos(phase)), static_cast<T>(std::sin(phase)) };
+            }
+            const auto scaling = static_cast<T>(1.0) / static_cast<T>(m_paddedSize);
+            std::vector<std::complex<T>> workspace(m_inner->getWorkspaceSize());
+            for (auto* spectrum : { &m_forwardSpectrum, &m_inverseSpectrum }) {
+                const auto conjugate = spectrum == &m_forwardSpectrum;
+                spectrum->resize(m_paddedSize);
+                std::fill(spectrum->begin(), spectrum->end(), std::complex<T>{ static_cast<T>(0.0), static_cast<T>(0.0) });
+                for (auto n = 0_sz; n < m_size; ++n) {
+                    const auto value = (conjugate ? std::conj(m_chirp[n]) : m_chirp[n]) * scaling;
+                    (*spectrum)[n] = value;
+                    if (n != 0) {
+                        (*spectrum)[m_paddedSize - n] = value;
+                    }
+                }
+                m_inner->forward(spectrum->data(), spectrum->data(), workspace.data(), 1);
+            }
+        }
+
+        void forward(const std::complex<T>* source, std::complex<T>* dest, std::complex<T>* workspace, size_t numChannels) const noexcept override {
+            execute<false>(source, dest, workspace, numChannels);
+        }
+
+        void inverse(const std::complex<T>* source, std::complex<T>* dest, std::complex<T>* workspace, size_t numChannels) const noexcept override {
+            execute<true>(source, dest, workspace, numChannels);
+        }
+
+        [[nodiscard]] size_t getWorkspaceSize() const noexcept override {
+            return m_paddedSize + m_inner->getWorkspaceSize();
+        }
+
+    private:
+        /*
+            With more than one channel, the chirp and spectrum multiplies apply the same factor to each of the `numChannels` interleaved values at a given index.
+        */
+        template <bool Inverse>
+        void execute(const std::complex<T>* source, std::complex<T>* dest, std::complex<T>* workspace, size_t numChannels) const noexcept {
+            auto* padded = workspace;
+            auto* innerWorkspace = workspace + m_paddedSize * numChannels;
+            const auto* spectrum = Inverse ? m_inverseSpectrum.data() : m_forwardSpectrum.data();
+            for (auto n = 0_sz; n < m_size; ++n) {
+                const auto chirp = Inverse ? std::conj(m_chirp[n]) : m_chirp[n];
+                for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                    padded[n * numChannels + channel] = source[n * numChannels + channel] * chirp;
+                }
+            }
+            std::fill(padded + m_size * numChannels, padded + m_paddedSize * numChannels, std::complex<T>{ static_cast<T>(0.0), static_cast<T>(0.0) });
+            m_inner->forward(padded, padded, innerWorkspace, numChannels);
+            if (numChannels == 1) {
+                math::vecops::multiply(padded, padded, spectrum, m_paddedSize);
+            } else {
+                for (auto k = 0_sz; k < m_paddedSize; ++k) {
+                    for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                        padded[k * numChannels + channel] *= spectrum[k];
+                    }
+                }
+            }
+            m_inner->inverse(padded, padded, innerWorkspace, numChannels);
+            for (auto k = 0_sz; k < m_size; ++k) {
+                const auto chirp = Inverse ? std::conj(m_chirp[k]) : m_chirp[k];
+                for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                    dest[k * numChannels + channel] = padded[k * numChannels + channel] * chirp;
+                }
+            }
+        }
+
+        const size_t m_size;
+        const size_t m_paddedSize;
+        const std::shared_ptr<const ComplexPlan<T>> m_inner;
+        std::vector<std::complex<T>> m_chirp;
+        std::vector<std::complex<T>> m_forwardSpectrum;
+        std::vector<std::complex<T>> m_inverseSpectrum;
+    };
+
+    template <FloatType T>
+    [[nodiscard]] static std::unique_ptr<ComplexPlan<T>> makeComplexPlan(size_t size) {
+        if (MixedRadixPlan<T>::canFactorise(size)) {
+            return std::make_unique<MixedRadixPlan<T>>(size);
+        }
+        return std::make_unique<BluesteinPlan<T>>(size);
+    }
+
+    template <FloatType T>
+    [[nodiscard]] static std::shared_ptr<const ComplexPlan<T>> getComplexPlan(size_t size) {
+        static PlanCache<ComplexPlan<T>> cache;
+        return cache.get(size, [size]() { return makeComplexPlan<T>(size); });
+    }
+
+    /*
+        Post-twiddles for the real split of an N point real transform, W_N^k for k in [0, N / 4].
+    */
+    template <FloatType T>
+    [[nodiscard]] static std::shared_ptr<const std::vector<std::complex<T>>> getRealTwiddleFactors(size_t size) {
+        static PlanCache<std::vector<std::complex<T>>> cache;
+        return cache.get(size, [size]() {
+            auto twiddles = std::make_shared<std::vector<std::complex<T>>>();
+            for (auto k = 0_sz; k <= size / 4; ++k) {
+                const auto phase = -2.0 * std::numbers::pi * static_cast<double>(k) / static_cast<double>(size);
+                twiddles->emplace_back(static_cast<T>(std::cos(phase)), static_cast<T>(std::sin(phase)));
+            }
+            return twiddles;
+        });
+    }
+
+    /*
+        The fallback engine. Complex transforms go straight through a `ComplexPlan`. Real transforms pack the signal into N/2 complex points (even samples as the
+        real part, odd samples as the imaginary part), run an N/2 point complex transform, and split / merge the spectrum with a post-twiddle step.
+        The plan and twiddles come from the shared caches, only the scratch buffers belong to the instance.
+        Always compiled, so the other engines can hand over sizes they don't support.
+        Batches interleave their channels, so the plan's butterflies run with one channel per SIMD lane.
+    */
+    template <RealOrComplexFloatType SampleType>
+    class FallbackEngine : public ImplBase<SampleType> {
+    public:
+        using ValueType = typename ImplBase<SampleType>::ValueType;
+        explicit FallbackEngine(size_t size) : ImplBase<SampleType>(size),
+                                               m_complexSize(ComplexFloatType<SampleType> ? size : size / 2),
+                                               m_plan(getComplexPlan<ValueType>(m_complexSize)) {
+            if constexpr (ComplexFloatType<SampleType>) {
+                m_forwardInternalBuff.resize(this->m_n);
+            } else {
+                assert(size >= 2 && size % 2 == 0);
+                m_forwardInternalBuff.resize(m_complexSize + 1);
+                m_complexScratchBuff.resize(m_complexSize);
+                m_realTwiddleFactors = getRealTwiddleFactors<ValueType>(size);
+            }
+            m_inverseInternalBuff.resize(this->m_n);
+            m_workspace.resize(m_plan->getWorkspaceSize());
+        }
+
+        ~FallbackEngine() noexcept override = default;
+
+        void forward(std::span<SampleType> source, std::span<std::complex<ValueType>> dest) override {
+            if constexpr (ComplexFloatType<SampleType>) {
+                assert(source.size() == dest.size());
+                assert(source.size() == this->m_n);
+                m_plan->forward(source.data(), dest.data(), m_workspace.data(), 1);
+            } else {
+                assert(source.size() == this->m_n);
+                assert(dest.size() == m_complexSize + 1);
+                // Even samples as the real part, odd samples as the imaginary part - std::complex is layout compatible with T[2].
+                m_plan->forward(reinterpret_cast<const std::complex<ValueType>*>(source.data()), dest.data(), m_workspace.data(), 1);
+                splitRealSpectrum(dest.data(), dest.data());
+            }
+        }
+
+        std::span<std::complex<ValueType>> forward(std::span<SampleType> source) override {
+            forward(source, m_forwardInternalBuff);
+            return m_forwardInternalBuff;
+        }
+
+        void inverse(std::span<std::complex<ValueType>> source, std::span<SampleType> dest) override {
+            if constexpr (ComplexFloatType<SampleType>) {
+                assert(source.size() == dest.size());
+                assert(dest.size() == this->m_n);
+                auto interleavedDest = marvin::math::complexViewToInterleaved(dest);
+                m_plan->inverse(source.data(), dest.data(), m_workspace.data(), 1);
+                if (this->m_scalingEnabled) {
+                    const auto normalisationFactor = static_cast<ValueType>(1.0) / static_cast<ValueType>(this->m_n);
+                    math::vecops::multiply(interleavedDest.data(), normalisationFactor, this->m_n * 2);
+                }
+            } else {
+                assert(source.size() == m_complexSize + 1);
+                inverseReal(source.data(), dest);
+            }
+        }
+
+        std::span<SampleType> inverse(std::span<std::complex<ValueType>> source) override {
+            inverse(source, m_inverseInternalBuff);
+            return m_inverseInternalBuff;
+        }
+
+        /*
+            The kernels work on interleaved data. For real input, the N/2 point transform is interleaved anyway, and `splitRealSpectrum` / `mergeRealSpectrum`
+            read and write the split arrays directly on the way out of (or into) it. Complex input goes through `m_forwardInternalBuff`.
+        */
+        void forward(std::span<SampleType> source, math::vecops::SplitComplex<ValueType> dest) override {
+            if constexpr (ComplexFloatType<SampleType>) {
+                forward(source, m_forwardInternalBuff);
+                interleavedToSplit(m_forwardInternalBuff.data(), dest, m_forwardInternalBuff.size());
+            } else {
+                assert(source.size() == this->m_n);
+                m_plan->forward(reinterpret_cast<const std::complex<ValueType>*>(source.data()), m_complexScratchBuff.data(), m_workspace.data(), 1);
+                splitRealSpectrum(m_complexScratchBuff.data(), dest);
+            }
+        }
+
+        void inverse(math::vecops::SplitComplex<ValueType> source, std::span<SampleType> dest) override {
+            if constexpr (ComplexFloatType<SampleType>) {
+                splitToInterleaved(source, m_forwardInternalBuff.data(), m_forwardInternalBuff.size());
+                inverse(m_forwardInternalBuff, dest);
+            } else {
+                inverseReal(source, dest);
+            }
+        }
+
+        /*
+            Interleaves the channels into `m_batchBuff`, and runs them through the plan together. Real channels are packed exactly like the single channel path,
+            so the split / merge steps are done per channel, on the way out of (or into) the interleaved buffer.
+        */
+        void forwardBatch(containers::BufferView<SampleType> source, containers::BufferView<std::complex<ValueType>> dest) override {
+            const auto numChannels = source.getNumChannels();
+            assert(dest.getNumChannels() == numChannels);
+            assert(source.getNumSamples() == this->m_n);
+            assert(dest.getNumSamples() == (ComplexFloatType<SampleType> ? this->m_n : m_complexSize + 1));
+            prepareBatch(numChannels);
+            interleaveChannels(source.getArrayOfReadPointers(), numChannels);
+            m_plan->forward(m_batchBuff.data(), m_batchBuff.data(), m_workspace.data(), numChannels);
+            deinterleaveChannels(dest.getArrayOfWritePointers(), numChannels);
+            if constexpr (!ComplexFloatType<SampleType>) {
+                for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                    splitRealSpectrum(dest[channel].data(), dest[channel].data());
+                }
+            }
+        }
+
+        void inverseBatch(containers::BufferView<std::complex<ValueType>> source, containers::BufferView<SampleType> dest) override {
+            const auto numChannels = source.getNumChannels();
+            assert(dest.getNumChannels() == numChannels);
+            assert(source.getNumSamples() == (ComplexFloatType<SampleType> ? this->m_n : m_complexSize + 1));
+            assert(dest.getNumSamples() == this->m_n);
+            prepareBatch(numChannels);
+            if constexpr (ComplexFloatType<SampleType>) {
+                interleaveChannels(source.getArrayOfReadPointers(), numChannels);
+            } else {
+                for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                    mergeRealSpectrum(source[channel].data(), m_complexScratchBuff.data());
+                    for (auto k = 0_sz; k < m_complexSize; ++k) {
+                        m_batchBuff[k * numChannels + channel] = m_complexScratchBuff[k];
+                    }
+                }
+            }
+            m_plan->inverse(m_batchBuff.data(), m_batchBuff.data(), m_workspace.data(), numChannels);
+            if (this->m_scalingEnabled) {
+                const auto normalisationFactor = static_cast<ValueType>(1.0) / static_cast<ValueType>(this->m_n);
+                math::vecops::multiply(reinterpret_cast<ValueType*>(m_batchBuff.data()), normalisationFactor, m_complexSize * numChannels * 2);
+            }
+            deinterleaveChannels(dest.getArrayOfWritePointers(), numChannels);
+        }
+
+        [[nodiscard]] EngineType getEngineType() const noexcept override {
+            return EngineType::Fallback_FFT;
+        }
+
+
+    private:
+        /*
+            Bin access for either interleaved or split complex spectra, so the real spectrum (un)packing can read and write either directly.
+        */
+        [[nodiscard]] static std::complex<ValueType> loadBin(const std::complex<ValueType>* bins, size_t k) noexcept {
+            return bins[k];
+        }
+
+        [[nodiscard]] static std::complex<ValueType> loadBin(math::vecops::SplitComplex<ValueType> bins, size_t k) noexcept {
+            return { bins.real[k], bins.imag[k] };
+        }
+
+        static void storeBin(std::complex<ValueType>* bins, size_t k, std::complex<ValueType> value) noexcept {
+            bins[k] = value;
+        }
+
+        static void storeBin(math::vecops::SplitComplex<ValueType> bins, size_t k, std::complex<ValueType> value) noexcept {
+            bins.real[k] = value.real();
+            bins.imag[k] = value.imag();
+        }
+
+        /*
+            Turns the N/2 point transform of the packed real signal (in `packed[0, N/2)`) into the N/2 + 1 bins of the real transform, in `dest` - which can
+            be `packed` itself, or a split spectrum. Bins k and N/2 - k only depend on each other, so they're done in pairs:
+            `X[k] = E + W^k O`, `X[N/2 - k] = conj(E - W^k O)`, where `E = (Z[k] + conj(Z[N/2 - k])) / 2` and `O = -j(Z[k] - conj(Z[N/2 - k])) / 2`.
+        */
+        template <typename Dest>
+        void splitRealSpectrum(const std::complex<ValueType>* packed, Dest dest) const noexcept {
+            constexpr static auto half = static_cast<ValueType>(0.5);
+            const auto m = m_complexSize;
+            const auto z0 = packed[0];
+            storeBin(dest, 0, { z0.real() + z0.imag(), static_cast<ValueType>(0.0) });
+            storeBin(dest, m, { z0.real() - z0.imag(), static_cast<ValueType>(0.0) });
+            for (auto k = 1_sz; k <= m / 2; ++k) {
+                const auto a = packed[k];
+                const auto b = std::conj(packed[m - k]);
+                const auto even = (a + b) * half;
+                const auto diff = (a - b) * half;
+                const std::complex<ValueType> odd{ diff.imag(), -diff.real() };
+                const auto rotated = (*m_realTwiddleFactors)[k] * odd;
+                storeBin(dest, k, even + rotated);
+                storeBin(dest, m - k, std::conj(even - rotated));
+            }
+        }
+
+        /*
+            Inverse of `splitRealSpectrum` - packs the N/2 + 1 bins in `source` (interleaved or split) back into the N/2 point spectrum of the even / odd
+            interleaved signal. Leaves out the factor of 1/2, which gets folded into the final 1/N scaling.
+        */
+        template <typename Source>
+        void mergeRealSpectrum(Source source, std::complex<ValueType>* dest) const noexcept {
+            const auto m = m_complexSize;
+            const auto x0 = loadBin(source, 0).real();
+            const auto xm = loadBin(source, m).real();
+            dest[0] = { x0 + xm, x0 - xm };
+            for (auto k = 1_sz; k <= m / 2; ++k) {
+                const auto a = loadBin(source, k);
+                const auto b = std::conj(loadBin(source, m - k));
+                const auto even = a + b;
+                const auto rotated = std::conj((*m_realTwiddleFactors)[k]) * (a - b);
+                const std::complex<ValueType> odd{ -rotated.imag(), rotated.real() };
+                dest[k] = even + odd;
+                dest[m - k] = std::conj(even - odd);
+            }
+        }
+
+        /*
+            The real inverse, from either an interleaved or a split spectrum.
+        */
+        template <typename Source>
+        void inverseReal(Source source, std::span<SampleType> dest) noexcept {
+            assert(dest.size() == this->m_n);
+            mergeRealSpectrum(source, m_complexScratchBuff.data());
+            m_plan->inverse(m_complexScratchBuff.data(), reinterpret_cast<std::complex<ValueType>*>(dest.data()), m_workspace.data(), 1);
+            if (this->m_scalingEnabled) {
+                math::vecops::multiply(dest.data(), static_cast<ValueType>(1.0) / static_cast<ValueType>(this->m_n), this->m_n);
+            }
+        }
+
+        /*
+            Grows the batch buffers to fit `numChannels` channels - only allocates if this is more channels than any batch before it.
+        */
+        void prepareBatch(size_t numChannels) {
+            if (m_batchBuff.size() < m_complexSize * numChannels) {
+                m_batchBuff.resize(m_complexSize * numChannels);
+            }
+            if (m_workspace.size() < m_plan->getWorkspaceSize() * numChannels) {
+                m_workspace.resize(m_plan->getWorkspaceSize() * numChannels);
+            }
+        }
+
+        /*
+            `m_batchBuff[k * numChannels + channel] = channels[channel][k]`, for the first `m_complexSize` complex points of each channel (real channels are
+            reinterpreted as packed complex, like the single channel path).
+        */
+        template <typename ChannelType>
+        void interleaveChannels(const ChannelType* const* channels, size_t numChannels) noexcept {
+            for (auto k = 0_sz; k < m_complexSize; ++k) {
+                for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                    m_batchBuff[k * numChannels + channel] = reinterpret_cast<const std::complex<ValueType>*>(channels[channel])[k];
+                }
+            }
+        }
+
+        /*
+            The reverse of `interleaveChannels`.
+        */
+        template <typename ChannelType>
+        void deinterleaveChannels(ChannelType* const* channels, size_t numChannels) noexcept {
+            for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                auto* dest = reinterpret_cast<std::complex<ValueType>*>(channels[channel]);
+                for (auto k = 0_sz; k < m_complexSize; ++k) {
+                    dest[k] = m_batchBuff[k * numChannels + channel];
+                }
+            }
+        }
+
+        const size_t m_complexSize;
+        std::shared_ptr<const ComplexPlan<ValueType>> m_plan;
+        std::shared_ptr<const std::vector<std::complex<ValueType>>> m_realTwiddleFactors{ nullptr };
+        std::vector<std::complex<ValueType>> m_workspace{};
+        std::vector<std::complex<ValueType>> m_complexScratchBuff{};
+        std::vector<std::complex<ValueType>> m_forwardInternalBuff{};
+        std::vector<SampleType> m_inverseInternalBuff{};
+        std::vector<std::complex<ValueType>> m_batchBuff{};
     };
+
 #if defined(MARVIN_MACOS) && !defined(MARVIN_FORCE_FALLBACK_FFT)
 
+    /*
+        Owns a power-of-two vDSP FFT setup. Setups are read-only once created, so one can be shared between any number of instances (and threads).
+    */
+    template <FloatType T>
+    struct AccelerateFFTSetup final {
+        using SetupType = std::conditional_t<std::is_same_v<T, float>, FFTSetup, FFTSetupD>;
+        explicit AccelerateFFTSetup(size_t order) {
+            if constexpr (std::is_same_v<T, float>) {
+                setup = vDSP_create_fftsetup(order, kFFTRadix2);
+            } else {
+                setup = vDSP_create_fftsetupD(order, kFFTRadix2);
+            }
+        }
+        AccelerateFFTSetup(const AccelerateFFTSetup&) = delete;
+        AccelerateFFTSetup& operator=(const AccelerateFFTSetup&) = delete;
+        ~AccelerateFFTSetup() noexcept {
+            if (setup) {
+                if constexpr (std::is_same_v<T, float>) {
+                    vDSP_destroy_fftsetup(setup);
+                } else {
+                    vDSP_destroy_fftsetupD(setup);
+                }
+            }
+        }
+        SetupType setup{ nullptr };
+    };
+
+    /*
+        Owns a pair of vDSP DFT setups, for non-power-of-two sizes. vDSP only handles f * 2^n for f in {1, 3, 5, 15} (and n large enough),
+        so either setup can be null - in which case the size goes through the fallback engine instead.
+    */
+    template <RealOrComplexFloatType SampleType>
+    struct AccelerateDFTSetup final {
+        using ValueType = typename getValueType<SampleType>::ValueType;
+        using SetupType = std::conditional_t<std::is_same_v<ValueType, float>, vDSP_DFT_Setup, vDSP_DFT_SetupD>;
+        explicit AccelerateDFTSetup(size_t size) {
+            if constexpr (std::is_same_v<ValueType, float>) {
+                forward = ComplexFloatType<SampleType> ? vDSP_DFT_zop_CreateSetup(nullptr, size, vDSP_DFT_FORWARD) : vDSP_DFT_zrop_CreateSetup(nullptr, size, vDSP_DFT_FORWARD);
+                inverse = ComplexFloatType<SampleType> ? vDSP_DFT_zop_CreateSetup(forward, size, vDSP_DFT_INVERSE) : vDSP_DFT_zrop_CreateSetup(forward, size, vDSP_DFT_INVERSE);
+            } else {
+                forward = ComplexFloatType<SampleType> ? vDSP_DFT_zop_CreateSetupD(nullptr, size, vDSP_DFT_FORWARD) : vDSP_DFT_zrop_CreateSetupD(nullptr, size, vDSP_DFT_FORWARD);
+                inverse = ComplexFloatType<SampleType> ? vDSP_DFT_zop_CreateSetupD(forward, size, vDSP_DFT_INVERSE) : vDSP_DFT_zrop_CreateSetupD(forward, size, vDSP_DFT_INVERSE);
+            }
+        }
+        AccelerateDFTSetup(const AccelerateDFTSetup&) = delete;
+        AccelerateDFTSetup& operator=(const AccelerateDFTSetup&) = delete;
+        ~AccelerateDFTSetup() noexcept {
+            for (auto* setup : { forward, inverse }) {
+                if (setup) {
+                    if constexpr (std::is_same_v<ValueType, float>) {
+                        vDSP_DFT_DestroySetup(setup);
+                    } else {
+                        vDSP_DFT_DestroySetupD(setup);
+                    }
+                }
+            }
+        }
+        [[nodiscard]] bool isValid() const noexcept {
+            return forward && inverse;
+        }
+        SetupType forward{ nullptr };
+        SetupType inverse{ nullptr };
+    };
+
+    template <FloatType T>
+    [[nodiscard]] static std::shared_ptr<const AccelerateFFTSetup<T>> getAccelerateFFTSetup(size_t order) {
+        static PlanCache<AccelerateFFTSetup<T>> cache;
+        return cache.get(order, [order]() { return std::make_shared<AccelerateFFTSetup<T>>(order); });
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    [[nodiscard]] static std::shared_ptr<const AccelerateDFTSetup<SampleType>> getAccelerateDFTSetup(size_t size) {
+        static PlanCache<AccelerateDFTSetup<SampleType>> cache;
+        return cache.get(size, [size]() { return std::make_shared<AccelerateDFTSetup<SampleType>>(size); });
+    }
+
     template <RealOrComplexFloatType SampleType>
     class FFT<SampleType>::Impl final : public ImplBase<SampleType> {
     public:
-        explicit Impl(size_t order) : ImplBase<SampleType>(order) {
-            if constexpr (std::is_same_v<ValueType, float>) {
-                m_setup = vDSP_create_fftsetup(this->m_order, kFFTRadix2);
+        explicit Impl(size_t size) : ImplBase<SampleType>(size) {
+            if (std::has_single_bit(size)) {
+                m_fftSetup = getAccelerateFFTSetup<ValueType>(this->m_order);
             } else {
-                m_setup = vDSP_create_fftsetupD(this->m_order, kFFTRadix2);
+                m_dftSetup = getAccelerateDFTSetup<SampleType>(size);
+                if (!m_dftSetup->isValid()) {
+                    m_fallback = std::make_unique<FallbackEngine<SampleType>>(size);
+                    return;
+                }
             }
             const auto Size = ComplexFloatType<SampleType> ? this->m_n : this->m_n / 2;
             m_fwdBuff.realp = new ValueType[Size];
@@ -80,13 +790,6 @@ namespace marvin::dsp::spectral {
         }
 
         ~Impl() noexcept override {
-            if (m_setup) {
-                if constexpr (std::same_as<ValueType, float>) {
-                    vDSP_destroy_fftsetup(m_setup);
-                } else {
-                    vDSP_destroy_fftsetupD(m_setup);
-                }
-            }
             if (m_fwdBuff.realp) {
                 delete[] m_fwdBuff.realp;
             }
@@ -102,16 +805,20 @@ namespace marvin::dsp::spectral {
         }
 
         void forward(std::span<SampleType> source, std::span<std::complex<ValueType>> dest) override {
+            if (m_fallback) {
+                m_fallback->forward(source, dest);
+                return;
+            }
             // https://developer.apple.com/documentation/accelerate/data_packing_for_fourier_transforms
             if constexpr (ComplexFloatType<SampleType>) {
                 if constexpr (std::same_as<ValueType, float>) {
                     vDSP_ctoz(reinterpret_cast<DSPComplex*>(source.data()), 2, &m_fwdBuff, 1, this->m_n);
-                    vDSP_fft_zip(m_setup, &m_fwdBuff, 1, this->m_order, kFFTDirection_Forward);
+                    transform(m_fwdBuff, m_fwdBuff, kFFTDirection_Forward);
                     std::span<ValueType> asInterleaved = math::complexViewToInterleaved<ValueType>(dest);
                     vDSP_ztoc(&m_fwdBuff, 1, (DSPComplex*)asInterleaved.data(), 2, this->m_n);
                 } else {
                     vDSP_ctozD(reinterpret_cast<DSPDoubleComplex*>(source.data()), 2, &m_fwdBuff, 1, this->m_n);
-                    vDSP_fft_zipD(m_setup, &m_fwdBuff, 1, this->m_order, kFFTDirection_Forward);
+                    transform(m_fwdBuff, m_fwdBuff, kFFTDirection_Forward);
                     auto asInterleaved = math::complexViewToInterleaved(dest);
                     vDSP_ztocD(&m_fwdBuff, 1, (DSPDoubleComplex*)asInterleaved.data(), 2, this->m_n);
                 }
@@ -119,16 +826,20 @@ namespace marvin::dsp::spectral {
                 constexpr static auto scalingFactor = static_cast<ValueType>(0.5);
                 if constexpr (std::same_as<ValueType, float>) {
                     vDSP_ctoz((DSPComplex*)source.data(), 2, &m_fwdBuff, 1, this->m_n / 2);
-                    vDSP_fft_zrip(m_setup, &m_fwdBuff, 1, this->m_order, kFFTDirection_Forward);
+                    transform(m_fwdBuff, m_fwdBuff, kFFTDirection_Forward);
                     auto asInterleaved = math::complexViewToInterleaved(dest);
                     vDSP_ztoc(&m_fwdBuff, 1, (DSPComplex*)asInterleaved.data(), 2, this->m_n / 2);
-                    vDSP_vsmul(asInterleaved.data(), 1, &scalingFactor, asInterleaved.data(), 1, this->m_n);
+                    if (this->m_scalingEnabled) {
+                        vDSP_vsmul(asInterleaved.data(), 1, &scalingFactor, asInterleaved.data(), 1, this->m_n);
+                    }
                 } else {
                     vDSP_ctozD((DSPDoubleComplex*)source.data(), 2, &m_fwdBuff, 1, this->m_n / 2);
-                    vDSP_fft_zripD(m_setup, &m_fwdBuff, 1, this->m_order, kFFTDirection_Forward);
+                    transform(m_fwdBuff, m_fwdBuff, kFFTDirection_Forward);
                     auto asInterleaved = math::complexViewToInterleaved(dest);
                     vDSP_ztocD(&m_fwdBuff, 1, (DSPDoubleComplex*)asInterleaved.data(), 2, this->m_n / 2);
-                    vDSP_vsmulD(asInterleaved.data(), 1, &scalingFactor, asInterleaved.data(), 1, this->m_n);
+                    if (this->m_scalingEnabled) {
+                        vDSP_vsmulD(asInterleaved.data(), 1, &scalingFactor, asInterleaved.data(), 1, this->m_n);
+                    }
                 }
                 dest[dest.size() - 1] = dest[0].imag();
                 dest[0] = { dest[0].real(), static_cast<ValueType>(0.0) };
@@ -136,61 +847,295 @@ namespace marvin::dsp::spectral {
         }
 
         std::span<std::complex<ValueType>> forward(std::span<SampleType> source) override {
+            if (m_fallback) {
+                return m_fallback->forward(source);
+            }
             forward(source, m_forwardInternal);
             return m_forwardInternal;
         }
 
         void inverse(std::span<std::complex<ValueType>> source, std::span<SampleType> dest) override {
+            if (m_fallback) {
+                m_fallback->inverse(source, dest);
+                return;
+            }
             const auto scalingFactor = static_cast<ValueType>(1.0) / static_cast<ValueType>(this->m_n);
             auto asInterleaved = math::complexViewToInterleaved(source);
             if constexpr (ComplexFloatType<SampleType>) {
                 auto interleavedDest = math::complexViewToInterleaved(dest);
                 if constexpr (std::same_as<ValueType, float>) {
                     vDSP_ctoz((DSPComplex*)asInterleaved.data(), 2, &m_invBuff, 1, this->m_n);
-                    vDSP_fft_zip(m_setup, &m_invBuff, 1, this->m_order, kFFTDirection_Inverse);
+                    transform(m_invBuff, m_invBuff, kFFTDirection_Inverse);
                     vDSP_ztoc(&m_invBuff, 1, (DSPComplex*)dest.data(), 2, this->m_n);
-                    vDSP_vsmul(interleavedDest.data(), 1, &scalingFactor, interleavedDest.data(), 1, this->m_n * 2);
+                    if (this->m_scalingEnabled) {
+                        vDSP_vsmul(interleavedDest.data(), 1, &scalingFactor, interleavedDest.data(), 1, this->m_n * 2);
+                    }
                 } else {
                     vDSP_ctozD((DSPDoubleComplex*)asInterleaved.data(), 2, &m_invBuff, 1, this->m_n);
-                    vDSP_fft_zipD(m_setup, &m_invBuff, 1, this->m_order, kFFTDirection_Inverse);
+                    transform(m_invBuff, m_invBuff, kFFTDirection_Inverse);
                     vDSP_ztocD(&m_invBuff, 1, (DSPDoubleComplex*)dest.data(), 2, this->m_n);
-                    vDSP_vsmulD(interleavedDest.data(), 1, &scalingFactor, interleavedDest.data(), 1, this->m_n * 2);
+                    if (this->m_scalingEnabled) {
+                        vDSP_vsmulD(interleavedDest.data(), 1, &scalingFactor, interleavedDest.data(), 1, this->m_n * 2);
+                    }
                 }
             } else {
                 source[0] = { source[0].real(), source[source.size() - 1].real() };
                 source[source.size() - 1] = static_cast<ValueType>(0.0);
                 if constexpr (std::same_as<ValueType, float>) {
                     vDSP_ctoz((DSPComplex*)asInterleaved.data(), 2, &m_invBuff, 1, this->m_n / 2);
-                    vDSP_fft_zrip(m_setup, &m_invBuff, 1, this->m_order, kFFTDirection_Inverse);
+                    transform(m_invBuff, m_invBuff, kFFTDirection_Inverse);
                     vDSP_ztoc(&m_invBuff, 1, (DSPComplex*)dest.data(), 2, this->m_n / 2);
-                    vDSP_vsmul(dest.data(), 1, &scalingFactor, dest.data(), 1, this->m_n);
+                    if (this->m_scalingEnabled) {
+                        vDSP_vsmul(dest.data(), 1, &scalingFactor, dest.data(), 1, this->m_n);
+                    }
                 } else {
                     vDSP_ctozD((DSPDoubleComplex*)asInterleaved.data(), 2, &m_invBuff, 1, this->m_n / 2);
-                    vDSP_fft_zripD(m_setup, &m_invBuff, 1, this->m_order, kFFTDirection_Inverse);
+                    transform(m_invBuff, m_invBuff, kFFTDirection_Inverse);
                     vDSP_ztocD(&m_invBuff, 1, (DSPDoubleComplex*)dest.data(), 2, this->m_n / 2);
-                    vDSP_vsmulD(dest.data(), 1, &scalingFactor, dest.data(), 1, this->m_n);
+                    if (this->m_scalingEnabled) {
+                        vDSP_vsmulD(dest.data(), 1, &scalingFactor, dest.data(), 1, this->m_n);
+                    }
                 }
             }
         }
 
         std::span<SampleType> inverse(std::span<std::complex<ValueType>> source) override {
+            if (m_fallback) {
+                return m_fallback->inverse(source);
+            }
             inverse(source, m_inverseInternal);
             return m_inverseInternal;
         }
 
+        /*
+            vDSP works on split data natively, so this transforms straight into `dest`, with no intermediate buffers.
+        */
+        void forward(std::span<SampleType> source, math::vecops::SplitComplex<ValueType> dest) override {
+            if (m_fallback) {
+                m_fallback->forward(source, dest);
+                return;
+            }
+            assert(source.size() == this->m_n);
+            const auto size = ComplexFloatType<SampleType> ? this->m_n : this->m_n / 2;
+            DSPSplitBuffType buffer{ dest.real, dest.imag };
+            packSplit(reinterpret_cast<const std::complex<ValueType>*>(source.data()), buffer, size);
+            transform(buffer, buffer, kFFTDirection_Forward);
+            if constexpr (!ComplexFloatType<SampleType>) {
+                if (this->m_scalingEnabled) {
+                    math::vecops::multiply(dest.real, static_cast<ValueType>(0.5), size);
+                    math::vecops::multiply(dest.imag, static_cast<ValueType>(0.5), size);
+                }
+                dest.real[size] = dest.imag[0];
+                dest.imag[0] = static_cast<ValueType>(0.0);
+                dest.imag[size] = static_cast<ValueType>(0.0);
+            }
+        }
+
+        /*
+            Transforms out of place from `source` into `m_invBuff`, so the only copy is the final interleave into `dest`. The real transform needs nyquist packed
+            into DC's imaginary part, which is put back once the transform's done.
+        */
+        void inverse(math::vecops::SplitComplex<ValueType> source, std::span<SampleType> dest) override {
+            if (m_fallback) {
+                m_fallback->inverse(source, dest);
+                return;
+            }
+            assert(dest.size() == this->m_n);
+            const auto size = ComplexFloatType<SampleType> ? this->m_n : this->m_n / 2;
+            DSPSplitBuffType buffer{ source.real, source.imag };
+            if constexpr (ComplexFloatType<SampleType>) {
+                transform(buffer, m_invBuff, kFFTDirection_Inverse);
+            } else {
+                const auto dcImag = source.imag[0];
+                source.imag[0] = source.real[size];
+                transform(buffer, m_invBuff, kFFTDirection_Inverse);
+                source.imag[0] = dcImag;
+            }
+            auto* complexDest = reinterpret_cast<std::complex<ValueType>*>(dest.data());
+            unpackSplit(m_invBuff, complexDest, size);
+            if (this->m_scalingEnabled) {
+                math::vecops::multiply(reinterpret_cast<ValueType*>(complexDest), this->getInverseScaling(), size * 2);
+            }
+        }
+
+        void setScalingEnabled(bool enabled) override {
+            ImplBase<SampleType>::setScalingEnabled(enabled);
+            if (m_fallback) {
+                m_fallback->setScalingEnabled(enabled);
+            }
+        }
+
+        /*
+            vDSP's real transform produces twice the spectrum of the others - see the data packing link above.
+        */
+        [[nodiscard]] ValueType getForwardScaling() const noexcept override {
+            return ComplexFloatType<SampleType> || m_fallback ? static_cast<ValueType>(1.0) : static_cast<ValueType>(0.5);
+        }
+
+        /*
+            Power-of-two sizes pack every channel into one split buffer, and transform them all with a single `vDSP_fftm_*` call. The DFT setups have no
+            multiple-signal variant, so those (and the fallback) go a channel at a time.
+        */
+        void forwardBatch(containers::BufferView<SampleType> source, containers::BufferView<std::complex<ValueType>> dest) override {
+            if (m_fallback) {
+                m_fallback->forwardBatch(source, dest);
+                return;
+            } else if (m_dftSetup) {
+                ImplBase<SampleType>::forwardBatch(source, dest);
+                return;
+            }
+            const auto numChannels = source.getNumChannels();
+            assert(dest.getNumChannels() == numChannels);
+            const auto size = ComplexFloatType<SampleType> ? this->m_n : this->m_n / 2;
+            auto batchBuff = prepareBatch(numChannels, size);
+            for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                auto channelBuff = offset(batchBuff, channel * size);
+                packSplit(reinterpret_cast<const std::complex<ValueType>*>(source[channel].data()), channelBuff, size);
+            }
+            transformBatch(batchBuff, size, numChannels, kFFTDirection_Forward);
+            for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                auto channelBuff = offset(batchBuff, channel * size);
+                auto channelDest = dest[channel];
+                unpackSplit(channelBuff, channelDest.data(), size);
+                if constexpr (!ComplexFloatType<SampleType>) {
+                    // Same scaling and nyquist unpacking as the single channel path.
+                    if (this->m_scalingEnabled) {
+                        math::vecops::multiply(reinterpret_cast<ValueType*>(channelDest.data()), static_cast<ValueType>(0.5), size * 2);
+                    }
+                    channelDest[size] = channelDest[0].imag();
+                    channelDest[0] = { channelDest[0].real(), static_cast<ValueType>(0.0) };
+                }
+            }
+        }
+
+        void inverseBatch(containers::BufferView<std::complex<ValueType>> source, containers::BufferView<SampleType> dest) override {
+            if (m_fallback) {
+                m_fallback->inverseBatch(source, dest);
+                return;
+            } else if (m_dftSetup) {
+                ImplBase<SampleType>::inverseBatch(source, dest);
+                return;
+            }
+            const auto numChannels = source.getNumChannels();
+            assert(dest.getNumChannels() == numChannels);
+            const auto size = ComplexFloatType<SampleType> ? this->m_n : this->m_n / 2;
+            auto batchBuff = prepareBatch(numChannels, size);
+            for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                auto channelBuff = offset(batchBuff, channel * size);
+                packSplit(source[channel].data(), channelBuff, size);
+                if constexpr (!ComplexFloatType<SampleType>) {
+                    // Nyquist goes back into DC's imaginary part, without touching the caller's data.
+                    channelBuff.imagp[0] = source[channel][size].real();
+                }
+            }
+            transformBatch(batchBuff, size, numChannels, kFFTDirection_Inverse);
+            const auto scalingFactor = static_cast<ValueType>(1.0) / static_cast<ValueType>(this->m_n);
+            for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                auto channelBuff = offset(batchBuff, channel * size);
+                auto* channelDest = reinterpret_cast<std::complex<ValueType>*>(dest[channel].data());
+                unpackSplit(channelBuff, channelDest, size);
+                if (this->m_scalingEnabled) {
+                    math::vecops::multiply(reinterpret_cast<ValueType*>(channelDest), scalingFactor, size * 2);
+                }
+            }
+        }
+
         [[nodiscard]] EngineType getEngineType() const noexcept override {
-            return EngineType::Accelerate_FFT;
+            return m_fallback ? EngineType::Fallback_FFT : EngineType::Accelerate_FFT;
         }
 
     private:
-        using FFTSetupType = std::conditional_t<std::is_same_v<ValueType, float>, FFTSetup, FFTSetupD>;
         using DSPSplitBuffType = std::conditional_t<std::is_same_v<ValueType, float>, DSPSplitComplex, DSPDoubleSplitComplex>;
-        FFTSetupType m_setup;
-        DSPSplitBuffType m_fwdBuff;
-        DSPSplitBuffType m_invBuff;
+
+        [[nodiscard]] static DSPSplitBuffType offset(DSPSplitBuffType buffer, size_t amount) noexcept {
+            return { buffer.realp + amount, buffer.imagp + amount };
+        }
+
+        static void packSplit(const std::complex<ValueType>* source, DSPSplitBuffType& dest, size_t size) noexcept {
+            if constexpr (std::same_as<ValueType, float>) {
+                vDSP_ctoz(reinterpret_cast<const DSPComplex*>(source), 2, &dest, 1, size);
+            } else {
+                vDSP_ctozD(reinterpret_cast<const DSPDoubleComplex*>(source), 2, &dest, 1, size);
+            }
+        }
+
+        static void unpackSplit(const DSPSplitBuffType& source, std::complex<ValueType>* dest, size_t size) noexcept {
+            if constexpr (std::same_as<ValueType, float>) {
+                vDSP_ztoc(&source, 1, reinterpret_cast<DSPComplex*>(dest), 2, size);
+            } else {
+                vDSP_ztocD(&source, 1, reinterpret_cast<DSPDoubleComplex*>(dest), 2, size);
+            }
+        }
+
+        /*
+            Grows the batch buffers to fit `numChannels` channels of `size` split points - only allocates if this is more channels than any batch before it.
+        */
+        [[nodiscard]] DSPSplitBuffType prepareBatch(size_t numChannels, size_t size) {
+            if (m_batchReal.size() < numChannels * size) {
+                m_batchReal.resize(numChannels * size);
+                m_batchImag.resize(numChannels * size);
+            }
+            return { m_batchReal.data(), m_batchImag.data() };
+        }
+
+        /*
+            In-place transform of `numChannels` consecutive `size` point signals in `buffer`.
+        */
+        void transformBatch(DSPSplitBuffType& buffer, size_t size, size_t numChannels, FFTDirection direction) noexcept {
+            const auto signalStride = static_cast<vDSP_Stride>(size);
+            if constexpr (ComplexFloatType<SampleType>) {
+                if constexpr (std::same_as<ValueType, float>) {
+                    vDSP_fftm_zip(m_fftSetup->setup, &buffer, 1, signalStride, this->m_order, numChannels, direction);
+                } else {
+                    vDSP_fftm_zipD(m_fftSetup->setup, &buffer, 1, signalStride, this->m_order, numChannels, direction);
+                }
+            } else {
+                if constexpr (std::same_as<ValueType, float>) {
+                    vDSP_fftm_zrip(m_fftSetup->setup, &buffer, 1, signalStride, this->m_order, numChannels, direction);
+                } else {
+                    vDSP_fftm_zripD(m_fftSetup->setup, &buffer, 1, signalStride, this->m_order, numChannels, direction);
+                }
+            }
+        }
+
+        /*
+            Transforms `source` into `dest`, through either the power-of-two FFT or the DFT setups. Both use the same packing and scaling.
+            `source` and `dest` may be the same buffer, in which case the FFT uses its in-place variants.
+        */
+        void transform(const DSPSplitBuffType& source, DSPSplitBuffType& dest, FFTDirection direction) noexcept {
+            const auto inPlace = source.realp == dest.realp;
+            if (m_dftSetup) {
+                const auto setup = direction == kFFTDirection_Forward ? m_dftSetup->forward : m_dftSetup->inverse;
+                if constexpr (std::same_as<ValueType, float>) {
+                    vDSP_DFT_Execute(setup, source.realp, source.imagp, dest.realp, dest.imagp);
+                } else {
+                    vDSP_DFT_ExecuteD(setup, source.realp, source.imagp, dest.realp, dest.imagp);
+                }
+            } else if constexpr (ComplexFloatType<SampleType>) {
+                if constexpr (std::same_as<ValueType, float>) {
+                    inPlace ? vDSP_fft_zip(m_fftSetup->setup, &dest, 1, this->m_order, direction) : vDSP_fft_zop(m_fftSetup->setup, &source, 1, &dest, 1, this->m_order, direction);
+                } else {
+                    inPlace ? vDSP_fft_zipD(m_fftSetup->setup, &dest, 1, this->m_order, direction) : vDSP_fft_zopD(m_fftSetup->setup, &source, 1, &dest, 1, this->m_order, direction);
+                }
+            } else {
+                if constexpr (std::same_as<ValueType, float>) {
+                    inPlace ? vDSP_fft_zrip(m_fftSetup->setup, &dest, 1, this->m_order, direction) : vDSP_fft_zrop(m_fftSetup->setup, &source, 1, &dest, 1, this->m_order, direction);
+                } else {
+                    inPlace ? vDSP_fft_zripD(m_fftSetup->setup, &dest, 1, this->m_order, direction) : vDSP_fft_zropD(m_fftSetup->setup, &source, 1, &dest, 1, this->m_order, direction);
+                }
+            }
+        }
+
+        std::shared_ptr<const AccelerateFFTSetup<ValueType>> m_fftSetup{ nullptr };
+        std::shared_ptr<const AccelerateDFTSetup<SampleType>> m_dftSetup{ nullptr };
+        std::unique_ptr<FallbackEngine<SampleType>> m_fallback{ nullptr };
+        DSPSplitBuffType m_fwdBuff{};
+        DSPSplitBuffType m_invBuff{};
         // https://developer.apple.com/documentation/accelerate/fast_fourier_transforms/data_packing_for_fourier_transforms
         std::vector<SampleType> m_inverseInternal;
         std::vector<std::complex<ValueType>> m_forwardInternal;
+        std::vector<ValueType> m_batchReal;
+        std::vector<ValueType> m_batchImag;
     };
 #elif defined(MARVIN_HAS_IPP) && !defined(MARVIN_FORCE_FALLBACK_FFT)
 
@@ -201,9 +1146,8 @@ namespace marvin::dsp::spectral {
     template <FloatType T>
     struct State<T> {
         using IppsFFTSpec = std::conditional_t<std::same_as<T, float>, IppsFFTSpec_R_32f, IppsFFTSpec_R_64f>;
+        using IppsDFTSpec = std::conditional_t<std::same_as<T, float>, IppsDFTSpec_R_32f, IppsDFTSpec_R_64f>;
         using IppsBufferType = std::conditional_t<std::is_same_v<T, float>, Ipp32f, Ipp64f>;
-        IppsFFTSpec* spec{ nullptr };
-        Ipp8u* specBuff{ nullptr };
         Ipp8u* workBuff{ nullptr };
         IppsBufferType* fwdScratchBuff{ nullptr };
         IppsBufferType* invScratchBuff{ nullptr };
@@ -213,105 +1157,125 @@ namespace marvin::dsp::spectral {
     struct State<T> {
         using ValueType = getValueType<T>::ValueType;
         using IppsFFTSpec = std::conditional_t<std::same_as<ValueType, float>, IppsFFTSpec_C_32fc, IppsFFTSpec_C_64fc>;
+        using IppsDFTSpec = std::conditional_t<std::same_as<ValueType, float>, IppsDFTSpec_C_32fc, IppsDFTSpec_C_64fc>;
         using IppsBufferType = std::conditional_t<std::same_as<ValueType, float>, Ipp32fc, Ipp64fc>;
-        IppsFFTSpec* spec{ nullptr };
-        Ipp8u* specBuff{ nullptr };
         Ipp8u* workBuff{ nullptr };
         IppsBufferType* fwdScratchBuff{ nullptr };
         IppsBufferType* invScratchBuff{ nullptr };
     };
 
-
+    /*
+        Owns an initialised IPP spec. Powers of two use IPP's FFT, anything else uses IPP's DFT, which handles arbitrary lengths.
+        Specs are read-only once initialised, so one can be shared between any number of instances (and threads) - the work buffer is per-instance,
+        and sized from `workBuffSize`. The inverse scaling is baked into the spec, so unscaled instances get a spec of their own.
+    */
     template <RealOrComplexFloatType SampleType>
-    class FFT<SampleType>::Impl final : public ImplBase<SampleType> {
-    public:
-        explicit Impl(size_t order) : ImplBase<SampleType>(order) {
+    struct IppSetup final {
+        using ValueType = typename getValueType<SampleType>::ValueType;
+        using IppsFFTSpec = typename State<SampleType>::IppsFFTSpec;
+        using IppsDFTSpec = typename State<SampleType>::IppsDFTSpec;
+        IppSetup(size_t size, bool scaled) {
             Ipp8u* initBuffer{ nullptr };
-            int fftSpecSize, fftInitBuffSize, fftWorkBuffSize;
+            int specSize, initBuffSize;
             [[maybe_unused]] IppStatus status;
+            const auto useFFT = std::has_single_bit(size);
+            const auto order = static_cast<int>(std::countr_zero(size));
+            const auto length = static_cast<int>(size);
+            const auto flag = scaled ? IPP_FFT_DIV_INV_BY_N : IPP_FFT_NODIV_BY_ANY;
+            constexpr static auto hint = ippAlgHintNone;
             if constexpr (std::same_as<ValueType, float>) {
                 if constexpr (ComplexFloatType<SampleType>) {
-                    m_state.fwdScratchBuff = ippsMalloc_32fc(static_cast<int>(this->m_n) + 2);
-                    status = ippsFFTGetSize_C_32fc(static_cast<int>(this->m_order), IPP_FFT_DIV_INV_BY_N, ippAlgHintNone, &fftSpecSize, &fftInitBuffSize, &fftWorkBuffSize);
-                    assert(status == ippStsNoErr);
-                    m_state.specBuff = ippsMalloc_8u(fftSpecSize);
-                    m_state.spec = (IppsFFTSpec_C_32fc*)m_state.specBuff;
-                    if (fftInitBuffSize != 0) {
-                        initBuffer = ippsMalloc_8u(fftInitBuffSize);
-                    }
-                    if (fftWorkBuffSize != 0) {
-                        m_state.workBuff = ippsMalloc_8u(fftWorkBuffSize);
-                    }
-                    status = ippsFFTInit_C_32fc(&m_state.spec, static_cast<int>(this->m_order), IPP_FFT_DIV_INV_BY_N, ippAlgHintNone, m_state.specBuff, initBuffer);
-                    assert(status == ippStsNoErr);
-                    if (initBuffer) {
-                        ippFree(initBuffer);
-                    }
+                    status = useFFT ? ippsFFTGetSize_C_32fc(order, flag, hint, &specSize, &initBuffSize, &workBuffSize) : ippsDFTGetSize_C_32fc(length, flag, hint, &specSize, &initBuffSize, &workBuffSize);
                 } else {
-                    m_state.fwdScratchBuff = ippsMalloc_32f(static_cast<int>(this->m_n) + 2);
-                    status = ippsFFTGetSize_R_32f(static_cast<int>(this->m_order), IPP_FFT_DIV_INV_BY_N, ippAlgHintNone, &fftSpecSize, &fftInitBuffSize, &fftWorkBuffSize);
-                    assert(status == ippStsNoErr);
-                    m_state.specBuff = ippsMalloc_8u(fftSpecSize);
-                    m_state.spec = (IppsFFTSpec_R_32f*)m_state.specBuff;
-                    if (fftInitBuffSize != 0) {
-                        initBuffer = ippsMalloc_8u(fftInitBuffSize);
-                    }
-                    if (fftWorkBuffSize != 0) {
-                        m_state.workBuff = ippsMalloc_8u(fftWorkBuffSize);
-                    }
-                    status = ippsFFTInit_R_32f(&m_state.spec, static_cast<int>(this->m_order), IPP_FFT_DIV_INV_BY_N, ippAlgHintNone, m_state.specBuff, initBuffer);
-                    assert(status == ippStsNoErr);
-                    if (initBuffer) {
-                        ippFree(initBuffer);
-                    }
+                    status = useFFT ? ippsFFTGetSize_R_32f(order, flag, hint, &specSize, &initBuffSize, &workBuffSize) : ippsDFTGetSize_R_32f(length, flag, hint, &specSize, &initBuffSize, &workBuffSize);
                 }
             } else {
                 if constexpr (ComplexFloatType<SampleType>) {
-                    m_state.fwdScratchBuff = ippsMalloc_64fc(static_cast<int>(this->m_n) + 2);
-                    status = ippsFFTGetSize_C_64fc(static_cast<int>(this->m_order), IPP_FFT_DIV_INV_BY_N, ippAlgHintNone, &fftSpecSize, &fftInitBuffSize, &fftWorkBuffSize);
-                    assert(status == ippStsNoErr);
-                    m_state.specBuff = ippsMalloc_8u(fftSpecSize);
-                    m_state.spec = (IppsFFTSpec_C_64fc*)m_state.specBuff;
-                    if (fftInitBuffSize != 0) {
-                        initBuffer = ippsMalloc_8u(fftInitBuffSize);
-                    }
-                    if (fftWorkBuffSize != 0) {
-                        m_state.workBuff = ippsMalloc_8u(fftWorkBuffSize);
-                    }
-                    status = ippsFFTInit_C_64fc(&m_state.spec, static_cast<int>(this->m_order), IPP_FFT_DIV_INV_BY_N, ippAlgHintNone, m_state.specBuff, initBuffer);
-                    assert(status == ippStsNoErr);
-                    if (initBuffer) {
-                        ippFree(initBuffer);
-                    }
+                    status = useFFT ? ippsFFTGetSize_C_64fc(order, flag, hint, &specSize, &initBuffSize, &workBuffSize) : ippsDFTGetSize_C_64fc(length, flag, hint, &specSize, &initBuffSize, &workBuffSize);
+                } else {
+                    status = useFFT ? ippsFFTGetSize_R_64f(order, flag, hint, &specSize, &initBuffSize, &workBuffSize) : ippsDFTGetSize_R_64f(length, flag, hint, &specSize, &initBuffSize, &workBuffSize);
+                }
+            }
+            assert(status == ippStsNoErr);
+            specBuff = ippsMalloc_8u(specSize);
+            if (initBuffSize != 0) {
+                initBuffer = ippsMalloc_8u(initBuffSize);
+            }
+            if (useFFT) {
+                spec = reinterpret_cast<IppsFFTSpec*>(specBuff);
+            } else {
+                dftSpec = reinterpret_cast<IppsDFTSpec*>(specBuff);
+            }
+            if constexpr (std::same_as<ValueType, float>) {
+                if constexpr (ComplexFloatType<SampleType>) {
+                    status = useFFT ? ippsFFTInit_C_32fc(&spec, order, flag, hint, specBuff, initBuffer) : ippsDFTInit_C_32fc(length, flag, hint, dftSpec, initBuffer);
+                } else {
+                    status = useFFT ? ippsFFTInit_R_32f(&spec, order, flag, hint, specBuff, initBuffer) : ippsDFTInit_R_32f(length, flag, hint, dftSpec, initBuffer);
+                }
+            } else {
+                if constexpr (ComplexFloatType<SampleType>) {
+                    status = useFFT ? ippsFFTInit_C_64fc(&spec, order, flag, hint, specBuff, initBuffer) : ippsDFTInit_C_64fc(length, flag, hint, dftSpec, initBuffer);
+                } else {
+                    status = useFFT ? ippsFFTInit_R_64f(&spec, order, flag, hint, specBuff, initBuffer) : ippsDFTInit_R_64f(length, flag, hint, dftSpec, initBuffer);
+                }
+            }
+            assert(status == ippStsNoErr);
+            if (initBuffer) {
+                ippFree(initBuffer);
+            }
+        }
+        IppSetup(const IppSetup&) = delete;
+        IppSetup& operator=(const IppSetup&) = delete;
+        ~IppSetup() noexcept {
+            if (specBuff) {
+                ippFree(specBuff);
+            }
+        }
+        IppsFFTSpec* spec{ nullptr };
+        IppsDFTSpec* dftSpec{ nullptr };
+        Ipp8u* specBuff{ nullptr };
+        int workBuffSize{ 0 };
+    };
+
+    template <RealOrComplexFloatType SampleType>
+    [[nodiscard]] static std::shared_ptr<const IppSetup<SampleType>> getIppSetup(size_t size, bool scaled) {
+        static PlanCache<IppSetup<SampleType>> cache;
+        return cache.get(size * 2 + (scaled ? 0 : 1), [size, scaled]() { return std::make_shared<IppSetup<SampleType>>(size, scaled); });
+    }
+
 
+    template <RealOrComplexFloatType SampleType>
+    class FFT<SampleType>::Impl final : public ImplBase<SampleType> {
+    public:
+        explicit Impl(size_t size) : ImplBase<SampleType>(size), m_setup(getIppSetup<SampleType>(size, true)) {
+            const auto length = static_cast<int>(size);
+            if constexpr (std::same_as<ValueType, float>) {
+                if constexpr (ComplexFloatType<SampleType>) {
+                    m_state.fwdScratchBuff = ippsMalloc_32fc(length + 2);
+                    m_state.invScratchBuff = ippsMalloc_32fc(length);
                 } else {
-                    m_state.fwdScratchBuff = ippsMalloc_64f(static_cast<int>(this->m_n) + 2);
-                    status = ippsFFTGetSize_R_64f(static_cast<int>(this->m_order), IPP_FFT_DIV_INV_BY_N, ippAlgHintNone, &fftSpecSize, &fftInitBuffSize, &fftWorkBuffSize);
-                    assert(status == ippStsNoErr);
-                    m_state.specBuff = ippsMalloc_8u(fftSpecSize);
-                    m_state.spec = (IppsFFTSpec_R_64f*)m_state.specBuff;
-                    if (fftInitBuffSize != 0) {
-                        initBuffer = ippsMalloc_8u(fftInitBuffSize);
-                    }
-                    if (fftWorkBuffSize != 0) {
-                        m_state.workBuff = ippsMalloc_8u(fftWorkBuffSize);
-                    }
-                    status = ippsFFTInit_R_64f(&m_state.spec, static_cast<int>(this->m_order), IPP_FFT_DIV_INV_BY_N, ippAlgHintNone, m_state.specBuff, initBuffer);
-                    assert(status == ippStsNoErr);
-                    if (initBuffer) {
-                        ippFree(initBuffer);
-                    }
+                    m_state.fwdScratchBuff = ippsMalloc_32f(length + 2);
+                    m_state.invScratchBuff = ippsMalloc_32f(length);
+                }
+            } else {
+                if constexpr (ComplexFloatType<SampleType>) {
+                    m_state.fwdScratchBuff = ippsMalloc_64fc(length + 2);
+                    m_state.invScratchBuff = ippsMalloc_64fc(length);
+                } else {
+                    m_state.fwdScratchBuff = ippsMalloc_64f(length + 2);
+                    m_state.invScratchBuff = ippsMalloc_64f(length);
                 }
             }
+            if (m_setup->workBuffSize != 0) {
+                m_state.workBuff = ippsMalloc_8u(m_setup->workBuffSize);
+                m_workBuffSize = m_setup->workBuffSize;
+            }
         }
 
         ~Impl() noexcept override {
             if (m_state.workBuff) {
                 ippFree(m_state.workBuff);
             }
-            if (m_state.specBuff) {
-                ippFree(m_state.specBuff);
-            }
             if (m_state.fwdScratchBuff) {
                 ippFree(m_state.fwdScratchBuff);
             }
@@ -321,6 +1285,8 @@ namespace marvin::dsp::spectral {
         }
 
         void forward(std::span<SampleType> source, std::span<std::complex<ValueType>> dest) override {
+            [[maybe_unused]] IppStatus status;
+            const auto useFFT = m_setup->spec != nullptr;
             if constexpr (ComplexFloatType<SampleType>) {
                 assert(source.size() == dest.size());
                 assert(dest.size() == this->m_n);
@@ -328,24 +1294,21 @@ namespace marvin::dsp::spectral {
                 auto* srcPtr = reinterpret_cast<ComplexPointer>(source.data());
                 auto* dstPtr = reinterpret_cast<ComplexPointer>(dest.data());
                 if constexpr (std::same_as<ValueType, float>) {
-                    [[maybe_unused]] const auto status = ippsFFTFwd_CToC_32fc(srcPtr, dstPtr, m_state.spec, m_state.workBuff);
-                    assert(status == ippStsNoErr);
+                    status = useFFT ? ippsFFTFwd_CToC_32fc(srcPtr, dstPtr, m_setup->spec, m_state.workBuff) : ippsDFTFwd_CToC_32fc(srcPtr, dstPtr, m_setup->dftSpec, m_state.workBuff);
                 } else {
-                    [[maybe_unused]] const auto status = ippsFFTFwd_CToC_64fc(srcPtr, dstPtr, m_state.spec, m_state.workBuff);
-                    assert(status == ippStsNoErr);
+                    status = useFFT ? ippsFFTFwd_CToC_64fc(srcPtr, dstPtr, m_setup->spec, m_state.workBuff) : ippsDFTFwd_CToC_64fc(srcPtr, dstPtr, m_setup->dftSpec, m_state.workBuff);
                 }
             } else {
                 assert(source.size() == this->m_n);
                 assert(dest.size() == (this->m_n / 2) + 1);
                 auto asInterleaved = math::complexViewToInterleaved(dest);
                 if constexpr (std::same_as<ValueType, float>) {
-                    [[maybe_unused]] const auto status = ippsFFTFwd_RToCCS_32f(source.data(), asInterleaved.data(), m_state.spec, m_state.workBuff);
-                    assert(status == ippStsNoErr);
+                    status = useFFT ? ippsFFTFwd_RToCCS_32f(source.data(), asInterleaved.data(), m_setup->spec, m_state.workBuff) : ippsDFTFwd_RToCCS_32f(source.data(), asInterleaved.data(), m_setup->dftSpec, m_state.workBuff);
                 } else {
-                    [[maybe_unused]] const auto status = ippsFFTFwd_RToCCS_64f(source.data(), asInterleaved.data(), m_state.spec, m_state.workBuff);
-                    assert(status == ippStsNoErr);
+                    status = useFFT ? ippsFFTFwd_RToCCS_64f(source.data(), asInterleaved.data(), m_setup->spec, m_state.workBuff) : ippsDFTFwd_RToCCS_64f(source.data(), asInterleaved.data(), m_setup->dftSpec, m_state.workBuff);
                 }
             }
+            assert(status == ippStsNoErr);
         }
 
         std::span<std::complex<ValueType>> forward(std::span<SampleType> source) override {
@@ -361,6 +1324,8 @@ namespace marvin::dsp::spectral {
         }
 
         void inverse(std::span<std::complex<ValueType>> source, std::span<SampleType> dest) override {
+            [[maybe_unused]] IppStatus status;
+            const auto useFFT = m_setup->spec != nullptr;
             if constexpr (ComplexFloatType<SampleType>) {
                 assert(source.size() == dest.size());
                 assert(dest.size() == this->m_n);
@@ -368,24 +1333,21 @@ namespace marvin::dsp::spectral {
                 auto* srcPtr = reinterpret_cast<ComplexPointer>(source.data());
                 auto* dstPtr = reinterpret_cast<ComplexPointer>(dest.data());
                 if constexpr (std::same_as<ValueType, float>) {
-                    [[maybe_unused]] const auto status = ippsFFTInv_CToC_32fc(srcPtr, dstPtr, m_state.spec, m_state.workBuff);
-                    assert(status == ippStsNoErr);
+                    status = useFFT ? ippsFFTInv_CToC_32fc(srcPtr, dstPtr, m_setup->spec, m_state.workBuff) : ippsDFTInv_CToC_32fc(srcPtr, dstPtr, m_setup->dftSpec, m_state.workBuff);
                 } else {
-                    [[maybe_unused]] const auto status = ippsFFTInv_CToC_64fc(srcPtr, dstPtr, m_state.spec, m_state.workBuff);
-                    assert(status == ippStsNoErr);
+                    status = useFFT ? ippsFFTInv_CToC_64fc(srcPtr, dstPtr, m_setup->spec, m_state.workBuff) : ippsDFTInv_CToC_64fc(srcPtr, dstPtr, m_setup->dftSpec, m_state.workBuff);
                 }
             } else {
                 assert(source.size() == (this->m_n / 2) + 1);
                 assert(dest.size() == this->m_n);
                 auto asInterleaved = math::complexViewToInterleaved(source);
                 if constexpr (std::same_as<ValueType, float>) {
-                    [[maybe_unused]] const auto status = ippsFFTInv_CCSToR_32f(asInterleaved.data(), dest.data(), m_state.spec, m_state.workBuff);
-                    assert(status == ippStsNoErr);
+                    status = useFFT ? ippsFFTInv_CCSToR_32f(asInterleaved.data(), dest.data(), m_setup->spec, m_state.workBuff) : ippsDFTInv_CCSToR_32f(asInterleaved.data(), dest.data(), m_setup->dftSpec, m_state.workBuff);
                 } else {
-                    [[maybe_unused]] const auto status = ippsFFTInv_CCSToR_64f(asInterleaved.data(), dest.data(), m_state.spec, m_state.workBuff);
-                    assert(status == ippStsNoErr);
+                    status = useFFT ? ippsFFTInv_CCSToR_64f(asInterleaved.data(), dest.data(), m_setup->spec, m_state.workBuff) : ippsDFTInv_CCSToR_64f(asInterleaved.data(), dest.data(), m_setup->dftSpec, m_state.workBuff);
                 }
             }
+            assert(status == ippStsNoErr);
         }
 
         std::span<SampleType> inverse(std::span<std::complex<ValueType>> source) override {
@@ -394,143 +1356,114 @@ namespace marvin::dsp::spectral {
             return destView;
         }
 
-
-        [[nodiscard]] EngineType getEngineType() const noexcept override {
-            return EngineType::Ipp_FFT;
-        }
-
-    private:
-        State<SampleType> m_state;
-    };
-#else
-    template <RealOrComplexFloatType SampleType>
-    class FFT<SampleType>::Impl final : public ImplBase<SampleType> {
-    public:
-        explicit Impl(size_t order) : ImplBase<SampleType>(order) {
-            constexpr static auto twoPi = std::numbers::pi_v<ValueType> * static_cast<ValueType>(2.0);
-            m_complexScratchBuff.resize(this->m_n);
-            m_forwardInternalBuff.resize(this->m_n);
-            m_inverseInternalBuff.resize(this->m_n);
-            m_inverseComplexBuff.resize(this->m_n);
-            m_workingBuff.resize(this->m_n);
-            std::fill(m_complexScratchBuff.begin(), m_complexScratchBuff.end(), static_cast<SampleType>(0.0));
-            for (auto i = 0_sz; i < this->m_n / 2; ++i) {
-                const auto phase = -twoPi * (static_cast<ValueType>(i) / static_cast<ValueType>(this->m_n));
-                m_twiddleFactors.emplace_back(std::cos(phase), std::sin(phase));
+        /*
+            The FFT has in-place variants, the DFT doesn't - so that goes through the scratch buffers instead.
+        */
+        void forwardInPlace(std::span<std::complex<ValueType>> data) override {
+            assert(data.size() == this->getNumBins());
+            if (!m_setup->spec) {
+                const auto result = forward(std::span<SampleType>{ reinterpret_cast<SampleType*>(data.data()), this->m_n });
+                std::copy(result.begin(), result.end(), data.begin());
+                return;
             }
-        }
-
-        ~Impl() noexcept override = default;
-
-        void forward(std::span<SampleType> source, std::span<std::complex<ValueType>> dest) override {
+            [[maybe_unused]] IppStatus status;
             if constexpr (ComplexFloatType<SampleType>) {
-                assert(source.size() == dest.size());
-                assert(source.size() == this->m_n);
-                butterfly<1, false>(this->m_n, source, dest, m_workingBuff);
+                if constexpr (std::same_as<ValueType, float>) {
+                    status = ippsFFTFwd_CToC_32fc_I(reinterpret_cast<Ipp32fc*>(data.data()), m_setup->spec, m_state.workBuff);
+                } else {
+                    status = ippsFFTFwd_CToC_64fc_I(reinterpret_cast<Ipp64fc*>(data.data()), m_setup->spec, m_state.workBuff);
+                }
             } else {
-                assert(dest.size() == (this->m_n / 2) + 1);
-                fillComplexScratch(source);
-                butterfly<1, false>(this->m_n, m_complexScratchBuff, m_forwardInternalBuff, m_workingBuff);
-                // Only need (N / 2) + 1 values....
-                std::memcpy(dest.data(), m_forwardInternalBuff.data(), sizeof(std::complex<ValueType>) * ((this->m_n / 2) + 1));
+                if constexpr (std::same_as<ValueType, float>) {
+                    status = ippsFFTFwd_RToCCS_32f_I(reinterpret_cast<Ipp32f*>(data.data()), m_setup->spec, m_state.workBuff);
+                } else {
+                    status = ippsFFTFwd_RToCCS_64f_I(reinterpret_cast<Ipp64f*>(data.data()), m_setup->spec, m_state.workBuff);
+                }
             }
+            assert(status == ippStsNoErr);
         }
 
-        std::span<std::complex<ValueType>> forward(std::span<SampleType> source) override {
-            if constexpr (ComplexFloatType<SampleType>) {
-                forward(source, m_forwardInternalBuff);
-                return m_forwardInternalBuff;
-            } else {
-                std::span<std::complex<ValueType>> destView{ m_forwardInternalBuff.data(), (this->m_n / 2) + 1 };
-                forward(source, destView);
-                return destView;
+        void inverseInPlace(std::span<std::complex<ValueType>> data) override {
+            assert(data.size() == this->getNumBins());
+            if (!m_setup->spec) {
+                const auto result = inverse(data);
+                std::copy(result.begin(), result.end(), reinterpret_cast<SampleType*>(data.data()));
+                return;
             }
-        }
-
-        void inverse(std::span<std::complex<ValueType>> source, std::span<SampleType> dest) override {
-            const auto normalisationFactor = static_cast<ValueType>(1.0) / static_cast<ValueType>(this->m_n);
+            [[maybe_unused]] IppStatus status;
             if constexpr (ComplexFloatType<SampleType>) {
-                assert(source.size() == dest.size());
-                assert(dest.size() == this->m_n);
-                auto interleavedDest = marvin::math::complexViewToInterleaved(dest);
-                butterfly<1, true>(this->m_n, source, dest, m_workingBuff);
-                math::vecops::multiply(interleavedDest.data(), normalisationFactor, this->m_n * 2);
-            } else {
-                assert(source.size() == (this->m_n / 2) + 1);
-                assert(dest.size() == this->m_n);
-                std::memcpy(m_complexScratchBuff.data(), source.data(), sizeof(std::complex<ValueType>) * source.size());
-                // Now - the remaining values should be conjugated..
-                const auto nyquistIdx{ this->m_n / 2 };
-                for (auto i = 1_sz; i < this->m_n / 2; ++i) {
-                    const auto negativeIndex = nyquistIdx + i;
-                    const auto positiveIndex = nyquistIdx - i;
-                    m_complexScratchBuff[negativeIndex] = std::conj(m_complexScratchBuff[positiveIndex]);
+                if constexpr (std::same_as<ValueType, float>) {
+                    status = ippsFFTInv_CToC_32fc_I(reinterpret_cast<Ipp32fc*>(data.data()), m_setup->spec, m_state.workBuff);
+                } else {
+                    status = ippsFFTInv_CToC_64fc_I(reinterpret_cast<Ipp64fc*>(data.data()), m_setup->spec, m_state.workBuff);
                 }
-                butterfly<1, true>(this->m_n, m_complexScratchBuff, m_inverseComplexBuff, m_workingBuff);
-                for (auto i = 0_sz; i < this->m_n; ++i) {
-                    dest[i] = m_inverseComplexBuff[i].real() * normalisationFactor;
+            } else {
+                if constexpr (std::same_as<ValueType, float>) {
+                    status = ippsFFTInv_CCSToR_32f_I(reinterpret_cast<Ipp32f*>(data.data()), m_setup->spec, m_state.workBuff);
+                } else {
+                    status = ippsFFTInv_CCSToR_64f_I(reinterpret_cast<Ipp64f*>(data.data()), m_setup->spec, m_state.workBuff);
                 }
             }
+            assert(status == ippStsNoErr);
         }
 
-        std::span<SampleType> inverse(std::span<std::complex<ValueType>> source) override {
-            inverse(source, m_inverseInternalBuff);
-            return m_inverseInternalBuff;
+        /*
+            IPP's split complex FFTs need a separate spec type (and have no real-to-split variant), so these deinterleave through the forward scratch buffer instead.
+        */
+        void forward(std::span<SampleType> source, math::vecops::SplitComplex<ValueType> dest) override {
+            const auto result = forward(source);
+            interleavedToSplit(result.data(), dest, result.size());
         }
 
-
-        [[nodiscard]] EngineType getEngineType() const noexcept override {
-            return EngineType::Fallback_FFT;
+        void inverse(math::vecops::SplitComplex<ValueType> source, std::span<SampleType> dest) override {
+            std::span<std::complex<ValueType>> complexView{ reinterpret_cast<std::complex<ValueType>*>(m_state.fwdScratchBuff), this->getNumBins() };
+            splitToInterleaved(source, complexView.data(), complexView.size());
+            inverse(complexView, dest);
         }
 
-
-    private:
-        void fillComplexScratch(std::span<SampleType> input) {
-            for (auto i = 0_sz; i < input.size(); ++i) {
-                m_complexScratchBuff[i] = input[i];
-            }
-        }
-
-
-        template <size_t Stride, bool Inverse>
-        void butterfly(size_t size, std::span<std::complex<ValueType>> input, std::span<std::complex<ValueType>> output, std::span<std::complex<ValueType>> working) {
-            const auto halfSize = size / 2;
-            if (size > 2) {
-                butterfly<Stride * 2, Inverse>(halfSize, input, working, output);
-                input = working;
-            }
-            for (auto i = 0_sz; i < halfSize; ++i) {
-                const auto ipAOffset = 2 * i * Stride;
-                const auto ipBOffset = (2 * i + 1) * Stride;
-                const auto opAOffset = i * Stride;
-                const auto opBOffset = (i + halfSize) * Stride;
-                const auto tfStep = m_twiddleFactors.size() * 2 / size;
-                for (auto j = 0_sz; j < Stride; ++j) {
-                    const auto tfIndex = i * tfStep;
-                    auto twiddleFactor = m_twiddleFactors[tfIndex];
-                    if constexpr (Inverse) {
-                        twiddleFactor = std::conj(twiddleFactor);
-                    }
-                    const auto a = input[ipAOffset + j];
-                    const auto b = twiddleFactor * input[ipBOffset + j];
-                    output[opAOffset + j] = a + b;
-                    output[opBOffset + j] = a - b;
+        /*
+            Swaps to the (shared) spec with the right scaling baked in, growing the work buffer if the new spec needs a bigger one.
+        */
+        void setScalingEnabled(bool enabled) override {
+            ImplBase<SampleType>::setScalingEnabled(enabled);
+            m_setup = getIppSetup<SampleType>(this->m_n, enabled);
+            if (m_setup->workBuffSize > m_workBuffSize) {
+                if (m_state.workBuff) {
+                    ippFree(m_state.workBuff);
                 }
+                m_state.workBuff = ippsMalloc_8u(m_setup->workBuffSize);
+                m_workBuffSize = m_setup->workBuffSize;
             }
         }
 
-        std::vector<std::complex<ValueType>> m_twiddleFactors;
-        std::vector<std::complex<ValueType>> m_workingBuff{};
-        std::vector<std::complex<ValueType>> m_complexScratchBuff{};
-        std::vector<std::complex<ValueType>> m_forwardInternalBuff{};
-        std::vector<SampleType> m_inverseInternalBuff{};
-        std::vector<std::complex<ValueType>> m_inverseComplexBuff{};
+
+        [[nodiscard]] EngineType getEngineType() const noexcept override {
+            return EngineType::Ipp_FFT;
+        }
+
+    private:
+        std::shared_ptr<const IppSetup<SampleType>> m_setup;
+        State<SampleType> m_state;
+        int m_workBuffSize{ 0 };
+    };
+#else
+    template <RealOrComplexFloatType SampleType>
+    class FFT<SampleType>::Impl final : public FallbackEngine<SampleType> {
+    public:
+        using FallbackEngine<SampleType>::FallbackEngine;
     };
 #endif
 
     template <RealOrComplexFloatType SampleType>
     FFT<SampleType>::FFT(size_t order) {
-        m_impl = std::make_unique<FFT<SampleType>::Impl>(order);
+        m_impl = std::make_unique<FFT<SampleType>::Impl>(1_sz << order);
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    FFT<SampleType>::FFT(FFTSize size) {
+        assert(size.size != 0);
+        assert(ComplexFloatType<SampleType> || size.size % 2 == 0);
+        m_impl = std::make_unique<FFT<SampleType>::Impl>(size.size);
     }
 
     template <RealOrComplexFloatType SampleType>
@@ -567,6 +1500,51 @@ namespace marvin::dsp::spectral {
         return m_impl->inverse(source);
     }
 
+    template <RealOrComplexFloatType SampleType>
+    void FFT<SampleType>::forwardBatch(containers::BufferView<SampleType> source, containers::BufferView<std::complex<ValueType>> dest) {
+        m_impl->forwardBatch(source, dest);
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    void FFT<SampleType>::inverseBatch(containers::BufferView<std::complex<ValueType>> source, containers::BufferView<SampleType> dest) {
+        m_impl->inverseBatch(source, dest);
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    void FFT<SampleType>::forwardInPlace(std::span<std::complex<ValueType>> data) {
+        m_impl->forwardInPlace(data);
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    void FFT<SampleType>::inverseInPlace(std::span<std::complex<ValueType>> data) {
+        m_impl->inverseInPlace(data);
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    void FFT<SampleType>::forward(std::span<SampleType> source, math::vecops::SplitComplex<ValueType> dest) {
+        m_impl->forward(source, dest);
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    void FFT<SampleType>::inverse(math::vecops::SplitComplex<ValueType> source, std::span<SampleType> dest) {
+        m_impl->inverse(source, dest);
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    void FFT<SampleType>::setScalingEnabled(bool enabled) {
+        m_impl->setScalingEnabled(enabled);
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    typename FFT<SampleType>::ValueType FFT<SampleType>::getForwardScaling() const noexcept {
+        return m_impl->getForwardScaling();
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    typename FFT<SampleType>::ValueType FFT<SampleType>::getInverseScaling() const noexcept {
+        return m_impl->getInverseScaling();
+    }
+
 
     template class FFT<float>;
     template class FFT<std::complex<float>>;
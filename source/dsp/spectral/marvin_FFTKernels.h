@@ -0,0 +1,302 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_FFTKERNELS_H
+#define MARVIN_FFTKERNELS_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/library/marvin_Literals.h"
+#include "utils/marvin_SIMDDispatchImpl.h"
+#include <xsimd/xsimd.hpp>
+#include <complex>
+namespace marvin::dsp::spectral::kernels {
+    /*
+        Scalar complex arithmetic for the leftover butterflies. Used instead of `std::complex`, whose operators aren't templated on the arch, and so would
+        have their instantiations shared with the baseline TUs. Same layout as `std::complex<T>`, which it's loaded from and stored to.
+    */
+    template <class Arch, FloatType T>
+    struct ScalarComplex final {
+        T re;
+        T im;
+
+        [[nodiscard]] static ScalarComplex load(const std::complex<T>* source) noexcept {
+            const auto* values = reinterpret_cast<const T*>(source);
+            return { values[0], values[1] };
+        }
+
+        void store(std::complex<T>* dest) const noexcept {
+            auto* values = reinterpret_cast<T*>(dest);
+            values[0] = re;
+            values[1] = im;
+        }
+
+        [[nodiscard]] T real() const noexcept {
+            return re;
+        }
+
+        [[nodiscard]] T imag() const noexcept {
+            return im;
+        }
+
+        [[nodiscard]] ScalarComplex operator+(const ScalarComplex& other) const noexcept {
+            return { re + other.re, im + other.im };
+        }
+
+        [[nodiscard]] ScalarComplex operator-(const ScalarComplex& other) const noexcept {
+            return { re - other.re, im - other.im };
+        }
+
+        [[nodiscard]] ScalarComplex operator*(const ScalarComplex& other) const noexcept {
+            return { re * other.re - im * other.im, re * other.im + im * other.re };
+        }
+    };
+
+    /*
+        Multiplies by -j for the forward transform, or +j for the inverse. Works on both `ScalarComplex` and complex `xsimd::batch`es.
+    */
+    template <class Arch, bool Inverse, typename ComplexType>
+    [[nodiscard]] inline ComplexType rotateQuarter(const ComplexType& x) noexcept {
+        if constexpr (Inverse) {
+            return { -x.imag(), x.real() };
+        } else {
+            return { x.imag(), -x.real() };
+        }
+    }
+
+    /*
+        Multiplies a complex (or complex batch) by a real scalar.
+    */
+    template <class Arch, typename ComplexType, FloatType T>
+    [[nodiscard]] inline ComplexType scale(const ComplexType& x, T scalar) noexcept {
+        return { x.real() * scalar, x.imag() * scalar };
+    }
+
+    /*
+        cos and sin of `2 * pi * k / Radix`, for k in [1, Radix / 2]. Only needed for the odd radices.
+    */
+    template <size_t Radix>
+    struct RootsOfUnity;
+
+    template <>
+    struct RootsOfUnity<3> {
+        constexpr static double cos[]{ -0.5 };
+        constexpr static double sin[]{ 0.86602540378443864676 };
+    };
+
+    template <>
+    struct RootsOfUnity<5> {
+        constexpr static double cos[]{ 0.30901699437494742410, -0.80901699437494742410 };
+        constexpr static double sin[]{ 0.95105651629515357212, 0.58778525229247312917 };
+    };
+
+    template <>
+    struct RootsOfUnity<7> {
+        constexpr static double cos[]{ 0.62348980185873353053, -0.22252093395631440429, -0.90096886790241912624 };
+        constexpr static double sin[]{ 0.78183148246802980871, 0.97492791218182360702, 0.43388373911755812048 };
+    };
+
+    /*
+        In-place `Radix` point DFT of `x`. Radix 2 and 4 are the usual butterflies, the odd radices pair up bins `k` and `Radix - k`,
+        which share their cosine terms and negate their sine terms.
+    */
+    template <class Arch, size_t Radix, bool Inverse, FloatType T, typename ComplexType>
+    inline void smallDFT(ComplexType (&x)[Radix]) noexcept {
+        if constexpr (Radix == 2) {
+            const auto a = x[0];
+            x[0] = a + x[1];
+            x[1] = a - x[1];
+        } else if constexpr (Radix == 4) {
+            const auto apc = x[0] + x[2];
+            const auto amc = x[0] - x[2];
+            const auto bpd = x[1] + x[3];
+            const auto jbmd = rotateQuarter<Arch, Inverse>(x[1] - x[3]);
+            x[0] = apc + bpd;
+            x[1] = amc + jbmd;
+            x[2] = apc - bpd;
+            x[3] = amc - jbmd;
+        } else {
+            constexpr static auto Half = Radix / 2;
+            using Roots = RootsOfUnity<Radix>;
+            ComplexType sums[Half];
+            ComplexType diffs[Half];
+            auto dc = x[0];
+            for (auto m = 1_sz; m <= Half; ++m) {
+                sums[m - 1] = x[m] + x[Radix - m];
+                diffs[m - 1] = x[m] - x[Radix - m];
+                dc = dc + sums[m - 1];
+            }
+            for (auto k = 1_sz; k <= Half; ++k) {
+                auto re = x[0];
+                ComplexType im;
+                for (auto m = 1_sz; m <= Half; ++m) {
+                    // cos / sin of 2 * pi * (m * k mod Radix) / Radix, folded back into the first half.
+                    const auto j = (m * k) % Radix;
+                    const auto index = (j <= Half ? j : Radix - j) - 1;
+                    const auto c = static_cast<T>(Roots::cos[index]);
+                    const auto s = static_cast<T>(j <= Half ? Roots::sin[index] : -Roots::sin[index]);
+                    re = re + scale<Arch>(sums[m - 1], c);
+                    im = m == 1 ? scale<Arch>(diffs[0], s) : im + scale<Arch>(diffs[m - 1], s);
+                }
+                const auto rotated = rotateQuarter<Arch, Inverse>(im);
+                x[k] = re + rotated;
+                x[Radix - k] = re - rotated;
+            }
+            x[0] = dc;
+        }
+    }
+
+    /*
+        One pass of a mixed radix Stockham autosort transform. `n` is the length of the sub-transforms at this pass, and `stride` is the product of the
+        radices of the passes before it. `twiddles` holds `Radix - 1` planar arrays of `n / Radix` values, the `j`th being `W_n^(j * p)`, always for the forward
+        direction - the inverse conjugates them on the fly.
+        When `stride` spans at least a full batch, the butterflies are vectorised across `stride` with the twiddles broadcast. The first pass (`stride == 1`)
+        is vectorised across `p` instead, with a scalar scatter on the way out. Anything left over runs scalar.
+        `src` and `dest` must not alias.
+    */
+    template <class Arch, FloatType T, size_t Radix, bool Inverse>
+    void radixPass(const std::complex<T>* src, std::complex<T>* dest, const std::complex<T>* twiddles, size_t n, size_t stride) noexcept {
+        using ComplexBatch = xsimd::batch<std::complex<T>, Arch>;
+        using RealBatch = xsimd::batch<T, Arch>;
+        using Complex = ScalarComplex<Arch, T>;
+        constexpr static auto simdSize = ComplexBatch::size;
+        const auto m = n / Radix;
+        const auto butterfly = []<typename ComplexType>(ComplexType (&x)[Radix], const ComplexType (&w)[Radix - 1]) {
+            smallDFT<Arch, Radix, Inverse, T>(x);
+            for (auto j = 1_sz; j < Radix; ++j) {
+                x[j] = x[j] * w[j - 1];
+            }
+        };
+        const auto loadTwiddles = [twiddles, m](size_t p, Complex (&w)[Radix - 1]) {
+            for (auto j = 0_sz; j < Radix - 1; ++j) {
+                w[j] = Complex::load(twiddles + j * m + p);
+                if constexpr (Inverse) {
+                    w[j].im = -w[j].im;
+                }
+            }
+        };
+        const auto scalarButterflies = [&](size_t p, size_t qStart) {
+            Complex w[Radix - 1];
+            loadTwiddles(p, w);
+            const auto* x = src + stride * p;
+            auto* y = dest + stride * p * Radix;
+            Complex values[Radix];
+            for (auto q = qStart; q < stride; ++q) {
+                for (auto j = 0_sz; j < Radix; ++j) {
+                    values[j] = Complex::load(x + q + stride * m * j);
+                }
+                butterfly(values, w);
+                for (auto j = 0_sz; j < Radix; ++j) {
+                    values[j].store(y + q + stride * j);
+                }
+            }
+        };
+        if (stride >= simdSize) {
+            const auto vecSize = stride - stride % simdSize;
+            for (auto p = 0_sz; p < m; ++p) {
+                Complex w[Radix - 1];
+                loadTwiddles(p, w);
+                ComplexBatch wb[Radix - 1];
+                for (auto j = 0_sz; j < Radix - 1; ++j) {
+                    wb[j] = ComplexBatch{ RealBatch(w[j].re), RealBatch(w[j].im) };
+                }
+                const auto* x = src + stride * p;
+                auto* y = dest + stride * p * Radix;
+                ComplexBatch values[Radix];
+                for (auto q = 0_sz; q < vecSize; q += simdSize) {
+                    for (auto j = 0_sz; j < Radix; ++j) {
+                        values[j] = ComplexBatch::load_unaligned(x + q + stride * m * j);
+                    }
+                    butterfly(values, wb);
+                    for (auto j = 0_sz; j < Radix; ++j) {
+                        values[j].store_unaligned(y + q + stride * j);
+                    }
+                }
+                scalarButterflies(p, vecSize);
+            }
+        } else if (stride == 1 && m >= simdSize) {
+            const auto vecSize = m - m % simdSize;
+            // Planar real / imag scratch for the scatter, so it can be copied a `T` at a time.
+            T scratchReal[Radix][simdSize];
+            T scratchImag[Radix][simdSize];
+            ComplexBatch values[Radix];
+            ComplexBatch wb[Radix - 1];
+            for (auto p = 0_sz; p < vecSize; p += simdSize) {
+                for (auto j = 0_sz; j < Radix; ++j) {
+                    values[j] = ComplexBatch::load_unaligned(src + p + m * j);
+                }
+                for (auto j = 0_sz; j < Radix - 1; ++j) {
+                    wb[j] = ComplexBatch::load_unaligned(twiddles + j * m + p);
+                    if constexpr (Inverse) {
+                        wb[j] = xsimd::conj(wb[j]);
+                    }
+                }
+                butterfly(values, wb);
+                for (auto j = 0_sz; j < Radix; ++j) {
+                    values[j].real().store_unaligned(scratchReal[j]);
+                    values[j].imag().store_unaligned(scratchImag[j]);
+                }
+                auto* y = reinterpret_cast<T*>(dest + p * Radix);
+                for (auto i = 0_sz; i < simdSize; ++i) {
+                    for (auto j = 0_sz; j < Radix; ++j) {
+                        y[(i * Radix + j) * 2] = scratchReal[j][i];
+                        y[(i * Radix + j) * 2 + 1] = scratchImag[j][i];
+                    }
+                }
+            }
+            for (auto p = vecSize; p < m; ++p) {
+                scalarButterflies(p, 0);
+            }
+        } else {
+            for (auto p = 0_sz; p < m; ++p) {
+                scalarButterflies(p, 0);
+            }
+        }
+    }
+
+    template <FloatType T>
+    struct FFTKernels {
+        using Pass = void (*)(const std::complex<T>*, std::complex<T>*, const std::complex<T>*, size_t, size_t) noexcept;
+        Pass radix2Forward;
+        Pass radix2Inverse;
+        Pass radix3Forward;
+        Pass radix3Inverse;
+        Pass radix4Forward;
+        Pass radix4Inverse;
+        Pass radix5Forward;
+        Pass radix5Inverse;
+        Pass radix7Forward;
+        Pass radix7Inverse;
+    };
+
+    template <class Arch, FloatType T>
+    [[nodiscard]] FFTKernels<T> getFFTKernels() noexcept {
+        return {
+            .radix2Forward = &radixPass<Arch, T, 2, false>,
+            .radix2Inverse = &radixPass<Arch, T, 2, true>,
+            .radix3Forward = &radixPass<Arch, T, 3, false>,
+            .radix3Inverse = &radixPass<Arch, T, 3, true>,
+            .radix4Forward = &radixPass<Arch, T, 4, false>,
+            .radix4Inverse = &radixPass<Arch, T, 4, true>,
+            .radix5Forward = &radixPass<Arch, T, 5, false>,
+            .radix5Inverse = &radixPass<Arch, T, 5, true>,
+            .radix7Forward = &radixPass<Arch, T, 7, false>,
+            .radix7Inverse = &radixPass<Arch, T, 7, true>
+        };
+    }
+
+#if defined(MARVIN_HAS_AVX2_KERNELS)
+    extern template FFTKernels<float> getFFTKernels<utils::simd::AVX2Arch, float>() noexcept;
+    extern template FFTKernels<double> getFFTKernels<utils::simd::AVX2Arch, double>() noexcept;
+#endif
+#if defined(MARVIN_HAS_AVX512_KERNELS)
+    extern template FFTKernels<float> getFFTKernels<utils::simd::AVX512Arch, float>() noexcept;
+    extern template FFTKernels<double> getFFTKernels<utils::simd::AVX512Arch, double>() noexcept;
+#endif
+} // namespace marvin::dsp::spectral::kernels
+#endif
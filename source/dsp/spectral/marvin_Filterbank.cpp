@@ -0,0 +1,141 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include "marvin/dsp/spectral/marvin_Filterbank.h"
+#include "marvin/library/marvin_Literals.h"
+#include "marvin/math/marvin_Conversions.h"
+#include "marvin/math/marvin_VecOps.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+namespace marvin::dsp::spectral {
+    template <FloatType SampleType>
+    void Filterbank<SampleType>::initialiseMel(double sampleRate, size_t fftSize, size_t numBands, double minFrequency, double maxFrequency, bool normalise) {
+        assert(numBands != 0 && minFrequency < maxFrequency && maxFrequency <= sampleRate / 2.0);
+        const auto minMel = math::hzToMel(minFrequency);
+        const auto maxMel = math::hzToMel(maxFrequency);
+        std::vector<double> edges(numBands + 2);
+        for (auto i = 0_sz; i < edges.size(); ++i) {
+            const auto proportion = static_cast<double>(i) / static_cast<double>(numBands + 1);
+            edges[i] = math::melToHz(minMel + (maxMel - minMel) * proportion);
+        }
+        // Pin the ends, so the round trip through the mel scale can't push the top edge past nyquist.
+        edges.front() = minFrequency;
+        edges.back() = maxFrequency;
+        initialise(sampleRate, fftSize, edges, normalise);
+    }
+
+    template <FloatType SampleType>
+    void Filterbank<SampleType>::initialiseConstantQ(double sampleRate, size_t fftSize, double minFrequency, size_t binsPerOctave, size_t numBands) {
+        assert(numBands != 0 && binsPerOctave != 0 && minFrequency > 0.0);
+        std::vector<double> edges(numBands + 2);
+        for (auto i = 0_sz; i < edges.size(); ++i) {
+            edges[i] = minFrequency * std::exp2((static_cast<double>(i) - 1.0) / static_cast<double>(binsPerOctave));
+        }
+        initialise(sampleRate, fftSize, edges, false);
+    }
+
+    /*
+        Evaluates each triangle at the bin centres, and keeps the run between its first and last nonzero weights.
+    */
+    template <FloatType SampleType>
+    void Filterbank<SampleType>::initialise(double sampleRate, size_t fftSize, std::span<const double> edges, bool normalise) {
+        assert(edges.size() >= 3 && fftSize != 0);
+        assert(std::is_sorted(edges.begin(), edges.end()));
+        m_numBins = fftSize / 2 + 1;
+        const auto binWidth = sampleRate / static_cast<double>(fftSize);
+        const auto numBands = edges.size() - 2;
+        m_bands.clear();
+        m_bands.reserve(numBands);
+        m_weights.clear();
+        for (auto band = 0_sz; band < numBands; ++band) {
+            const auto lower = edges[band];
+            const auto centre = edges[band + 1];
+            const auto upper = edges[band + 2];
+            assert(upper <= sampleRate / 2.0);
+            const auto peak = normalise ? 2.0 / (upper - lower) : 1.0;
+            const auto first = static_cast<size_t>(std::max(std::ceil(lower / binWidth), 0.0));
+            const auto last = std::min<size_t>(static_cast<size_t>(std::floor(upper / binWidth)), m_numBins - 1);
+            const auto offset = m_weights.size();
+            auto start = m_numBins;
+            for (auto bin = first; bin <= last; ++bin) {
+                const auto frequency = static_cast<double>(bin) * binWidth;
+                const auto rising = centre > lower ? (frequency - lower) / (centre - lower) : 1.0;
+                const auto falling = upper > centre ? (upper - frequency) / (upper - centre) : 1.0;
+                const auto weight = std::min(rising, falling);
+                if (weight <= 0.0) {
+                    // Only ever at the edges - a zero before the first nonzero weight is skipped, and one after it ends the band.
+                    if (start != m_numBins) {
+                        break;
+                    }
+                    continue;
+                }
+                if (start == m_numBins) {
+                    start = bin;
+                }
+                m_weights.emplace_back(static_cast<SampleType>(weight * peak));
+            }
+            if (start == m_numBins) {
+                // Narrower than a bin - take the bin nearest the centre.
+                start = std::min<size_t>(static_cast<size_t>(std::round(centre / binWidth)), m_numBins - 1);
+                m_weights.emplace_back(static_cast<SampleType>(peak));
+            }
+            m_bands.emplace_back(Band{ .start = start, .length = m_weights.size() - offset, .offset = offset });
+        }
+    }
+
+    template <FloatType SampleType>
+    size_t Filterbank<SampleType>::getNumBands() const noexcept {
+        return m_bands.size();
+    }
+
+    template <FloatType SampleType>
+    size_t Filterbank<SampleType>::getNumBins() const noexcept {
+        return m_numBins;
+    }
+
+    template <FloatType SampleType>
+    size_t Filterbank<SampleType>::getBandStart(size_t band) const noexcept {
+        return m_bands[band].start;
+    }
+
+    template <FloatType SampleType>
+    std::span<const SampleType> Filterbank<SampleType>::getBandWeights(size_t band) const noexcept {
+        const auto& [start, length, offset] = m_bands[band];
+        return { m_weights.data() + offset, length };
+    }
+
+    template <FloatType SampleType>
+    void Filterbank<SampleType>::process(std::span<const SampleType> bins, std::span<SampleType> bands) const noexcept {
+        assert(bins.size() == m_numBins && bands.size() == m_bands.size());
+        for (auto band = 0_sz; band < m_bands.size(); ++band) {
+            const auto& [start, length, offset] = m_bands[band];
+            bands[band] = math::vecops::dot(bins.data() + start, m_weights.data() + offset, length);
+        }
+    }
+
+    template <FloatType SampleType>
+    void Filterbank<SampleType>::processBatch(containers::BufferView<SampleType> bins, containers::BufferView<SampleType> bands) const noexcept {
+        assert(bins.getNumChannels() == bands.getNumChannels());
+        assert(bins.getNumSamples() == m_numBins && bands.getNumSamples() == m_bands.size());
+        const auto* const* binFrames = bins.getArrayOfReadPointers();
+        auto* const* bandFrames = bands.getArrayOfWritePointers();
+        for (auto band = 0_sz; band < m_bands.size(); ++band) {
+            const auto& [start, length, offset] = m_bands[band];
+            const auto* weights = m_weights.data() + offset;
+            for (auto frame = 0_sz; frame < bins.getNumChannels(); ++frame) {
+                bandFrames[frame][band] = math::vecops::dot(binFrames[frame] + start, weights, length);
+            }
+        }
+    }
+
+    template class Filterbank<float>;
+    template class Filterbank<double>;
+} // namespace marvin::dsp::spectral
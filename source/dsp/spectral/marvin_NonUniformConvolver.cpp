@@ -0,0 +1,375 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include "marvin/dsp/spectral/marvin_NonUniformConvolver.h"
+#include "marvin/dsp/spectral/marvin_FFT.h"
+#include "marvin/library/marvin_Literals.h"
+#include "marvin/math/marvin_VecOps.h"
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <complex>
+#include <semaphore>
+#include <thread>
+#if defined(MARVIN_WINDOWS)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(MARVIN_MACOS) || defined(MARVIN_LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif
+namespace marvin::dsp::spectral {
+    /*
+        How much bigger each stage's partitions are than the stage before's.
+    */
+    constexpr static auto s_stageRatio = 8_sz;
+
+    /*
+        Best effort - asks for the calling thread to be scheduled ahead of ordinary threads, so the background stages aren't held up by whatever else the machine's doing.
+        Only called if the caller opts in (see `NonUniformConvolver::initialise`), so hosts that manage their own thread priorities aren't overridden.
+        On Linux that's the lowest real-time (`SCHED_FIFO`) priority, so still below the audio thread if that's real-time too - but that needs `CAP_SYS_NICE` or an
+        `RLIMIT_RTPRIO` allowance, and without one the thread just stays at the normal priority. On macOS it's the user-interactive QoS class, and on Windows the
+        highest priority short of time-critical.
+    */
+    static void raiseCurrentThreadPriority() noexcept {
+#if defined(MARVIN_WINDOWS)
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_HIGHEST);
+#elif defined(MARVIN_MACOS)
+        pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+#elif defined(MARVIN_LINUX)
+        sched_param parameters{};
+        parameters.sched_priority = sched_get_priority_min(SCHED_FIFO);
+        pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters);
+#endif
+    }
+
+    /*
+        A block-based uniformly partitioned overlap-save convolution of one segment of the impulse response. Unlike `Convolver`, it only ever sees whole blocks,
+        and each call produces the (unshifted) convolution of the segment for the block that was just passed in - the caller handles the segment's offset.
+    */
+    template <FloatType SampleType>
+    class NonUniformConvolver<SampleType>::UniformStage final {
+    public:
+        UniformStage(size_t blockSize, std::span<const SampleType> segment) : m_fft(FFTSize{ blockSize * 2 }),
+                                                                               m_blockSize(blockSize),
+                                                                               m_numBins(blockSize + 1),
+                                                                               m_numPartitions(std::max<size_t>((segment.size() + blockSize - 1) / blockSize, 1)) {
+            // Both transforms run unscaled, with everything they leave out folded into the segment's spectra.
+            m_fft.setScalingEnabled(false);
+            const auto forwardScaling = m_fft.getForwardScaling();
+            const auto irScaling = forwardScaling * forwardScaling * m_fft.getInverseScaling();
+            m_irSpectra.resize(m_numPartitions * m_numBins);
+            m_inputSpectra.resize(m_numPartitions * m_numBins);
+            m_accumulator.resize(m_numBins);
+            m_window.resize(blockSize * 2);
+            m_timeBuffer.resize(blockSize * 2);
+            for (auto partition = 0_sz; partition < m_numPartitions; ++partition) {
+                std::fill(m_window.begin(), m_window.end(), static_cast<SampleType>(0.0));
+                const auto start = std::min<size_t>(partition * blockSize, segment.size());
+                const auto end = std::min<size_t>(start + blockSize, segment.size());
+                std::copy(segment.begin() + static_cast<std::ptrdiff_t>(start), segment.begin() + static_cast<std::ptrdiff_t>(end), m_window.begin());
+                std::span<std::complex<SampleType>> spectrum{ m_irSpectra.data() + partition * m_numBins, m_numBins };
+                m_fft.forward(m_window, spectrum);
+                math::vecops::multiply(reinterpret_cast<SampleType*>(spectrum.data()), irScaling, m_numBins * 2);
+            }
+            reset();
+        }
+
+        void reset() noexcept {
+            constexpr static std::complex<SampleType> zero{ static_cast<SampleType>(0.0), static_cast<SampleType>(0.0) };
+            std::fill(m_inputSpectra.begin(), m_inputSpectra.end(), zero);
+            std::fill(m_window.begin(), m_window.end(), static_cast<SampleType>(0.0));
+            m_currentPartition = 0;
+        }
+
+        /*
+            `input` and `output` are both `blockSize` samples long. The delay line runs backwards, so the block `p` blocks ago lives `p` slots after the current one.
+        */
+        void processBlock(const SampleType* input, SampleType* output) noexcept {
+            std::copy(input, input + m_blockSize, m_window.begin() + static_cast<std::ptrdiff_t>(m_blockSize));
+            std::span<std::complex<SampleType>> inputSpectrum{ m_inputSpectra.data() + m_currentPartition * m_numBins, m_numBins };
+            m_fft.forward(m_window, inputSpectrum);
+            std::fill(m_accumulator.begin(), m_accumulator.end(), std::complex<SampleType>{ static_cast<SampleType>(0.0), static_cast<SampleType>(0.0) });
+            for (auto partition = 0_sz; partition < m_numPartitions; ++partition) {
+                const auto slot = (m_currentPartition + partition) % m_numPartitions;
+                math::vecops::multiplyAdd(m_accumulator.data(), m_inputSpectra.data() + slot * m_numBins, m_irSpectra.data() + partition * m_numBins, m_numBins);
+            }
+            m_fft.inverse(m_accumulator, m_timeBuffer);
+            std::copy(m_timeBuffer.begin() + static_cast<std::ptrdiff_t>(m_blockSize), m_timeBuffer.end(), output);
+            std::copy(m_window.begin() + static_cast<std::ptrdiff_t>(m_blockSize), m_window.end(), m_window.begin());
+            m_currentPartition = (m_currentPartition + m_numPartitions - 1) % m_numPartitions;
+        }
+
+    private:
+        FFT<SampleType> m_fft;
+        const size_t m_blockSize;
+        const size_t m_numBins;
+        const size_t m_numPartitions;
+        size_t m_currentPartition{ 0 };
+        std::vector<std::complex<SampleType>> m_irSpectra;
+        std::vector<std::complex<SampleType>> m_inputSpectra;
+        std::vector<std::complex<SampleType>> m_accumulator;
+        std::vector<SampleType> m_window;
+        std::vector<SampleType> m_timeBuffer;
+    };
+
+    /*
+        A `UniformStage` on its own worker thread. The audio thread fills `m_input` a (head-sized) block at a time. When it's full, the audio thread collects the
+        previous job's result as the stage's output for the next `blockSize` samples, queues the new input and wakes the worker - so the worker always has one
+        full stage block's worth of time to finish, which the stage's offset of twice its block size into the impulse response makes up for.
+        Whoever moves `m_job` from `Queued` to `Running` owns the job, so if the worker hasn't started it by the deadline, the audio thread claims it and runs it inline
+        rather than waiting to be woken up. It only waits if the worker's part way through the job - which it can only be at the deadline if it's been held up for
+        most of a stage block mid-job. Either way, it counts a missed deadline.
+        Only one job is ever in flight, so `m_pending` and `m_result` are only touched by the audio thread while `m_job` is `Done`, and by whichever thread claimed the
+        job while it's `Running`.
+    */
+    template <FloatType SampleType>
+    class NonUniformConvolver<SampleType>::BackgroundStage final {
+    public:
+        BackgroundStage(size_t blockSize, std::span<const SampleType> segment, bool raisePriority) : m_stage(blockSize, segment),
+                                                                                                     m_blockSize(blockSize),
+                                                                                                     m_input(blockSize),
+                                                                                                     m_pending(blockSize),
+                                                                                                     m_result(blockSize),
+                                                                                                     m_playback(blockSize) {
+            m_worker = std::thread([this, raisePriority]() { run(raisePriority); });
+        }
+
+        BackgroundStage(const BackgroundStage&) = delete;
+        BackgroundStage& operator=(const BackgroundStage&) = delete;
+
+        ~BackgroundStage() noexcept {
+            waitForResult();
+            m_stopping.store(true, std::memory_order_release);
+            m_wakeup.release();
+            m_worker.join();
+        }
+
+        void reset() noexcept {
+            waitForResult();
+            m_stage.reset();
+            for (auto* buffer : { &m_input, &m_pending, &m_result, &m_playback }) {
+                std::fill(buffer->begin(), buffer->end(), static_cast<SampleType>(0.0));
+            }
+            m_fill = 0;
+            m_missedDeadlines.store(0, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] size_t getNumMissedDeadlines() const noexcept {
+            return m_missedDeadlines.load(std::memory_order_relaxed);
+        }
+
+        /*
+            The stage's output for the sample `offset` samples into the current head block.
+        */
+        [[nodiscard]] const SampleType* getPlayback(size_t offset) const noexcept {
+            return m_playback.data() + m_fill + offset;
+        }
+
+        void push(const SampleType* block, size_t size) noexcept {
+            std::copy(block, block + size, m_input.begin() + static_cast<std::ptrdiff_t>(m_fill));
+            m_fill += size;
+            if (m_fill < m_blockSize) {
+                return;
+            }
+            // The deadline - the result of the block before last starts playing now.
+            if (m_job.load(std::memory_order_acquire) != JobState::Done) {
+                m_missedDeadlines.fetch_add(1, std::memory_order_relaxed);
+                if (tryClaim()) {
+                    runJob();
+                } else {
+                    waitForResult();
+                }
+            }
+            std::copy(m_result.begin(), m_result.end(), m_playback.begin());
+            std::copy(m_input.begin(), m_input.end(), m_pending.begin());
+            m_job.store(JobState::Queued, std::memory_order_release);
+            m_wakeup.release();
+            m_fill = 0;
+        }
+
+    private:
+        enum class JobState {
+            Done,
+            Queued,
+            Running
+        };
+
+        void run(bool raisePriority) {
+            if (raisePriority) {
+                raiseCurrentThreadPriority();
+            }
+            while (true) {
+                m_wakeup.acquire();
+                if (m_stopping.load(std::memory_order_acquire)) {
+                    return;
+                }
+                // The audio thread may have got there first, in which case this wakeup's stale.
+                if (tryClaim()) {
+                    runJob();
+                }
+            }
+        }
+
+        [[nodiscard]] bool tryClaim() noexcept {
+            auto expected = JobState::Queued;
+            return m_job.compare_exchange_strong(expected, JobState::Running, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        void runJob() noexcept {
+            m_stage.processBlock(m_pending.data(), m_result.data());
+            m_job.store(JobState::Done, std::memory_order_release);
+            m_job.notify_all();
+        }
+
+        /*
+            Waits for the job in flight, if there is one. Blocks - so on the audio thread, only once the job's been claimed by the worker. A job that's still queued
+            gets picked up by the worker, which has already been woken for it.
+        */
+        void waitForResult() noexcept {
+            auto state = m_job.load(std::memory_order_acquire);
+            while (state != JobState::Done) {
+                m_job.wait(state, std::memory_order_acquire);
+                state = m_job.load(std::memory_order_acquire);
+            }
+        }
+
+        UniformStage m_stage;
+        const size_t m_blockSize;
+        size_t m_fill{ 0 };
+        std::vector<SampleType> m_input;
+        std::vector<SampleType> m_pending;
+        std::vector<SampleType> m_result;
+        std::vector<SampleType> m_playback;
+        std::atomic<JobState> m_job{ JobState::Done };
+        std::atomic<bool> m_stopping{ false };
+        std::atomic<size_t> m_missedDeadlines{ 0 };
+        // Counting, as the audio thread can queue another job (and wake the worker again) before the worker's woken up for a job it claimed inline.
+        std::counting_semaphore<> m_wakeup{ 0 };
+        std::thread m_worker;
+    };
+
+    template <FloatType SampleType>
+    NonUniformConvolver<SampleType>::NonUniformConvolver() = default;
+
+    template <FloatType SampleType>
+    NonUniformConvolver<SampleType>::~NonUniformConvolver() noexcept = default;
+
+    template <FloatType SampleType>
+    void NonUniformConvolver<SampleType>::initialise(size_t blockSize, std::span<const SampleType> impulseResponse, bool raiseWorkerPriority) {
+        assert(blockSize != 0);
+        m_blockSize = blockSize;
+        m_backgroundStages.clear();
+        m_firstStage.reset();
+        const auto irSize = impulseResponse.size();
+        const auto segment = [&impulseResponse](size_t start, size_t end) { return impulseResponse.subspan(start, end - start); };
+        m_headTaps.resize(blockSize);
+        std::fill(m_headTaps.begin(), m_headTaps.end(), static_cast<SampleType>(0.0));
+        // Reversed, so the head is a dot product with the (chronological) history.
+        const auto headSize = std::min<size_t>(blockSize, irSize);
+        std::reverse_copy(impulseResponse.begin(), impulseResponse.begin() + static_cast<std::ptrdiff_t>(headSize), m_headTaps.end() - static_cast<std::ptrdiff_t>(headSize));
+        m_headHistory.resize(blockSize * 2);
+        m_inputBlock.resize(blockSize);
+        m_firstStageOutput.resize(blockSize);
+        if (irSize > blockSize) {
+            // The first stage's offset is one block, which it makes up for by running on the audio thread. It covers everything up to the first background stage's offset.
+            auto offset = std::min<size_t>(irSize, blockSize * s_stageRatio * 2);
+            m_firstStage = std::make_unique<UniformStage>(blockSize, segment(blockSize, offset));
+            auto stageBlockSize = blockSize * s_stageRatio;
+            while (offset < irSize) {
+                const auto end = std::min<size_t>(irSize, offset * s_stageRatio);
+                m_backgroundStages.emplace_back(std::make_unique<BackgroundStage>(stageBlockSize, segment(offset, end), raiseWorkerPriority));
+                offset = end;
+                stageBlockSize *= s_stageRatio;
+            }
+        }
+        reset();
+    }
+
+    template <FloatType SampleType>
+    void NonUniformConvolver<SampleType>::reset() noexcept {
+        std::fill(m_headHistory.begin(), m_headHistory.end(), static_cast<SampleType>(0.0));
+        std::fill(m_inputBlock.begin(), m_inputBlock.end(), static_cast<SampleType>(0.0));
+        std::fill(m_firstStageOutput.begin(), m_firstStageOutput.end(), static_cast<SampleType>(0.0));
+        if (m_firstStage) {
+            m_firstStage->reset();
+        }
+        for (auto& stage : m_backgroundStages) {
+            stage->reset();
+        }
+        m_position = 0;
+        m_headPosition = 0;
+    }
+
+    template <FloatType SampleType>
+    void NonUniformConvolver<SampleType>::process(std::span<SampleType> data) noexcept {
+        assert(m_blockSize != 0);
+        auto processed = 0_sz;
+        while (processed < data.size()) {
+            const auto remaining = std::min<size_t>(data.size() - processed, m_blockSize - m_position);
+            processSegment(data.subspan(processed, remaining));
+            processed += remaining;
+        }
+    }
+
+    template <FloatType SampleType>
+    size_t NonUniformConvolver<SampleType>::getNumStages() const noexcept {
+        return (m_firstStage ? 1 : 0) + m_backgroundStages.size();
+    }
+
+    template <FloatType SampleType>
+    size_t NonUniformConvolver<SampleType>::getNumMissedDeadlines() const noexcept {
+        auto missed = 0_sz;
+        for (const auto& stage : m_backgroundStages) {
+            missed += stage->getNumMissedDeadlines();
+        }
+        return missed;
+    }
+
+    /*
+        `data` never crosses a block boundary. The head's history is doubled up, so the last `blockSize` samples are always contiguous, ending at `m_headPosition + blockSize`.
+    */
+    template <FloatType SampleType>
+    void NonUniformConvolver<SampleType>::processSegment(std::span<SampleType> data) noexcept {
+        std::copy(data.begin(), data.end(), m_inputBlock.begin() + static_cast<std::ptrdiff_t>(m_position));
+        for (auto& sample : data) {
+            m_headPosition = (m_headPosition + 1) % m_blockSize;
+            m_headHistory[m_headPosition] = sample;
+            m_headHistory[m_headPosition + m_blockSize] = sample;
+            sample = math::vecops::dot(m_headHistory.data() + m_headPosition + 1, m_headTaps.data(), m_blockSize);
+        }
+        if (m_firstStage) {
+            math::vecops::add(data.data(), m_firstStageOutput.data() + m_position, data.size());
+        }
+        for (const auto& stage : m_backgroundStages) {
+            math::vecops::add(data.data(), stage->getPlayback(m_position), data.size());
+        }
+        m_position += data.size();
+        if (m_position == m_blockSize) {
+            onBlockComplete();
+        }
+    }
+
+    template <FloatType SampleType>
+    void NonUniformConvolver<SampleType>::onBlockComplete() noexcept {
+        if (m_firstStage) {
+            m_firstStage->processBlock(m_inputBlock.data(), m_firstStageOutput.data());
+        }
+        for (auto& stage : m_backgroundStages) {
+            stage->push(m_inputBlock.data(), m_blockSize);
+        }
+        m_position = 0;
+    }
+
+    template class NonUniformConvolver<float>;
+    template class NonUniformConvolver<double>;
+} // namespace marvin::dsp::spectral
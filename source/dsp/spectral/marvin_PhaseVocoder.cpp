@@ -0,0 +1,446 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include "marvin/dsp/spectral/marvin_PhaseVocoder.h"
+#include "marvin/dsp/spectral/marvin_FFT.h"
+#include "marvin/library/marvin_Literals.h"
+#include "marvin/math/marvin_Math.h"
+#include "marvin/math/marvin_VecOps.h"
+#include "utils/marvin_Threading.h"
+#include <algorithm>
+#include <barrier>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <numbers>
+namespace marvin::dsp::spectral {
+    /*
+        The fewest frames worth giving a thread of their own in `processOffline`.
+    */
+    constexpr static auto s_minFramesPerThread = 32_sz;
+
+    /*
+        How many frames each thread gets per chunk in `processOffline` - enough that waiting on the other threads between phases is a small share of the chunk's work,
+        while keeping the chunk's spectra small.
+    */
+    constexpr static auto s_framesPerThreadPerChunk = 64_sz;
+
+    /*
+        Wraps a phase into [-pi, pi].
+    */
+    template <FloatType SampleType>
+    [[nodiscard]] static SampleType principalArgument(SampleType phase) noexcept {
+        constexpr static auto twoPi = static_cast<SampleType>(2.0) * std::numbers::pi_v<SampleType>;
+        return phase - twoPi * std::round(phase / twoPi);
+    }
+
+    /*
+        The per-frame part of the vocoder, shared by the streaming and offline modes: analysis, phase propagation, and windowed (and overlap-add normalised) resynthesis.
+        Each instance carries one stream's phase history - which only the propagation uses, so the offline mode can analyse and resynthesise frames on other instances.
+    */
+    template <FloatType SampleType>
+    class PhaseVocoder<SampleType>::Engine final {
+    public:
+        Engine(size_t fftSize, size_t hopSize, math::windows::WindowType windowType) : m_fft(FFTSize{ fftSize }),
+                                                                                       m_fftSize(fftSize),
+                                                                                       m_hopSize(hopSize),
+                                                                                       m_numBins(fftSize / 2 + 1) {
+            m_window.resize(fftSize);
+            math::windows::fillPeriodic<SampleType>(windowType, m_window);
+            // The same overlap-add normalisation as `STFT` - the reciprocal of the summed squared window over the overlapping synthesis frames.
+            std::vector<SampleType> overlapGain(hopSize, static_cast<SampleType>(0.0));
+            for (auto i = 0_sz; i < fftSize; ++i) {
+                overlapGain[i % hopSize] += m_window[i] * m_window[i];
+            }
+            m_synthesisWindow.resize(fftSize);
+            for (auto i = 0_sz; i < fftSize; ++i) {
+                const auto gain = overlapGain[i % hopSize];
+                m_synthesisWindow[i] = gain > static_cast<SampleType>(0.0) ? m_window[i] / gain : static_cast<SampleType>(0.0);
+            }
+            m_frame.resize(fftSize);
+            m_spectrum.resize(m_numBins);
+            for (auto* buffer : { &m_magnitudes, &m_phases, &m_previousMagnitudes, &m_previousPhases, &m_synthesisPhases }) {
+                buffer->resize(m_numBins);
+            }
+            m_peaks.reserve(m_numBins);
+            reset();
+        }
+
+        void reset() noexcept {
+            for (auto* buffer : { &m_previousMagnitudes, &m_previousPhases, &m_synthesisPhases }) {
+                std::fill(buffer->begin(), buffer->end(), static_cast<SampleType>(0.0));
+            }
+            m_isFirstFrame = true;
+        }
+
+        /*
+            Reads `fftSize` samples from `source`, and writes the windowed resynthesised frame (ready to be added to the output) to `dest`.
+            `analysisHop` is the distance from the previous frame's start, and is ignored for the first frame after a reset.
+        */
+        void processFrame(const SampleType* source, size_t analysisHop, PhaseLocking phaseLocking, SampleType transientThreshold, SampleType* dest) noexcept {
+            analyse(source, m_magnitudes.data(), m_phases.data());
+            propagate(m_magnitudes.data(), m_phases.data(), analysisHop, phaseLocking, transientThreshold);
+            synthesise(m_magnitudes.data(), m_phases.data(), dest);
+        }
+
+        /*
+            Windows and transforms `fftSize` samples from `source`, and writes the frame's magnitudes and phases (`fftSize / 2 + 1` of each).
+            Only touches the scratch buffers, so doesn't depend on (or change) the phase history.
+        */
+        void analyse(const SampleType* source, SampleType* magnitudes, SampleType* phases) noexcept {
+            math::vecops::multiply(m_frame.data(), source, m_window.data(), m_fftSize);
+            m_fft.forward(m_frame, m_spectrum);
+            for (auto bin = 0_sz; bin < m_numBins; ++bin) {
+                magnitudes[bin] = std::abs(m_spectrum[bin]);
+                phases[bin] = std::arg(m_spectrum[bin]);
+            }
+        }
+
+        /*
+            Replaces an analysed frame's `phases` with its synthesis phases, and moves the phase history on to it - the only stage that needs every frame, in order.
+            `analysisHop` is the distance from the previous frame's start, and is ignored for the first frame after a reset.
+        */
+        void propagate(const SampleType* magnitudes, SampleType* phases, size_t analysisHop, PhaseLocking phaseLocking, SampleType transientThreshold) noexcept {
+            auto total = static_cast<SampleType>(0.0);
+            auto flux = static_cast<SampleType>(0.0);
+            for (auto bin = 0_sz; bin < m_numBins; ++bin) {
+                total += magnitudes[bin];
+                flux += std::max(magnitudes[bin] - m_previousMagnitudes[bin], static_cast<SampleType>(0.0));
+            }
+            if (m_isFirstFrame || flux > transientThreshold * total) {
+                std::copy(phases, phases + m_numBins, m_synthesisPhases.begin());
+            } else {
+                propagatePhases(magnitudes, phases, static_cast<SampleType>(std::max<size_t>(analysisHop, 1)), phaseLocking);
+            }
+            std::copy(magnitudes, magnitudes + m_numBins, m_previousMagnitudes.begin());
+            std::copy(phases, phases + m_numBins, m_previousPhases.begin());
+            std::copy(m_synthesisPhases.begin(), m_synthesisPhases.end(), phases);
+            m_isFirstFrame = false;
+        }
+
+        /*
+            Writes the windowed resynthesised frame for `magnitudes` and (synthesis) `phases` to `dest`. Like `analyse`, only touches the scratch buffers.
+        */
+        void synthesise(const SampleType* magnitudes, const SampleType* phases, SampleType* dest) noexcept {
+            for (auto bin = 0_sz; bin < m_numBins; ++bin) {
+                m_spectrum[bin] = std::polar(magnitudes[bin], phases[bin]);
+            }
+            m_fft.inverse(m_spectrum, m_frame);
+            math::vecops::multiply(dest, m_frame.data(), m_synthesisWindow.data(), m_fftSize);
+        }
+
+    private:
+        /*
+            Advances a bin's synthesis phase by its instantaneous frequency (measured over the analysis hop) times the synthesis hop.
+        */
+        [[nodiscard]] SampleType advancePhase(size_t bin, const SampleType* phases, SampleType analysisHop) const noexcept {
+            constexpr static auto twoPi = static_cast<SampleType>(2.0) * std::numbers::pi_v<SampleType>;
+            const auto binFrequency = twoPi * static_cast<SampleType>(bin) / static_cast<SampleType>(m_fftSize);
+            const auto deviation = principalArgument(phases[bin] - m_previousPhases[bin] - binFrequency * analysisHop);
+            const auto instantaneousFrequency = binFrequency + deviation / analysisHop;
+            return principalArgument(m_synthesisPhases[bin] + instantaneousFrequency * static_cast<SampleType>(m_hopSize));
+        }
+
+        /*
+            With phase locking, only the peaks are advanced - every other bin keeps its analysis phase offset from the nearest peak (scaled, for `Scaled`).
+        */
+        void propagatePhases(const SampleType* magnitudes, const SampleType* phases, SampleType analysisHop, PhaseLocking phaseLocking) noexcept {
+            m_peaks.clear();
+            if (phaseLocking != PhaseLocking::None) {
+                for (auto bin = 2_sz; bin + 2 < m_numBins; ++bin) {
+                    const auto magnitude = magnitudes[bin];
+                    if (magnitude > magnitudes[bin - 1] && magnitude > magnitudes[bin - 2] && magnitude > magnitudes[bin + 1] && magnitude > magnitudes[bin + 2]) {
+                        m_peaks.emplace_back(bin);
+                    }
+                }
+            }
+            if (m_peaks.empty()) {
+                for (auto bin = 0_sz; bin < m_numBins; ++bin) {
+                    m_synthesisPhases[bin] = advancePhase(bin, phases, analysisHop);
+                }
+                return;
+            }
+            const auto stretch = static_cast<SampleType>(m_hopSize) / analysisHop;
+            const auto scale = phaseLocking == PhaseLocking::Scaled ? static_cast<SampleType>(2.0 / 3.0) + stretch / static_cast<SampleType>(3.0) : static_cast<SampleType>(1.0);
+            for (const auto peak : m_peaks) {
+                m_synthesisPhases[peak] = advancePhase(peak, phases, analysisHop);
+            }
+            auto regionStart = 0_sz;
+            for (auto i = 0_sz; i < m_peaks.size(); ++i) {
+                const auto peak = m_peaks[i];
+                const auto regionEnd = i + 1 < m_peaks.size() ? (peak + m_peaks[i + 1] + 1) / 2 : m_numBins;
+                for (auto bin = regionStart; bin < regionEnd; ++bin) {
+                    if (bin != peak) {
+                        m_synthesisPhases[bin] = principalArgument(m_synthesisPhases[peak] + scale * (phases[bin] - phases[peak]));
+                    }
+                }
+                regionStart = regionEnd;
+            }
+        }
+
+        FFT<SampleType> m_fft;
+        const size_t m_fftSize;
+        const size_t m_hopSize;
+        const size_t m_numBins;
+        bool m_isFirstFrame{ true };
+        std::vector<SampleType> m_window;
+        std::vector<SampleType> m_synthesisWindow;
+        std::vector<SampleType> m_frame;
+        std::vector<std::complex<SampleType>> m_spectrum;
+        std::vector<SampleType> m_magnitudes;
+        std::vector<SampleType> m_phases;
+        std::vector<SampleType> m_previousMagnitudes;
+        std::vector<SampleType> m_previousPhases;
+        std::vector<SampleType> m_synthesisPhases;
+        std::vector<size_t> m_peaks;
+    };
+
+    template <FloatType SampleType>
+    PhaseVocoder<SampleType>::PhaseVocoder() = default;
+
+    template <FloatType SampleType>
+    PhaseVocoder<SampleType>::~PhaseVocoder() noexcept = default;
+
+    template <FloatType SampleType>
+    void PhaseVocoder<SampleType>::initialise(const Settings& settings, size_t maxBlockSize, double maxStretch) {
+        assert(settings.hopSize != 0 && settings.hopSize <= settings.fftSize / 2);
+        m_settings = settings;
+        const auto fftSize = settings.fftSize;
+        const auto hopSize = settings.hopSize;
+        m_engine = std::make_unique<Engine>(fftSize, hopSize, settings.windowType);
+        // The analysis hop is at most `fftSize`, so there's never more than two frames' worth of input waiting, plus the block being pushed.
+        m_input.resize(fftSize * 2 + maxBlockSize);
+        m_frame.resize(fftSize);
+        // Room for a frame being overlap-added, plus the finished samples from a whole block's worth of frames that haven't been pulled yet (with some slack).
+        const auto maxFinished = static_cast<size_t>(std::ceil(static_cast<double>(maxBlockSize) * maxStretch)) + hopSize;
+        m_output.resize(fftSize + hopSize + maxFinished * 2);
+        reset();
+    }
+
+    template <FloatType SampleType>
+    void PhaseVocoder<SampleType>::setTimeStretch(double ratio) noexcept {
+        m_settings.timeStretch = ratio;
+    }
+
+    template <FloatType SampleType>
+    void PhaseVocoder<SampleType>::setPitchShift(double ratio) noexcept {
+        m_settings.pitchShift = ratio;
+    }
+
+    template <FloatType SampleType>
+    void PhaseVocoder<SampleType>::setPhaseLocking(PhaseLocking phaseLocking) noexcept {
+        m_settings.phaseLocking = phaseLocking;
+    }
+
+    template <FloatType SampleType>
+    void PhaseVocoder<SampleType>::setTransientThreshold(SampleType threshold) noexcept {
+        m_settings.transientThreshold = threshold;
+    }
+
+    /*
+        The input starts with `fftSize - hopSize` samples of silence, so the start of the output isn't missing the frames before the first one (which would fade it in) - this is the latency.
+    */
+    template <FloatType SampleType>
+    void PhaseVocoder<SampleType>::reset() noexcept {
+        m_engine->reset();
+        std::fill(m_input.begin(), m_input.end(), static_cast<SampleType>(0.0));
+        std::fill(m_output.begin(), m_output.end(), static_cast<SampleType>(0.0));
+        m_inputSize = m_settings.fftSize - m_settings.hopSize;
+        m_analysisPosition = 0.0;
+        m_previousFrameStart = 0;
+        m_writePosition = 0;
+        m_readPosition = 0;
+        m_numFinished = 0;
+        m_readFraction = 0.0;
+    }
+
+    template <FloatType SampleType>
+    void PhaseVocoder<SampleType>::push(std::span<const SampleType> input) noexcept {
+        assert(m_engine);
+        assert(m_inputSize + input.size() <= m_input.size());
+        std::copy(input.begin(), input.end(), m_input.begin() + static_cast<std::ptrdiff_t>(m_inputSize));
+        m_inputSize += input.size();
+        processFrames();
+        // Drop everything before the next frame's start.
+        const auto consumed = std::min<size_t>(static_cast<size_t>(m_analysisPosition), m_inputSize);
+        std::copy(m_input.begin() + static_cast<std::ptrdiff_t>(consumed), m_input.begin() + static_cast<std::ptrdiff_t>(m_inputSize), m_input.begin());
+        m_inputSize -= consumed;
+        m_analysisPosition -= static_cast<double>(consumed);
+        m_previousFrameStart -= static_cast<std::ptrdiff_t>(consumed);
+    }
+
+    /*
+        Output is resampled by the pitch ratio as it's read, with linear interpolation - so sample `i` needs finished samples up to `floor(fraction + i * ratio) + 1`.
+    */
+    template <FloatType SampleType>
+    size_t PhaseVocoder<SampleType>::getNumAvailable() const noexcept {
+        const auto readable = static_cast<double>(m_numFinished) - 1.0 - m_readFraction;
+        if (readable <= 0.0) {
+            return 0;
+        }
+        return static_cast<size_t>(std::ceil(readable / m_settings.pitchShift));
+    }
+
+    template <FloatType SampleType>
+    size_t PhaseVocoder<SampleType>::pull(std::span<SampleType> output) noexcept {
+        const auto outputSize = m_output.size();
+        const auto numSamples = std::min<size_t>(output.size(), getNumAvailable());
+        for (auto i = 0_sz; i < numSamples; ++i) {
+            const auto next = m_readPosition + 1 == outputSize ? 0 : m_readPosition + 1;
+            output[i] = math::lerp(m_output[m_readPosition], m_output[next], static_cast<SampleType>(m_readFraction));
+            m_readFraction += m_settings.pitchShift;
+            while (m_readFraction >= 1.0) {
+                m_output[m_readPosition] = static_cast<SampleType>(0.0);
+                m_readPosition = m_readPosition + 1 == outputSize ? 0 : m_readPosition + 1;
+                --m_numFinished;
+                m_readFraction -= 1.0;
+            }
+        }
+        return numSamples;
+    }
+
+    template <FloatType SampleType>
+    size_t PhaseVocoder<SampleType>::getLatency() const noexcept {
+        return m_settings.fftSize - m_settings.hopSize;
+    }
+
+    /*
+        Each frame finishes the `hopSize` samples at the start of its synthesis window - so the finished samples always end where the next frame starts.
+    */
+    template <FloatType SampleType>
+    void PhaseVocoder<SampleType>::processFrames() noexcept {
+        const auto fftSize = m_settings.fftSize;
+        const auto hopSize = m_settings.hopSize;
+        const auto outputSize = m_output.size();
+        const auto analysisHop = static_cast<double>(hopSize) / (m_settings.timeStretch * m_settings.pitchShift);
+        assert(analysisHop <= static_cast<double>(fftSize));
+        while (true) {
+            const auto frameStart = static_cast<size_t>(m_analysisPosition);
+            if (frameStart + fftSize > m_inputSize) {
+                break;
+            }
+            assert(m_numFinished + fftSize <= outputSize);
+            const auto hop = static_cast<size_t>(static_cast<std::ptrdiff_t>(frameStart) - m_previousFrameStart);
+            m_engine->processFrame(m_input.data() + frameStart, hop, m_settings.phaseLocking, m_settings.transientThreshold, m_frame.data());
+            const auto beforeWrap = std::min<size_t>(fftSize, outputSize - m_writePosition);
+            math::vecops::add(m_output.data() + m_writePosition, m_frame.data(), beforeWrap);
+            math::vecops::add(m_output.data(), m_frame.data() + beforeWrap, fftSize - beforeWrap);
+            m_writePosition = (m_writePosition + hopSize) % outputSize;
+            m_numFinished += hopSize;
+            m_previousFrameStart = static_cast<std::ptrdiff_t>(frameStart);
+            m_analysisPosition += analysisHop;
+        }
+    }
+
+    /*
+        Frame `k` is centred on `k * analysisHop` in the input, and `k * hopSize` in the stretched signal, so the two line up. The input is padded on both sides,
+        so every frame that overlaps the output has something to read.
+    */
+    template <FloatType SampleType>
+    std::vector<SampleType> PhaseVocoder<SampleType>::processOffline(std::span<const SampleType> input, const Settings& settings, size_t numThreads) {
+        assert(settings.hopSize != 0 && settings.hopSize <= settings.fftSize / 2);
+        const auto fftSize = settings.fftSize;
+        const auto hopSize = settings.hopSize;
+        const auto halfFrame = static_cast<std::ptrdiff_t>(fftSize / 2);
+        const auto stretch = settings.timeStretch * settings.pitchShift;
+        const auto analysisHop = static_cast<double>(hopSize) / stretch;
+        assert(analysisHop <= static_cast<double>(fftSize));
+        const auto stretchedSize = static_cast<size_t>(std::ceil(static_cast<double>(input.size()) * stretch)) + 2;
+        // The first frame's the earliest one whose synthesis window reaches sample 0, and the last the latest that starts before the end.
+        const auto firstFrame = -static_cast<std::ptrdiff_t>((fftSize / 2 + hopSize - 1) / hopSize);
+        const auto lastFrame = static_cast<std::ptrdiff_t>((stretchedSize + fftSize / 2) / hopSize) + 1;
+        const auto numFrames = static_cast<size_t>(lastFrame - firstFrame + 1);
+        const auto frontPadding = static_cast<size_t>(std::ceil(static_cast<double>(-firstFrame) * analysisHop)) + fftSize;
+        std::vector<SampleType> padded(frontPadding + input.size() + static_cast<size_t>(std::ceil(static_cast<double>(lastFrame) * analysisHop)) + fftSize * 2, static_cast<SampleType>(0.0));
+        std::copy(input.begin(), input.end(), padded.begin() + static_cast<std::ptrdiff_t>(frontPadding));
+        const auto getAnalysisStart = [&](std::ptrdiff_t frame) -> size_t {
+            const auto centre = static_cast<std::ptrdiff_t>(std::floor(static_cast<double>(frame) * analysisHop));
+            return static_cast<size_t>(static_cast<std::ptrdiff_t>(frontPadding) + centre - halfFrame);
+        };
+
+        // Only the phase propagation has to see the frames in order, so the signal's worked through in chunks - each chunk's frames are analysed in parallel, have
+        // their phases propagated on one thread, and are then resynthesised in parallel. Each thread then overlap-adds the frames into its own slice of the output,
+        // in frame order, so the output is the same however many threads there are.
+        numThreads = std::clamp<size_t>(std::min<size_t>(numThreads, numFrames / s_minFramesPerThread), 1, numFrames);
+        const auto numBins = fftSize / 2 + 1;
+        const auto framesPerChunk = std::min<size_t>(numThreads * s_framesPerThreadPerChunk, numFrames);
+        std::vector<std::unique_ptr<Engine>> engines;
+        for (auto thread = 0_sz; thread < numThreads; ++thread) {
+            engines.emplace_back(std::make_unique<Engine>(fftSize, hopSize, settings.windowType));
+        }
+        std::vector<SampleType> magnitudes(framesPerChunk * numBins);
+        std::vector<SampleType> phases(framesPerChunk * numBins);
+        std::vector<SampleType> frames(framesPerChunk * fftSize);
+        std::vector<SampleType> stretched(stretchedSize, static_cast<SampleType>(0.0));
+        const auto getChunkSize = [&](std::ptrdiff_t chunkStart) { return std::min<size_t>(framesPerChunk, static_cast<size_t>(lastFrame - chunkStart + 1)); };
+        // The threads are started once for the whole signal, and step through the chunks together - the phases are propagated by one of them once they've all
+        // reached `analysed`, before any of them move on to resynthesis. The next chunk's analysis doesn't touch the frames, and its resynthesis waits on
+        // `analysed` again, so every thread's done overlap-adding the last chunk before its frames are overwritten.
+        auto propagatedStart = firstFrame;
+        auto previousStart = getAnalysisStart(firstFrame);
+        const auto propagateChunk = [&]() noexcept {
+            for (auto i = 0_sz; i < getChunkSize(propagatedStart); ++i) {
+                const auto analysisStart = getAnalysisStart(propagatedStart + static_cast<std::ptrdiff_t>(i));
+                engines.front()->propagate(magnitudes.data() + i * numBins, phases.data() + i * numBins, analysisStart - previousStart, settings.phaseLocking, settings.transientThreshold);
+                previousStart = analysisStart;
+            }
+            propagatedStart += static_cast<std::ptrdiff_t>(framesPerChunk);
+        };
+        std::barrier analysed{ static_cast<std::ptrdiff_t>(numThreads), propagateChunk };
+        std::barrier synthesised{ static_cast<std::ptrdiff_t>(numThreads) };
+        // None of this throws, so no thread leaves the others waiting at a barrier.
+        utils::runOnThreads(numThreads, [&](size_t thread) {
+            for (auto chunkStart = firstFrame; chunkStart <= lastFrame; chunkStart += static_cast<std::ptrdiff_t>(framesPerChunk)) {
+                const auto chunkSize = getChunkSize(chunkStart);
+                for (auto i = chunkSize * thread / numThreads; i < chunkSize * (thread + 1) / numThreads; ++i) {
+                    const auto analysisStart = getAnalysisStart(chunkStart + static_cast<std::ptrdiff_t>(i));
+                    engines[thread]->analyse(padded.data() + analysisStart, magnitudes.data() + i * numBins, phases.data() + i * numBins);
+                }
+                analysed.arrive_and_wait();
+                for (auto i = chunkSize * thread / numThreads; i < chunkSize * (thread + 1) / numThreads; ++i) {
+                    engines[thread]->synthesise(magnitudes.data() + i * numBins, phases.data() + i * numBins, frames.data() + i * fftSize);
+                }
+                synthesised.arrive_and_wait();
+                const auto chunkSynthesisStart = chunkStart * static_cast<std::ptrdiff_t>(hopSize) - halfFrame;
+                const auto outputStart = std::max<std::ptrdiff_t>(chunkSynthesisStart, 0);
+                const auto outputEnd = std::min<std::ptrdiff_t>(chunkSynthesisStart + static_cast<std::ptrdiff_t>((chunkSize - 1) * hopSize + fftSize), static_cast<std::ptrdiff_t>(stretchedSize));
+                const auto outputSize = std::max<std::ptrdiff_t>(outputEnd - outputStart, 0);
+                const auto sliceStart = outputStart + outputSize * static_cast<std::ptrdiff_t>(thread) / static_cast<std::ptrdiff_t>(numThreads);
+                const auto sliceEnd = outputStart + outputSize * static_cast<std::ptrdiff_t>(thread + 1) / static_cast<std::ptrdiff_t>(numThreads);
+                for (auto i = 0_sz; i < chunkSize; ++i) {
+                    const auto synthesisStart = chunkSynthesisStart + static_cast<std::ptrdiff_t>(i * hopSize);
+                    const auto start = std::max<std::ptrdiff_t>(sliceStart, synthesisStart);
+                    const auto end = std::min<std::ptrdiff_t>(sliceEnd, synthesisStart + static_cast<std::ptrdiff_t>(fftSize));
+                    if (start < end) {
+                        math::vecops::add(stretched.data() + start, frames.data() + i * fftSize + (start - synthesisStart), static_cast<size_t>(end - start));
+                    }
+                }
+            }
+        });
+        if (settings.pitchShift == 1.0) {
+            stretched.resize(static_cast<size_t>(std::round(static_cast<double>(input.size()) * settings.timeStretch)));
+            return stretched;
+        }
+        std::vector<SampleType> output(static_cast<size_t>(std::round(static_cast<double>(input.size()) * settings.timeStretch)));
+        for (auto i = 0_sz; i < output.size(); ++i) {
+            const auto position = static_cast<double>(i) * settings.pitchShift;
+            const auto index = static_cast<size_t>(position);
+            if (index + 1 >= stretched.size()) {
+                break;
+            }
+            output[i] = math::lerp(stretched[index], stretched[index + 1], static_cast<SampleType>(position - static_cast<double>(index)));
+        }
+        return output;
+    }
+
+    template class PhaseVocoder<float>;
+    template class PhaseVocoder<double>;
+} // namespace marvin::dsp::spectral
@@ -0,0 +1,130 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include "marvin/dsp/spectral/marvin_STFT.h"
+#include "marvin/library/marvin_Literals.h"
+#include "marvin/math/marvin_VecOps.h"
+#include <algorithm>
+#include <cassert>
+namespace marvin::dsp::spectral {
+    template <FloatType SampleType>
+    void STFT<SampleType>::initialise(size_t fftSize, size_t hopSize, math::windows::WindowType windowType) {
+        std::vector<SampleType> window(fftSize);
+        math::windows::fillPeriodic<SampleType>(windowType, window);
+        initialise(fftSize, hopSize, window);
+    }
+
+    template <FloatType SampleType>
+    void STFT<SampleType>::initialise(size_t fftSize, size_t hopSize, std::span<const SampleType> window) {
+        assert(hopSize != 0 && hopSize <= fftSize / 2);
+        assert(window.size() == fftSize);
+        m_fftSize = fftSize;
+        m_hopSize = hopSize;
+        m_fft = std::make_unique<FFT<SampleType>>(FFTSize{ fftSize });
+        m_analysisWindow.assign(window.begin(), window.end());
+        // Every output sample is the sum of the frames overlapping it, each weighted by the window twice - fold the reciprocal of that sum into the synthesis window.
+        std::vector<SampleType> overlapGain(hopSize, static_cast<SampleType>(0.0));
+        for (auto i = 0_sz; i < fftSize; ++i) {
+            overlapGain[i % hopSize] += window[i] * window[i];
+        }
+        m_synthesisWindow.resize(fftSize);
+        for (auto i = 0_sz; i < fftSize; ++i) {
+            const auto gain = overlapGain[i % hopSize];
+            assert(gain > static_cast<SampleType>(0.0));
+            m_synthesisWindow[i] = gain > static_cast<SampleType>(0.0) ? window[i] / gain : static_cast<SampleType>(0.0);
+        }
+        m_inputHistory.resize(fftSize * 2);
+        // Big enough for a whole frame, plus the (up to `hopSize`) samples still waiting to be read out from before it.
+        m_overlapAddBuffer.resize(fftSize + hopSize);
+        m_frame.resize(fftSize);
+        m_spectrum.resize(fftSize / 2 + 1);
+        reset();
+    }
+
+    template <FloatType SampleType>
+    void STFT<SampleType>::setFrameCallback(FrameCallback&& callback) {
+        m_frameCallback = std::move(callback);
+    }
+
+    template <FloatType SampleType>
+    void STFT<SampleType>::reset() noexcept {
+        std::fill(m_inputHistory.begin(), m_inputHistory.end(), static_cast<SampleType>(0.0));
+        std::fill(m_overlapAddBuffer.begin(), m_overlapAddBuffer.end(), static_cast<SampleType>(0.0));
+        m_inputPosition = 0;
+        m_outputPosition = 0;
+        m_hopCounter = 0;
+    }
+
+    /*
+        Processes up to the next hop at a time - the input's written first, then the frame (if the hop's complete), then the output's read out, so that the frame's
+        first sample is ready in time for the last sample of the segment.
+    */
+    template <FloatType SampleType>
+    void STFT<SampleType>::process(std::span<SampleType> data) noexcept {
+        assert(m_fft);
+        const auto overlapAddSize = m_overlapAddBuffer.size();
+        auto processed = 0_sz;
+        while (processed < data.size()) {
+            const auto segment = data.subspan(processed, std::min<size_t>(data.size() - processed, m_hopSize - m_hopCounter));
+            for (const auto x : segment) {
+                m_inputHistory[m_inputPosition] = x;
+                m_inputHistory[m_inputPosition + m_fftSize] = x;
+                m_inputPosition = m_inputPosition + 1 == m_fftSize ? 0 : m_inputPosition + 1;
+            }
+            m_hopCounter += segment.size();
+            if (m_hopCounter == m_hopSize) {
+                processFrame(segment.size());
+                m_hopCounter = 0;
+            }
+            for (auto& x : segment) {
+                x = m_overlapAddBuffer[m_outputPosition];
+                m_overlapAddBuffer[m_outputPosition] = static_cast<SampleType>(0.0);
+                m_outputPosition = m_outputPosition + 1 == overlapAddSize ? 0 : m_outputPosition + 1;
+            }
+            processed += segment.size();
+        }
+    }
+
+    template <FloatType SampleType>
+    size_t STFT<SampleType>::getLatency() const noexcept {
+        return m_fftSize - 1;
+    }
+
+    template <FloatType SampleType>
+    size_t STFT<SampleType>::getFFTSize() const noexcept {
+        return m_fftSize;
+    }
+
+    template <FloatType SampleType>
+    size_t STFT<SampleType>::getHopSize() const noexcept {
+        return m_hopSize;
+    }
+
+    /*
+        Only ever called at the end of a hop, before the last `numUnread` samples' output is read - the frame's first sample lands on the slot the last of them will be read from.
+    */
+    template <FloatType SampleType>
+    void STFT<SampleType>::processFrame(size_t numUnread) noexcept {
+        const auto overlapAddSize = m_overlapAddBuffer.size();
+        math::vecops::multiply(m_frame.data(), m_inputHistory.data() + m_inputPosition, m_analysisWindow.data(), m_fftSize);
+        m_fft->forward(m_frame, m_spectrum);
+        if (m_frameCallback) {
+            m_frameCallback(m_spectrum);
+        }
+        m_fft->inverse(m_spectrum, m_frame);
+        const auto start = (m_outputPosition + numUnread - 1) % overlapAddSize;
+        const auto beforeWrap = std::min<size_t>(m_fftSize, overlapAddSize - start);
+        math::vecops::multiplyAdd(m_overlapAddBuffer.data() + start, m_frame.data(), m_synthesisWindow.data(), beforeWrap);
+        math::vecops::multiplyAdd(m_overlapAddBuffer.data(), m_frame.data() + beforeWrap, m_synthesisWindow.data() + beforeWrap, m_fftSize - beforeWrap);
+    }
+
+    template class STFT<float>;
+    template class STFT<double>;
+} // namespace marvin::dsp::spectral
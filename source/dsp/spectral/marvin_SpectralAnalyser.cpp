@@ -0,0 +1,149 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include "marvin/dsp/spectral/marvin_SpectralAnalyser.h"
+#include "marvin/dsp/spectral/marvin_FFT.h"
+#include "marvin/library/marvin_Literals.h"
+#include "marvin/math/marvin_VecOps.h"
+#include "utils/marvin_Threading.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+namespace marvin::dsp::spectral {
+    /*
+        The fewest frames worth giving a thread of their own in `analyse`.
+    */
+    constexpr static auto s_minFramesPerAnalysisThread = 16_sz;
+
+    /*
+        One thread's worth of the analysis - its own FFT and scratch buffers, reading the (shared, read-only) input and window.
+    */
+    template <FloatType SampleType>
+    class AnalysisWorker final {
+    public:
+        AnalysisWorker(std::span<const SampleType> input, std::span<const SampleType> window, size_t hopSize) : m_input(input),
+                                                                                                              m_window(window),
+                                                                                                              m_hopSize(hopSize),
+                                                                                                              m_fft(FFTSize{ window.size() }),
+                                                                                                              m_frame(window.size()),
+                                                                                                              m_spectrum(window.size() / 2 + 1) {
+        }
+
+        /*
+            Writes the magnitude spectrum of frame `index` to `dest`, and returns the (unwindowed) frame's sum of squares.
+        */
+        SampleType computeMagnitudes(size_t index, SampleType* dest) noexcept {
+            const auto fftSize = m_frame.size();
+            const auto start = index * m_hopSize;
+            const auto available = start < m_input.size() ? std::min<size_t>(fftSize, m_input.size() - start) : 0_sz;
+            const auto* source = m_input.data() + std::min<size_t>(start, m_input.size());
+            if (available == fftSize) {
+                math::vecops::multiply(m_frame.data(), source, m_window.data(), fftSize);
+            } else {
+                std::copy(source, source + available, m_frame.begin());
+                std::fill(m_frame.begin() + static_cast<std::ptrdiff_t>(available), m_frame.end(), static_cast<SampleType>(0.0));
+                math::vecops::multiply(m_frame.data(), m_window.data(), fftSize);
+            }
+            m_fft.forward(m_frame, m_spectrum);
+            math::vecops::magnitude(dest, m_spectrum.data(), m_spectrum.size());
+            return math::vecops::sumOfSquares(source, available);
+        }
+
+    private:
+        std::span<const SampleType> m_input;
+        std::span<const SampleType> m_window;
+        size_t m_hopSize;
+        FFT<SampleType> m_fft;
+        std::vector<SampleType> m_frame;
+        std::vector<std::complex<SampleType>> m_spectrum;
+    };
+
+    template <FloatType SampleType>
+    std::span<const SampleType> SpectralAnalyser<SampleType>::Analysis::getFrame(size_t frame) const noexcept {
+        assert(frame < numFrames);
+        return { magnitudes.data() + frame * numBins, numBins };
+    }
+
+    template <FloatType SampleType>
+    typename SpectralAnalyser<SampleType>::Analysis SpectralAnalyser<SampleType>::analyse(std::span<const SampleType> input, const Settings& settings, size_t numThreads) {
+        assert(settings.hopSize != 0 && settings.fftSize != 0);
+        Analysis analysis;
+        if (input.empty()) {
+            return analysis;
+        }
+        const auto fftSize = settings.fftSize;
+        const auto hopSize = settings.hopSize;
+        const auto numBins = fftSize / 2 + 1;
+        const auto numFrames = input.size() <= fftSize ? 1_sz : 1 + (input.size() - fftSize + hopSize - 1) / hopSize;
+        analysis.numFrames = numFrames;
+        analysis.numBins = numBins;
+        analysis.magnitudes.resize(numFrames * numBins);
+        for (auto* feature : { &analysis.centroid, &analysis.flux, &analysis.rolloff, &analysis.rms }) {
+            feature->resize(numFrames);
+        }
+        std::vector<SampleType> window(fftSize);
+        math::windows::fillPeriodic<SampleType>(settings.windowType, window);
+        std::vector<SampleType> binFrequencies(numBins);
+        for (auto bin = 0_sz; bin < numBins; ++bin) {
+            binFrequencies[bin] = static_cast<SampleType>(static_cast<double>(bin) * settings.sampleRate / static_cast<double>(fftSize));
+        }
+
+        // Each run writes only to its own rows, and recomputes the frame before its first itself for the flux, rather than waiting on the previous run.
+        numThreads = std::clamp<size_t>(std::min<size_t>(numThreads, numFrames / s_minFramesPerAnalysisThread), 1, numFrames);
+        const auto framesPerRun = (numFrames + numThreads - 1) / numThreads;
+        const auto processRun = [&](size_t run) {
+            const auto runStart = run * framesPerRun;
+            const auto runEnd = std::min<size_t>(runStart + framesPerRun, numFrames);
+            if (runStart >= runEnd) {
+                return;
+            }
+            AnalysisWorker<SampleType> worker{ input, window, hopSize };
+            std::vector<SampleType> previous(numBins, static_cast<SampleType>(0.0));
+            if (runStart != 0) {
+                worker.computeMagnitudes(runStart - 1, previous.data());
+            }
+            const auto* previousMagnitudes = previous.data();
+            for (auto frame = runStart; frame < runEnd; ++frame) {
+                auto* magnitudes = analysis.magnitudes.data() + frame * numBins;
+                const auto energy = worker.computeMagnitudes(frame, magnitudes);
+                analysis.rms[frame] = std::sqrt(energy / static_cast<SampleType>(fftSize));
+                const auto total = math::vecops::sum(magnitudes, numBins);
+                analysis.centroid[frame] = total > static_cast<SampleType>(0.0) ? math::vecops::dot(magnitudes, binFrequencies.data(), numBins) / total : static_cast<SampleType>(0.0);
+                auto flux = static_cast<SampleType>(0.0);
+                auto spectralEnergy = static_cast<SampleType>(0.0);
+                for (auto bin = 0_sz; bin < numBins; ++bin) {
+                    const auto rise = std::max(magnitudes[bin] - previousMagnitudes[bin], static_cast<SampleType>(0.0));
+                    flux += rise * rise;
+                    spectralEnergy += magnitudes[bin] * magnitudes[bin];
+                }
+                analysis.flux[frame] = std::sqrt(flux);
+                const auto threshold = spectralEnergy * settings.rolloffProportion;
+                auto cumulative = static_cast<SampleType>(0.0);
+                auto rolloffBin = 0_sz;
+                if (spectralEnergy > static_cast<SampleType>(0.0)) {
+                    for (; rolloffBin < numBins - 1; ++rolloffBin) {
+                        cumulative += magnitudes[rolloffBin] * magnitudes[rolloffBin];
+                        if (cumulative >= threshold) {
+                            break;
+                        }
+                    }
+                }
+                analysis.rolloff[frame] = binFrequencies[rolloffBin];
+                previousMagnitudes = magnitudes;
+            }
+        };
+        utils::runOnThreads(numThreads, processRun);
+        return analysis;
+    }
+
+    template class SpectralAnalyser<float>;
+    template class SpectralAnalyser<double>;
+} // namespace marvin::dsp::spectral
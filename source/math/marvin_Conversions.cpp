@@ -1,4 +1,61 @@
 //
 // Created by Syl Morrison on 03/05/2025.
 //
-#include <marvin/math/marvin_Conversions.h>
\ No newline at end of file
+#include <marvin/math/marvin_Conversions.h>
+#include <marvin/math/marvin_VecOps.h>
+#include <marvin/library/marvin_Literals.h>
+#include <algorithm>
+#include <array>
+#include <numbers>
+
+namespace marvin::math {
+    /*
+        The block conversions run in chunks of this many samples, so the masks of which inputs are silent can live on the stack.
+    */
+    constexpr static auto s_conversionChunkSize = 256_sz;
+
+    /*
+        Neither conversion lets an infinity anywhere near the vectorised exp / log10 - they're undefined under -ffinite-math-only / -ffast-math.
+        Silent samples get a finite sentinel on the way in, and are replaced based on the original input on the way out. `dest` may alias the input,
+        so the comparison is stashed per chunk before the input gets overwritten.
+    */
+    template <FloatType T>
+    void dbToGain(T* dest, const T* db, size_t size, T referenceMinDb) noexcept {
+        // 10^(db / 20) == e^(db * ln(10) / 20).
+        constexpr static auto dbToExponent = std::numbers::ln10_v<T> * static_cast<T>(0.05);
+        std::array<bool, s_conversionChunkSize> silent;
+        for (auto start = 0_sz; start < size; start += s_conversionChunkSize) {
+            const auto count = std::min<size_t>(s_conversionChunkSize, size - start);
+            for (auto i = 0_sz; i < count; ++i) {
+                silent[i] = !(db[start + i] > referenceMinDb);
+                dest[start + i] = silent[i] ? static_cast<T>(0.0) : db[start + i] * dbToExponent;
+            }
+            vecops::exp(dest + start, dest + start, count);
+            for (auto i = 0_sz; i < count; ++i) {
+                dest[start + i] = silent[i] ? static_cast<T>(0.0) : dest[start + i];
+            }
+        }
+    }
+
+    template <FloatType T>
+    void gainToDb(T* dest, const T* gain, size_t size, T minusInfDb) noexcept {
+        std::array<bool, s_conversionChunkSize> silent;
+        for (auto start = 0_sz; start < size; start += s_conversionChunkSize) {
+            const auto count = std::min<size_t>(s_conversionChunkSize, size - start);
+            for (auto i = 0_sz; i < count; ++i) {
+                const auto clamped = std::clamp(gain[start + i], static_cast<T>(0.0), static_cast<T>(1.0));
+                silent[i] = clamped <= static_cast<T>(0.0);
+                dest[start + i] = silent[i] ? static_cast<T>(1.0) : clamped;
+            }
+            vecops::log10(dest + start, dest + start, count);
+            for (auto i = 0_sz; i < count; ++i) {
+                dest[start + i] = silent[i] ? minusInfDb : std::max(static_cast<T>(20.0) * dest[start + i], minusInfDb);
+            }
+        }
+    }
+
+    template void dbToGain<float>(float*, const float*, size_t, float) noexcept;
+    template void dbToGain<double>(double*, const double*, size_t, double) noexcept;
+    template void gainToDb<float>(float*, const float*, size_t, float) noexcept;
+    template void gainToDb<double>(double*, const double*, size_t, double) noexcept;
+} // namespace marvin::math
@@ -10,6 +10,10 @@
 
 #include "marvin/math/marvin_VecOps.h"
 #include "marvin/library/marvin_Concepts.h"
+#include "marvin/library/marvin_Literals.h"
+#include "math/marvin_VecOpsKernels.h"
+#include <cmath>
+#include <complex>
 #if defined(MARVIN_MACOS)
 #include <Accelerate/Accelerate.h>
 #elif defined(MARVIN_HAS_IPP)
@@ -17,7 +21,33 @@
 #endif
 
 namespace marvin::math::vecops {
+    // The xsimd kernels are available on every backend, for anything vDSP / IPP don't have an equivalent for.
+    template <FloatType T>
+    [[nodiscard]] static const kernels::KernelTable<T>& getKernels() noexcept {
+        static const auto table = utils::simd::dispatch([]<class Arch>() { return kernels::makeKernelTable<Arch, T>(); });
+        return table;
+    }
+
 #if defined(MARVIN_MACOS)
+    [[nodiscard]] static DSPSplitComplex interleavedAsSplit(const std::complex<float>* data) noexcept {
+        // vDSP's split functions work on interleaved data with a stride of 2.
+        auto* asFloats = const_cast<float*>(reinterpret_cast<const float*>(data));
+        return { asFloats, asFloats + 1 };
+    }
+
+    [[nodiscard]] static DSPDoubleSplitComplex interleavedAsSplit(const std::complex<double>* data) noexcept {
+        auto* asDoubles = const_cast<double*>(reinterpret_cast<const double*>(data));
+        return { asDoubles, asDoubles + 1 };
+    }
+
+    [[nodiscard]] static DSPSplitComplex asSplit(SplitComplex<float> data) noexcept {
+        return { data.real, data.imag };
+    }
+
+    [[nodiscard]] static DSPDoubleSplitComplex asSplit(SplitComplex<double> data) noexcept {
+        return { data.real, data.imag };
+    }
+
     template <>
     void add<float>(float* lhs, const float* rhs, size_t size) noexcept {
         vDSP_vadd(lhs, 1, rhs, 1, lhs, 1, size);
@@ -99,6 +129,457 @@ namespace marvin::math::vecops {
         vDSP_vsdivD(arr, 1, &scalar, arr, 1, size);
     }
 
+    template <>
+    void add<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        vDSP_vadd(lhs, 1, rhs, 1, dest, 1, size);
+    }
+
+    template <>
+    void subtract<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        vDSP_vsub(rhs, 1, lhs, 1, dest, 1, size);
+    }
+
+    template <>
+    void multiply<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        vDSP_vmul(lhs, 1, rhs, 1, dest, 1, size);
+    }
+
+    template <>
+    void divide<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        vDSP_vdiv(rhs, 1, lhs, 1, dest, 1, size);
+    }
+
+    template <>
+    void copyWithGain<float>(float* dest, const float* src, float gain, size_t size) noexcept {
+        vDSP_vsmul(src, 1, &gain, dest, 1, size);
+    }
+
+    template <>
+    void multiplyAdd<float>(float* dest, const float* src, float gain, size_t size) noexcept {
+        vDSP_vsma(src, 1, &gain, dest, 1, dest, 1, size);
+    }
+
+    template <>
+    void multiplyAdd<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        vDSP_vma(lhs, 1, rhs, 1, dest, 1, dest, 1, size);
+    }
+
+    template <>
+    void addScaled<float>(float* dest, const float* a, float aGain, const float* b, float bGain, size_t size) noexcept {
+        vDSP_vsmsma(a, 1, &aGain, b, 1, &bGain, dest, 1, size);
+    }
+
+    template <>
+    void crossfade<float>(float* dest, const float* from, const float* to, const float* ramp, size_t size) noexcept {
+        // dest = (to - from) * ramp + from. Safe if dest aliases `to`, as the second pass reads `from` rather than `to`.
+        if (dest == from) {
+            for (auto i = 0_sz; i < size; ++i) {
+                dest[i] = from[i] + (to[i] - from[i]) * ramp[i];
+            }
+            return;
+        }
+        vDSP_vsub(from, 1, to, 1, dest, 1, size);
+        vDSP_vma(dest, 1, ramp, 1, from, 1, dest, 1, size);
+    }
+
+    template <>
+    void add<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        vDSP_vaddD(lhs, 1, rhs, 1, dest, 1, size);
+    }
+
+    template <>
+    void subtract<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        vDSP_vsubD(rhs, 1, lhs, 1, dest, 1, size);
+    }
+
+    template <>
+    void multiply<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        vDSP_vmulD(lhs, 1, rhs, 1, dest, 1, size);
+    }
+
+    template <>
+    void divide<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        vDSP_vdivD(rhs, 1, lhs, 1, dest, 1, size);
+    }
+
+    template <>
+    void copyWithGain<double>(double* dest, const double* src, double gain, size_t size) noexcept {
+        vDSP_vsmulD(src, 1, &gain, dest, 1, size);
+    }
+
+    template <>
+    void multiplyAdd<double>(double* dest, const double* src, double gain, size_t size) noexcept {
+        vDSP_vsmaD(src, 1, &gain, dest, 1, dest, 1, size);
+    }
+
+    template <>
+    void multiplyAdd<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        vDSP_vmaD(lhs, 1, rhs, 1, dest, 1, dest, 1, size);
+    }
+
+    template <>
+    void addScaled<double>(double* dest, const double* a, double aGain, const double* b, double bGain, size_t size) noexcept {
+        vDSP_vsmsmaD(a, 1, &aGain, b, 1, &bGain, dest, 1, size);
+    }
+
+    template <>
+    void crossfade<double>(double* dest, const double* from, const double* to, const double* ramp, size_t size) noexcept {
+        // dest = (to - from) * ramp + from. Safe if dest aliases `to`, as the second pass reads `from` rather than `to`.
+        if (dest == from) {
+            for (auto i = 0_sz; i < size; ++i) {
+                dest[i] = from[i] + (to[i] - from[i]) * ramp[i];
+            }
+            return;
+        }
+        vDSP_vsubD(from, 1, to, 1, dest, 1, size);
+        vDSP_vmaD(dest, 1, ramp, 1, from, 1, dest, 1, size);
+    }
+    template <>
+    float sum<float>(const float* arr, size_t size) noexcept {
+        float res{ 0.0 };
+        vDSP_sve(arr, 1, &res, size);
+        return res;
+    }
+
+    template <>
+    float dot<float>(const float* lhs, const float* rhs, size_t size) noexcept {
+        float res{ 0.0 };
+        vDSP_dotpr(lhs, 1, rhs, 1, &res, size);
+        return res;
+    }
+
+    template <>
+    float sumOfSquares<float>(const float* arr, size_t size) noexcept {
+        float res{ 0.0 };
+        vDSP_svesq(arr, 1, &res, size);
+        return res;
+    }
+
+    template <>
+    float rms<float>(const float* arr, size_t size) noexcept {
+        if (size == 0) return 0.0;
+        float res{ 0.0 };
+        vDSP_rmsqv(arr, 1, &res, size);
+        return res;
+    }
+
+    template <>
+    IndexedValue<float> maxAbs<float>(const float* arr, size_t size) noexcept {
+        if (size == 0) return { 0.0, 0 };
+        float value{ 0.0 };
+        vDSP_Length index{ 0 };
+        vDSP_maxmgvi(arr, 1, &value, &index, size);
+        return { value, static_cast<size_t>(index) };
+    }
+
+    template <>
+    utils::Range<float> minMax<float>(const float* arr, size_t size) noexcept {
+        if (size == 0) return { 0.0, 0.0 };
+        utils::Range<float> res{};
+        vDSP_minv(arr, 1, &res.min, size);
+        vDSP_maxv(arr, 1, &res.max, size);
+        return res;
+    }
+
+    template <>
+    double sum<double>(const double* arr, size_t size) noexcept {
+        double res{ 0.0 };
+        vDSP_sveD(arr, 1, &res, size);
+        return res;
+    }
+
+    template <>
+    double dot<double>(const double* lhs, const double* rhs, size_t size) noexcept {
+        double res{ 0.0 };
+        vDSP_dotprD(lhs, 1, rhs, 1, &res, size);
+        return res;
+    }
+
+    template <>
+    double sumOfSquares<double>(const double* arr, size_t size) noexcept {
+        double res{ 0.0 };
+        vDSP_svesqD(arr, 1, &res, size);
+        return res;
+    }
+
+    template <>
+    double rms<double>(const double* arr, size_t size) noexcept {
+        if (size == 0) return 0.0;
+        double res{ 0.0 };
+        vDSP_rmsqvD(arr, 1, &res, size);
+        return res;
+    }
+
+    template <>
+    IndexedValue<double> maxAbs<double>(const double* arr, size_t size) noexcept {
+        if (size == 0) return { 0.0, 0 };
+        double value{ 0.0 };
+        vDSP_Length index{ 0 };
+        vDSP_maxmgviD(arr, 1, &value, &index, size);
+        return { value, static_cast<size_t>(index) };
+    }
+
+    template <>
+    utils::Range<double> minMax<double>(const double* arr, size_t size) noexcept {
+        if (size == 0) return { 0.0, 0.0 };
+        utils::Range<double> res{};
+        vDSP_minvD(arr, 1, &res.min, size);
+        vDSP_maxvD(arr, 1, &res.max, size);
+        return res;
+    }
+
+    template <>
+    void exp<float>(float* dest, const float* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvexpf(dest, src, &n);
+    }
+
+    template <>
+    void log<float>(float* dest, const float* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvlogf(dest, src, &n);
+    }
+
+    template <>
+    void log10<float>(float* dest, const float* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvlog10f(dest, src, &n);
+    }
+
+    template <>
+    void tanh<float>(float* dest, const float* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvtanhf(dest, src, &n);
+    }
+
+    template <>
+    void sin<float>(float* dest, const float* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvsinf(dest, src, &n);
+    }
+
+    template <>
+    void cos<float>(float* dest, const float* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvcosf(dest, src, &n);
+    }
+
+    template <>
+    void pow<float>(float* dest, const float* base, const float* exponent, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvpowf(dest, exponent, base, &n);
+    }
+
+    template <>
+    void exp<double>(double* dest, const double* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvexp(dest, src, &n);
+    }
+
+    template <>
+    void log<double>(double* dest, const double* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvlog(dest, src, &n);
+    }
+
+    template <>
+    void log10<double>(double* dest, const double* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvlog10(dest, src, &n);
+    }
+
+    template <>
+    void tanh<double>(double* dest, const double* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvtanh(dest, src, &n);
+    }
+
+    template <>
+    void sin<double>(double* dest, const double* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvsin(dest, src, &n);
+    }
+
+    template <>
+    void cos<double>(double* dest, const double* src, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvcos(dest, src, &n);
+    }
+
+    template <>
+    void pow<double>(double* dest, const double* base, const double* exponent, size_t size) noexcept {
+        const auto n = static_cast<int>(size);
+        vvpow(dest, exponent, base, &n);
+    }
+
+    template <>
+    void multiply<std::complex<float>>(std::complex<float>* dest, const std::complex<float>* lhs, const std::complex<float>* rhs, size_t size) noexcept {
+        auto a = interleavedAsSplit(lhs), b = interleavedAsSplit(rhs), c = interleavedAsSplit(dest);
+        vDSP_zvmul(&a, 2, &b, 2, &c, 2, size, 1);
+    }
+
+    template <>
+    void multiplyAdd<std::complex<float>>(std::complex<float>* dest, const std::complex<float>* lhs, const std::complex<float>* rhs, size_t size) noexcept {
+        auto a = interleavedAsSplit(lhs), b = interleavedAsSplit(rhs), c = interleavedAsSplit(dest);
+        vDSP_zvma(&a, 2, &b, 2, &c, 2, &c, 2, size);
+    }
+
+    template <>
+    void conjugateMultiplyAdd<std::complex<float>>(std::complex<float>* dest, const std::complex<float>* lhs, const std::complex<float>* rhs, size_t size) noexcept {
+        // vDSP_zvcma conjugates its first argument.
+        auto a = interleavedAsSplit(lhs), b = interleavedAsSplit(rhs), c = interleavedAsSplit(dest);
+        vDSP_zvcma(&b, 2, &a, 2, &c, 2, &c, 2, size);
+    }
+
+    template <>
+    void magnitude<std::complex<float>>(float* dest, const std::complex<float>* src, size_t size) noexcept {
+        auto a = interleavedAsSplit(src);
+        vDSP_zvabs(&a, 2, dest, 1, size);
+    }
+
+    template <>
+    void magnitudeSquared<std::complex<float>>(float* dest, const std::complex<float>* src, size_t size) noexcept {
+        auto a = interleavedAsSplit(src);
+        vDSP_zvmags(&a, 2, dest, 1, size);
+    }
+
+    template <>
+    void phase<std::complex<float>>(float* dest, const std::complex<float>* src, size_t size) noexcept {
+        auto a = interleavedAsSplit(src);
+        vDSP_zvphas(&a, 2, dest, 1, size);
+    }
+
+    template <>
+    void polarToCartesian<std::complex<float>>(std::complex<float>* dest, const float* magnitudes, const float* phases, size_t size) noexcept {
+        getKernels<float>().polarToCartesian(dest, magnitudes, phases, size);
+    }
+
+    template <>
+    void multiply<float>(SplitComplex<float> dest, SplitComplex<float> lhs, SplitComplex<float> rhs, size_t size) noexcept {
+        auto a = asSplit(lhs), b = asSplit(rhs), c = asSplit(dest);
+        vDSP_zvmul(&a, 1, &b, 1, &c, 1, size, 1);
+    }
+
+    template <>
+    void multiplyAdd<float>(SplitComplex<float> dest, SplitComplex<float> lhs, SplitComplex<float> rhs, size_t size) noexcept {
+        auto a = asSplit(lhs), b = asSplit(rhs), c = asSplit(dest);
+        vDSP_zvma(&a, 1, &b, 1, &c, 1, &c, 1, size);
+    }
+
+    template <>
+    void conjugateMultiplyAdd<float>(SplitComplex<float> dest, SplitComplex<float> lhs, SplitComplex<float> rhs, size_t size) noexcept {
+        // vDSP_zvcma conjugates its first argument.
+        auto a = asSplit(lhs), b = asSplit(rhs), c = asSplit(dest);
+        vDSP_zvcma(&b, 1, &a, 1, &c, 1, &c, 1, size);
+    }
+
+    template <>
+    void magnitude<float>(float* dest, SplitComplex<float> src, size_t size) noexcept {
+        auto a = asSplit(src);
+        vDSP_zvabs(&a, 1, dest, 1, size);
+    }
+
+    template <>
+    void magnitudeSquared<float>(float* dest, SplitComplex<float> src, size_t size) noexcept {
+        auto a = asSplit(src);
+        vDSP_zvmags(&a, 1, dest, 1, size);
+    }
+
+    template <>
+    void phase<float>(float* dest, SplitComplex<float> src, size_t size) noexcept {
+        auto a = asSplit(src);
+        vDSP_zvphas(&a, 1, dest, 1, size);
+    }
+
+    template <>
+    void polarToCartesian<float>(SplitComplex<float> dest, const float* magnitudes, const float* phases, size_t size) noexcept {
+        getKernels<float>().splitPolarToCartesian(dest, magnitudes, phases, size);
+    }
+
+    template <>
+    void multiply<std::complex<double>>(std::complex<double>* dest, const std::complex<double>* lhs, const std::complex<double>* rhs, size_t size) noexcept {
+        auto a = interleavedAsSplit(lhs), b = interleavedAsSplit(rhs), c = interleavedAsSplit(dest);
+        vDSP_zvmulD(&a, 2, &b, 2, &c, 2, size, 1);
+    }
+
+    template <>
+    void multiplyAdd<std::complex<double>>(std::complex<double>* dest, const std::complex<double>* lhs, const std::complex<double>* rhs, size_t size) noexcept {
+        auto a = interleavedAsSplit(lhs), b = interleavedAsSplit(rhs), c = interleavedAsSplit(dest);
+        vDSP_zvmaD(&a, 2, &b, 2, &c, 2, &c, 2, size);
+    }
+
+    template <>
+    void conjugateMultiplyAdd<std::complex<double>>(std::complex<double>* dest, const std::complex<double>* lhs, const std::complex<double>* rhs, size_t size) noexcept {
+        // vDSP_zvcma conjugates its first argument.
+        auto a = interleavedAsSplit(lhs), b = interleavedAsSplit(rhs), c = interleavedAsSplit(dest);
+        vDSP_zvcmaD(&b, 2, &a, 2, &c, 2, &c, 2, size);
+    }
+
+    template <>
+    void magnitude<std::complex<double>>(double* dest, const std::complex<double>* src, size_t size) noexcept {
+        auto a = interleavedAsSplit(src);
+        vDSP_zvabsD(&a, 2, dest, 1, size);
+    }
+
+    template <>
+    void magnitudeSquared<std::complex<double>>(double* dest, const std::complex<double>* src, size_t size) noexcept {
+        auto a = interleavedAsSplit(src);
+        vDSP_zvmagsD(&a, 2, dest, 1, size);
+    }
+
+    template <>
+    void phase<std::complex<double>>(double* dest, const std::complex<double>* src, size_t size) noexcept {
+        auto a = interleavedAsSplit(src);
+        vDSP_zvphasD(&a, 2, dest, 1, size);
+    }
+
+    template <>
+    void polarToCartesian<std::complex<double>>(std::complex<double>* dest, const double* magnitudes, const double* phases, size_t size) noexcept {
+        getKernels<double>().polarToCartesian(dest, magnitudes, phases, size);
+    }
+
+    template <>
+    void multiply<double>(SplitComplex<double> dest, SplitComplex<double> lhs, SplitComplex<double> rhs, size_t size) noexcept {
+        auto a = asSplit(lhs), b = asSplit(rhs), c = asSplit(dest);
+        vDSP_zvmulD(&a, 1, &b, 1, &c, 1, size, 1);
+    }
+
+    template <>
+    void multiplyAdd<double>(SplitComplex<double> dest, SplitComplex<double> lhs, SplitComplex<double> rhs, size_t size) noexcept {
+        auto a = asSplit(lhs), b = asSplit(rhs), c = asSplit(dest);
+        vDSP_zvmaD(&a, 1, &b, 1, &c, 1, &c, 1, size);
+    }
+
+    template <>
+    void conjugateMultiplyAdd<double>(SplitComplex<double> dest, SplitComplex<double> lhs, SplitComplex<double> rhs, size_t size) noexcept {
+        // vDSP_zvcma conjugates its first argument.
+        auto a = asSplit(lhs), b = asSplit(rhs), c = asSplit(dest);
+        vDSP_zvcmaD(&b, 1, &a, 1, &c, 1, &c, 1, size);
+    }
+
+    template <>
+    void magnitude<double>(double* dest, SplitComplex<double> src, size_t size) noexcept {
+        auto a = asSplit(src);
+        vDSP_zvabsD(&a, 1, dest, 1, size);
+    }
+
+    template <>
+    void magnitudeSquared<double>(double* dest, SplitComplex<double> src, size_t size) noexcept {
+        auto a = asSplit(src);
+        vDSP_zvmagsD(&a, 1, dest, 1, size);
+    }
+
+    template <>
+    void phase<double>(double* dest, SplitComplex<double> src, size_t size) noexcept {
+        auto a = asSplit(src);
+        vDSP_zvphasD(&a, 1, dest, 1, size);
+    }
+
+    template <>
+    void polarToCartesian<double>(SplitComplex<double> dest, const double* magnitudes, const double* phases, size_t size) noexcept {
+        getKernels<double>().splitPolarToCartesian(dest, magnitudes, phases, size);
+    }
+
 #elif defined(MARVIN_HAS_IPP)
     template <>
     void add<float>(float* lhs, const float* rhs, size_t size) noexcept {
@@ -180,121 +661,942 @@ namespace marvin::math::vecops {
     void divide<double>(double* arr, double scalar, size_t size) noexcept {
         ippsDivC_64f_I(scalar, arr, static_cast<int>(size));
     }
-#else
+
     template <>
-    void add<float>(float* lhs, const float* rhs, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            lhs[i] += rhs[i];
-        }
+    void add<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        ippsAdd_32f(lhs, rhs, dest, static_cast<int>(size));
     }
 
     template <>
-    void add<double>(double* lhs, const double* rhs, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            lhs[i] += rhs[i];
-        }
+    void subtract<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        ippsSub_32f(rhs, lhs, dest, static_cast<int>(size));
     }
 
     template <>
-    void add<float>(float* arr, float scalar, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            arr[i] += scalar;
-        }
+    void multiply<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        ippsMul_32f(lhs, rhs, dest, static_cast<int>(size));
     }
 
     template <>
-    void add<double>(double* arr, double scalar, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            arr[i] += scalar;
-        }
+    void divide<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        ippsDiv_32f(rhs, lhs, dest, static_cast<int>(size));
     }
 
     template <>
-    void subtract<float>(float* lhs, const float* rhs, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            lhs[i] -= rhs[i];
-        }
+    void copyWithGain<float>(float* dest, const float* src, float gain, size_t size) noexcept {
+        ippsMulC_32f(src, gain, dest, static_cast<int>(size));
     }
 
     template <>
-    void subtract<double>(double* lhs, const double* rhs, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            lhs[i] -= rhs[i];
-        }
+    void multiplyAdd<float>(float* dest, const float* src, float gain, size_t size) noexcept {
+        ippsAddProductC_32f(src, gain, dest, static_cast<int>(size));
     }
 
     template <>
-    void subtract<float>(float* arr, float scalar, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            arr[i] -= scalar;
-        }
+    void multiplyAdd<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        ippsAddProduct_32f(lhs, rhs, dest, static_cast<int>(size));
     }
 
     template <>
-    void subtract<double>(double* arr, double scalar, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            arr[i] -= scalar;
+    void addScaled<float>(float* dest, const float* a, float aGain, const float* b, float bGain, size_t size) noexcept {
+        if (dest == b) {
+            ippsMulC_32f_I(bGain, dest, static_cast<int>(size));
+            ippsAddProductC_32f(a, aGain, dest, static_cast<int>(size));
+            return;
         }
+        ippsMulC_32f(a, aGain, dest, static_cast<int>(size));
+        ippsAddProductC_32f(b, bGain, dest, static_cast<int>(size));
     }
 
     template <>
-    void multiply<float>(float* lhs, const float* rhs, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            lhs[i] *= rhs[i];
+    void crossfade<float>(float* dest, const float* from, const float* to, const float* ramp, size_t size) noexcept {
+        if (dest == from) {
+            for (auto i = 0_sz; i < size; ++i) {
+                dest[i] = from[i] + (to[i] - from[i]) * ramp[i];
+            }
+            return;
         }
+        ippsSub_32f(from, to, dest, static_cast<int>(size));
+        ippsMul_32f_I(ramp, dest, static_cast<int>(size));
+        ippsAdd_32f_I(from, dest, static_cast<int>(size));
     }
 
     template <>
-    void multiply<double>(double* lhs, const double* rhs, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            lhs[i] *= rhs[i];
+    void add<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        ippsAdd_64f(lhs, rhs, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void subtract<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        ippsSub_64f(rhs, lhs, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void multiply<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        ippsMul_64f(lhs, rhs, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void divide<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        ippsDiv_64f(rhs, lhs, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void copyWithGain<double>(double* dest, const double* src, double gain, size_t size) noexcept {
+        ippsMulC_64f(src, gain, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void multiplyAdd<double>(double* dest, const double* src, double gain, size_t size) noexcept {
+        ippsAddProductC_64f(src, gain, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void multiplyAdd<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        ippsAddProduct_64f(lhs, rhs, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void addScaled<double>(double* dest, const double* a, double aGain, const double* b, double bGain, size_t size) noexcept {
+        if (dest == b) {
+            ippsMulC_64f_I(bGain, dest, static_cast<int>(size));
+            ippsAddProductC_64f(a, aGain, dest, static_cast<int>(size));
+            return;
         }
+        ippsMulC_64f(a, aGain, dest, static_cast<int>(size));
+        ippsAddProductC_64f(b, bGain, dest, static_cast<int>(size));
     }
 
     template <>
-    void multiply<float>(float* arr, float scalar, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            arr[i] *= scalar;
+    void crossfade<double>(double* dest, const double* from, const double* to, const double* ramp, size_t size) noexcept {
+        if (dest == from) {
+            for (auto i = 0_sz; i < size; ++i) {
+                dest[i] = from[i] + (to[i] - from[i]) * ramp[i];
+            }
+            return;
         }
+        ippsSub_64f(from, to, dest, static_cast<int>(size));
+        ippsMul_64f_I(ramp, dest, static_cast<int>(size));
+        ippsAdd_64f_I(from, dest, static_cast<int>(size));
+    }
+
+    template <>
+    float sum<float>(const float* arr, size_t size) noexcept {
+        if (size == 0) return 0.0;
+        float res{ 0.0 };
+        ippsSum_32f(arr, static_cast<int>(size), &res, ippAlgHintAccurate);
+        return res;
+    }
+
+    template <>
+    float dot<float>(const float* lhs, const float* rhs, size_t size) noexcept {
+        if (size == 0) return 0.0;
+        float res{ 0.0 };
+        ippsDotProd_32f(lhs, rhs, static_cast<int>(size), &res);
+        return res;
+    }
+
+    template <>
+    float sumOfSquares<float>(const float* arr, size_t size) noexcept {
+        return dot(arr, arr, size);
+    }
+
+    template <>
+    float rms<float>(const float* arr, size_t size) noexcept {
+        if (size == 0) return 0.0;
+        return std::sqrt(sumOfSquares(arr, size) / static_cast<float>(size));
+    }
+
+    template <>
+    IndexedValue<float> maxAbs<float>(const float* arr, size_t size) noexcept {
+        if (size == 0) return { 0.0, 0 };
+        float value{ 0.0 };
+        int index{ 0 };
+        ippsMaxAbsIndx_32f(arr, static_cast<int>(size), &value, &index);
+        return { value, static_cast<size_t>(index) };
+    }
+
+    template <>
+    utils::Range<float> minMax<float>(const float* arr, size_t size) noexcept {
+        if (size == 0) return { 0.0, 0.0 };
+        utils::Range<float> res{};
+        ippsMinMax_32f(arr, static_cast<int>(size), &res.min, &res.max);
+        return res;
+    }
+
+    template <>
+    double sum<double>(const double* arr, size_t size) noexcept {
+        if (size == 0) return 0.0;
+        double res{ 0.0 };
+        ippsSum_64f(arr, static_cast<int>(size), &res);
+        return res;
+    }
+
+    template <>
+    double dot<double>(const double* lhs, const double* rhs, size_t size) noexcept {
+        if (size == 0) return 0.0;
+        double res{ 0.0 };
+        ippsDotProd_64f(lhs, rhs, static_cast<int>(size), &res);
+        return res;
+    }
+
+    template <>
+    double sumOfSquares<double>(const double* arr, size_t size) noexcept {
+        return dot(arr, arr, size);
+    }
+
+    template <>
+    double rms<double>(const double* arr, size_t size) noexcept {
+        if (size == 0) return 0.0;
+        return std::sqrt(sumOfSquares(arr, size) / static_cast<double>(size));
+    }
+
+    template <>
+    IndexedValue<double> maxAbs<double>(const double* arr, size_t size) noexcept {
+        if (size == 0) return { 0.0, 0 };
+        double value{ 0.0 };
+        int index{ 0 };
+        ippsMaxAbsIndx_64f(arr, static_cast<int>(size), &value, &index);
+        return { value, static_cast<size_t>(index) };
+    }
+
+    template <>
+    utils::Range<double> minMax<double>(const double* arr, size_t size) noexcept {
+        if (size == 0) return { 0.0, 0.0 };
+        utils::Range<double> res{};
+        ippsMinMax_64f(arr, static_cast<int>(size), &res.min, &res.max);
+        return res;
+    }
+
+    template <>
+    void exp<float>(float* dest, const float* src, size_t size) noexcept {
+        ippsExp_32f_A24(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void log<float>(float* dest, const float* src, size_t size) noexcept {
+        ippsLn_32f_A24(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void log10<float>(float* dest, const float* src, size_t size) noexcept {
+        ippsLog10_32f_A24(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void tanh<float>(float* dest, const float* src, size_t size) noexcept {
+        ippsTanh_32f_A24(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void sin<float>(float* dest, const float* src, size_t size) noexcept {
+        ippsSin_32f_A24(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void cos<float>(float* dest, const float* src, size_t size) noexcept {
+        ippsCos_32f_A24(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void pow<float>(float* dest, const float* base, const float* exponent, size_t size) noexcept {
+        ippsPow_32f_A24(base, exponent, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void exp<double>(double* dest, const double* src, size_t size) noexcept {
+        ippsExp_64f_A53(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void log<double>(double* dest, const double* src, size_t size) noexcept {
+        ippsLn_64f_A53(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void log10<double>(double* dest, const double* src, size_t size) noexcept {
+        ippsLog10_64f_A53(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void tanh<double>(double* dest, const double* src, size_t size) noexcept {
+        ippsTanh_64f_A53(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void sin<double>(double* dest, const double* src, size_t size) noexcept {
+        ippsSin_64f_A53(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void cos<double>(double* dest, const double* src, size_t size) noexcept {
+        ippsCos_64f_A53(src, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void pow<double>(double* dest, const double* base, const double* exponent, size_t size) noexcept {
+        ippsPow_64f_A53(base, exponent, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void multiply<std::complex<float>>(std::complex<float>* dest, const std::complex<float>* lhs, const std::complex<float>* rhs, size_t size) noexcept {
+        ippsMul_32fc(reinterpret_cast<const Ipp32fc*>(lhs), reinterpret_cast<const Ipp32fc*>(rhs), reinterpret_cast<Ipp32fc*>(dest), static_cast<int>(size));
+    }
+
+    template <>
+    void multiplyAdd<std::complex<float>>(std::complex<float>* dest, const std::complex<float>* lhs, const std::complex<float>* rhs, size_t size) noexcept {
+        ippsAddProduct_32fc(reinterpret_cast<const Ipp32fc*>(lhs), reinterpret_cast<const Ipp32fc*>(rhs), reinterpret_cast<Ipp32fc*>(dest), static_cast<int>(size));
+    }
+
+    template <>
+    void conjugateMultiplyAdd<std::complex<float>>(std::complex<float>* dest, const std::complex<float>* lhs, const std::complex<float>* rhs, size_t size) noexcept {
+        // No single-pass IPP equivalent, so use the xsimd kernel rather than going via a temporary.
+        getKernels<float>().complexConjugateMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void magnitude<std::complex<float>>(float* dest, const std::complex<float>* src, size_t size) noexcept {
+        ippsMagnitude_32fc(reinterpret_cast<const Ipp32fc*>(src), dest, static_cast<int>(size));
+    }
+
+    template <>
+    void magnitudeSquared<std::complex<float>>(float* dest, const std::complex<float>* src, size_t size) noexcept {
+        ippsPowerSpectr_32fc(reinterpret_cast<const Ipp32fc*>(src), dest, static_cast<int>(size));
+    }
+
+    template <>
+    void phase<std::complex<float>>(float* dest, const std::complex<float>* src, size_t size) noexcept {
+        ippsPhase_32fc(reinterpret_cast<const Ipp32fc*>(src), dest, static_cast<int>(size));
+    }
+
+    template <>
+    void polarToCartesian<std::complex<float>>(std::complex<float>* dest, const float* magnitudes, const float* phases, size_t size) noexcept {
+        ippsPolarToCart_32fc(magnitudes, phases, reinterpret_cast<Ipp32fc*>(dest), static_cast<int>(size));
+    }
+
+    template <>
+    void multiply<float>(SplitComplex<float> dest, SplitComplex<float> lhs, SplitComplex<float> rhs, size_t size) noexcept {
+        getKernels<float>().splitMultiply(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void multiplyAdd<float>(SplitComplex<float> dest, SplitComplex<float> lhs, SplitComplex<float> rhs, size_t size) noexcept {
+        getKernels<float>().splitMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void conjugateMultiplyAdd<float>(SplitComplex<float> dest, SplitComplex<float> lhs, SplitComplex<float> rhs, size_t size) noexcept {
+        getKernels<float>().splitConjugateMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void magnitude<float>(float* dest, SplitComplex<float> src, size_t size) noexcept {
+        ippsMagnitude_32f(src.real, src.imag, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void magnitudeSquared<float>(float* dest, SplitComplex<float> src, size_t size) noexcept {
+        ippsPowerSpectr_32f(src.real, src.imag, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void phase<float>(float* dest, SplitComplex<float> src, size_t size) noexcept {
+        ippsPhase_32f(src.real, src.imag, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void polarToCartesian<float>(SplitComplex<float> dest, const float* magnitudes, const float* phases, size_t size) noexcept {
+        ippsPolarToCart_32f(magnitudes, phases, dest.real, dest.imag, static_cast<int>(size));
+    }
+
+    template <>
+    void multiply<std::complex<double>>(std::complex<double>* dest, const std::complex<double>* lhs, const std::complex<double>* rhs, size_t size) noexcept {
+        ippsMul_64fc(reinterpret_cast<const Ipp64fc*>(lhs), reinterpret_cast<const Ipp64fc*>(rhs), reinterpret_cast<Ipp64fc*>(dest), static_cast<int>(size));
+    }
+
+    template <>
+    void multiplyAdd<std::complex<double>>(std::complex<double>* dest, const std::complex<double>* lhs, const std::complex<double>* rhs, size_t size) noexcept {
+        ippsAddProduct_64fc(reinterpret_cast<const Ipp64fc*>(lhs), reinterpret_cast<const Ipp64fc*>(rhs), reinterpret_cast<Ipp64fc*>(dest), static_cast<int>(size));
+    }
+
+    template <>
+    void conjugateMultiplyAdd<std::complex<double>>(std::complex<double>* dest, const std::complex<double>* lhs, const std::complex<double>* rhs, size_t size) noexcept {
+        // No single-pass IPP equivalent, so use the xsimd kernel rather than going via a temporary.
+        getKernels<double>().complexConjugateMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void magnitude<std::complex<double>>(double* dest, const std::complex<double>* src, size_t size) noexcept {
+        ippsMagnitude_64fc(reinterpret_cast<const Ipp64fc*>(src), dest, static_cast<int>(size));
+    }
+
+    template <>
+    void magnitudeSquared<std::complex<double>>(double* dest, const std::complex<double>* src, size_t size) noexcept {
+        ippsPowerSpectr_64fc(reinterpret_cast<const Ipp64fc*>(src), dest, static_cast<int>(size));
+    }
+
+    template <>
+    void phase<std::complex<double>>(double* dest, const std::complex<double>* src, size_t size) noexcept {
+        ippsPhase_64fc(reinterpret_cast<const Ipp64fc*>(src), dest, static_cast<int>(size));
+    }
+
+    template <>
+    void polarToCartesian<std::complex<double>>(std::complex<double>* dest, const double* magnitudes, const double* phases, size_t size) noexcept {
+        ippsPolarToCart_64fc(magnitudes, phases, reinterpret_cast<Ipp64fc*>(dest), static_cast<int>(size));
+    }
+
+    template <>
+    void multiply<double>(SplitComplex<double> dest, SplitComplex<double> lhs, SplitComplex<double> rhs, size_t size) noexcept {
+        getKernels<double>().splitMultiply(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void multiplyAdd<double>(SplitComplex<double> dest, SplitComplex<double> lhs, SplitComplex<double> rhs, size_t size) noexcept {
+        getKernels<double>().splitMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void conjugateMultiplyAdd<double>(SplitComplex<double> dest, SplitComplex<double> lhs, SplitComplex<double> rhs, size_t size) noexcept {
+        getKernels<double>().splitConjugateMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void magnitude<double>(double* dest, SplitComplex<double> src, size_t size) noexcept {
+        ippsMagnitude_64f(src.real, src.imag, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void magnitudeSquared<double>(double* dest, SplitComplex<double> src, size_t size) noexcept {
+        ippsPowerSpectr_64f(src.real, src.imag, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void phase<double>(double* dest, SplitComplex<double> src, size_t size) noexcept {
+        ippsPhase_64f(src.real, src.imag, dest, static_cast<int>(size));
+    }
+
+    template <>
+    void polarToCartesian<double>(SplitComplex<double> dest, const double* magnitudes, const double* phases, size_t size) noexcept {
+        ippsPolarToCart_64f(magnitudes, phases, dest.real, dest.imag, static_cast<int>(size));
+    }
+#else
+    template <>
+    void add<float>(float* lhs, const float* rhs, size_t size) noexcept {
+        getKernels<float>().add(lhs, rhs, size);
+    }
+
+    template <>
+    void add<double>(double* lhs, const double* rhs, size_t size) noexcept {
+        getKernels<double>().add(lhs, rhs, size);
+    }
+
+    template <>
+    void add<float>(float* arr, float scalar, size_t size) noexcept {
+        getKernels<float>().addScalar(arr, scalar, size);
+    }
+
+    template <>
+    void add<double>(double* arr, double scalar, size_t size) noexcept {
+        getKernels<double>().addScalar(arr, scalar, size);
+    }
+
+    template <>
+    void subtract<float>(float* lhs, const float* rhs, size_t size) noexcept {
+        getKernels<float>().subtract(lhs, rhs, size);
+    }
+
+    template <>
+    void subtract<double>(double* lhs, const double* rhs, size_t size) noexcept {
+        getKernels<double>().subtract(lhs, rhs, size);
+    }
+
+    template <>
+    void subtract<float>(float* arr, float scalar, size_t size) noexcept {
+        getKernels<float>().subtractScalar(arr, scalar, size);
+    }
+
+    template <>
+    void subtract<double>(double* arr, double scalar, size_t size) noexcept {
+        getKernels<double>().subtractScalar(arr, scalar, size);
+    }
+
+    template <>
+    void multiply<float>(float* lhs, const float* rhs, size_t size) noexcept {
+        getKernels<float>().multiply(lhs, rhs, size);
+    }
+
+    template <>
+    void multiply<double>(double* lhs, const double* rhs, size_t size) noexcept {
+        getKernels<double>().multiply(lhs, rhs, size);
+    }
+
+    template <>
+    void multiply<float>(float* arr, float scalar, size_t size) noexcept {
+        getKernels<float>().multiplyScalar(arr, scalar, size);
     }
 
     template <>
     void multiply<double>(double* arr, double scalar, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            arr[i] *= scalar;
-        }
+        getKernels<double>().multiplyScalar(arr, scalar, size);
     }
 
     template <>
     void divide<float>(float* lhs, const float* rhs, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            lhs[i] /= rhs[i];
-        }
+        getKernels<float>().divide(lhs, rhs, size);
     }
 
     template <>
     void divide<double>(double* lhs, const double* rhs, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            lhs[i] /= rhs[i];
-        }
+        getKernels<double>().divide(lhs, rhs, size);
     }
 
     template <>
     void divide<float>(float* arr, float scalar, size_t size) noexcept {
-        for (auto i = 0_sz; i < size; ++i) {
-            arr[i] /= scalar;
-        }
+        getKernels<float>().divideScalar(arr, scalar, size);
     }
 
     template <>
     void divide<double>(double* arr, double scalar, size_t size) noexcept {
+        getKernels<double>().divideScalar(arr, scalar, size);
+    }
+
+    template <>
+    void add<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        getKernels<float>().addOutOfPlace(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void subtract<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        getKernels<float>().subtractOutOfPlace(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void multiply<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        getKernels<float>().multiplyOutOfPlace(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void divide<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        getKernels<float>().divideOutOfPlace(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void copyWithGain<float>(float* dest, const float* src, float gain, size_t size) noexcept {
+        getKernels<float>().copyWithGain(dest, src, gain, size);
+    }
+
+    template <>
+    void multiplyAdd<float>(float* dest, const float* src, float gain, size_t size) noexcept {
+        getKernels<float>().multiplyAddScalar(dest, src, gain, size);
+    }
+
+    template <>
+    void multiplyAdd<float>(float* dest, const float* lhs, const float* rhs, size_t size) noexcept {
+        getKernels<float>().multiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void addScaled<float>(float* dest, const float* a, float aGain, const float* b, float bGain, size_t size) noexcept {
+        getKernels<float>().addScaled(dest, a, aGain, b, bGain, size);
+    }
+
+    template <>
+    void crossfade<float>(float* dest, const float* from, const float* to, const float* ramp, size_t size) noexcept {
+        getKernels<float>().crossfade(dest, from, to, ramp, size);
+    }
+
+    template <>
+    void add<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        getKernels<double>().addOutOfPlace(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void subtract<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        getKernels<double>().subtractOutOfPlace(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void multiply<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        getKernels<double>().multiplyOutOfPlace(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void divide<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        getKernels<double>().divideOutOfPlace(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void copyWithGain<double>(double* dest, const double* src, double gain, size_t size) noexcept {
+        getKernels<double>().copyWithGain(dest, src, gain, size);
+    }
+
+    template <>
+    void multiplyAdd<double>(double* dest, const double* src, double gain, size_t size) noexcept {
+        getKernels<double>().multiplyAddScalar(dest, src, gain, size);
+    }
+
+    template <>
+    void multiplyAdd<double>(double* dest, const double* lhs, const double* rhs, size_t size) noexcept {
+        getKernels<double>().multiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void addScaled<double>(double* dest, const double* a, double aGain, const double* b, double bGain, size_t size) noexcept {
+        getKernels<double>().addScaled(dest, a, aGain, b, bGain, size);
+    }
+
+    template <>
+    void crossfade<double>(double* dest, const double* from, const double* to, const double* ramp, size_t size) noexcept {
+        getKernels<double>().crossfade(dest, from, to, ramp, size);
+    }
+
+    template <>
+    float sum<float>(const float* arr, size_t size) noexcept {
+        return getKernels<float>().sum(arr, size);
+    }
+
+    template <>
+    float dot<float>(const float* lhs, const float* rhs, size_t size) noexcept {
+        return getKernels<float>().dot(lhs, rhs, size);
+    }
+
+    template <>
+    float sumOfSquares<float>(const float* arr, size_t size) noexcept {
+        return getKernels<float>().sumOfSquares(arr, size);
+    }
+
+    template <>
+    float rms<float>(const float* arr, size_t size) noexcept {
+        if (size == 0) return 0.0;
+        return std::sqrt(sumOfSquares(arr, size) / static_cast<float>(size));
+    }
+
+    template <>
+    IndexedValue<float> maxAbs<float>(const float* arr, size_t size) noexcept {
+        return getKernels<float>().maxAbs(arr, size);
+    }
+
+    template <>
+    utils::Range<float> minMax<float>(const float* arr, size_t size) noexcept {
+        return getKernels<float>().minMax(arr, size);
+    }
+
+    template <>
+    double sum<double>(const double* arr, size_t size) noexcept {
+        return getKernels<double>().sum(arr, size);
+    }
+
+    template <>
+    double dot<double>(const double* lhs, const double* rhs, size_t size) noexcept {
+        return getKernels<double>().dot(lhs, rhs, size);
+    }
+
+    template <>
+    double sumOfSquares<double>(const double* arr, size_t size) noexcept {
+        return getKernels<double>().sumOfSquares(arr, size);
+    }
+
+    template <>
+    double rms<double>(const double* arr, size_t size) noexcept {
+        if (size == 0) return 0.0;
+        return std::sqrt(sumOfSquares(arr, size) / static_cast<double>(size));
+    }
+
+    template <>
+    IndexedValue<double> maxAbs<double>(const double* arr, size_t size) noexcept {
+        return getKernels<double>().maxAbs(arr, size);
+    }
+
+    template <>
+    utils::Range<double> minMax<double>(const double* arr, size_t size) noexcept {
+        return getKernels<double>().minMax(arr, size);
+    }
+
+    template <>
+    void exp<float>(float* dest, const float* src, size_t size) noexcept {
+        getKernels<float>().exp(dest, src, size);
+    }
+
+    template <>
+    void log<float>(float* dest, const float* src, size_t size) noexcept {
+        getKernels<float>().log(dest, src, size);
+    }
+
+    template <>
+    void log10<float>(float* dest, const float* src, size_t size) noexcept {
+        getKernels<float>().log10(dest, src, size);
+    }
+
+    template <>
+    void tanh<float>(float* dest, const float* src, size_t size) noexcept {
+        getKernels<float>().tanh(dest, src, size);
+    }
+
+    template <>
+    void sin<float>(float* dest, const float* src, size_t size) noexcept {
+        getKernels<float>().sin(dest, src, size);
+    }
+
+    template <>
+    void cos<float>(float* dest, const float* src, size_t size) noexcept {
+        getKernels<float>().cos(dest, src, size);
+    }
+
+    template <>
+    void pow<float>(float* dest, const float* base, const float* exponent, size_t size) noexcept {
+        getKernels<float>().pow(dest, base, exponent, size);
+    }
+
+    template <>
+    void exp<double>(double* dest, const double* src, size_t size) noexcept {
+        getKernels<double>().exp(dest, src, size);
+    }
+
+    template <>
+    void log<double>(double* dest, const double* src, size_t size) noexcept {
+        getKernels<double>().log(dest, src, size);
+    }
+
+    template <>
+    void log10<double>(double* dest, const double* src, size_t size) noexcept {
+        getKernels<double>().log10(dest, src, size);
+    }
+
+    template <>
+    void tanh<double>(double* dest, const double* src, size_t size) noexcept {
+        getKernels<double>().tanh(dest, src, size);
+    }
+
+    template <>
+    void sin<double>(double* dest, const double* src, size_t size) noexcept {
+        getKernels<double>().sin(dest, src, size);
+    }
+
+    template <>
+    void cos<double>(double* dest, const double* src, size_t size) noexcept {
+        getKernels<double>().cos(dest, src, size);
+    }
+
+    template <>
+    void pow<double>(double* dest, const double* base, const double* exponent, size_t size) noexcept {
+        getKernels<double>().pow(dest, base, exponent, size);
+    }
+
+    template <>
+    void multiply<std::complex<float>>(std::complex<float>* dest, const std::complex<float>* lhs, const std::complex<float>* rhs, size_t size) noexcept {
+        getKernels<float>().complexMultiply(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void multiplyAdd<std::complex<float>>(std::complex<float>* dest, const std::complex<float>* lhs, const std::complex<float>* rhs, size_t size) noexcept {
+        getKernels<float>().complexMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void conjugateMultiplyAdd<std::complex<float>>(std::complex<float>* dest, const std::complex<float>* lhs, const std::complex<float>* rhs, size_t size) noexcept {
+        getKernels<float>().complexConjugateMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void magnitude<std::complex<float>>(float* dest, const std::complex<float>* src, size_t size) noexcept {
+        getKernels<float>().magnitude(dest, src, size);
+    }
+
+    template <>
+    void magnitudeSquared<std::complex<float>>(float* dest, const std::complex<float>* src, size_t size) noexcept {
+        getKernels<float>().magnitudeSquared(dest, src, size);
+    }
+
+    template <>
+    void phase<std::complex<float>>(float* dest, const std::complex<float>* src, size_t size) noexcept {
+        getKernels<float>().phase(dest, src, size);
+    }
+
+    template <>
+    void polarToCartesian<std::complex<float>>(std::complex<float>* dest, const float* magnitudes, const float* phases, size_t size) noexcept {
+        getKernels<float>().polarToCartesian(dest, magnitudes, phases, size);
+    }
+
+    template <>
+    void multiply<float>(SplitComplex<float> dest, SplitComplex<float> lhs, SplitComplex<float> rhs, size_t size) noexcept {
+        getKernels<float>().splitMultiply(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void multiplyAdd<float>(SplitComplex<float> dest, SplitComplex<float> lhs, SplitComplex<float> rhs, size_t size) noexcept {
+        getKernels<float>().splitMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void conjugateMultiplyAdd<float>(SplitComplex<float> dest, SplitComplex<float> lhs, SplitComplex<float> rhs, size_t size) noexcept {
+        getKernels<float>().splitConjugateMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void magnitude<float>(float* dest, SplitComplex<float> src, size_t size) noexcept {
+        getKernels<float>().splitMagnitude(dest, src, size);
+    }
+
+    template <>
+    void magnitudeSquared<float>(float* dest, SplitComplex<float> src, size_t size) noexcept {
+        getKernels<float>().splitMagnitudeSquared(dest, src, size);
+    }
+
+    template <>
+    void phase<float>(float* dest, SplitComplex<float> src, size_t size) noexcept {
+        getKernels<float>().splitPhase(dest, src, size);
+    }
+
+    template <>
+    void polarToCartesian<float>(SplitComplex<float> dest, const float* magnitudes, const float* phases, size_t size) noexcept {
+        getKernels<float>().splitPolarToCartesian(dest, magnitudes, phases, size);
+    }
+
+    template <>
+    void multiply<std::complex<double>>(std::complex<double>* dest, const std::complex<double>* lhs, const std::complex<double>* rhs, size_t size) noexcept {
+        getKernels<double>().complexMultiply(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void multiplyAdd<std::complex<double>>(std::complex<double>* dest, const std::complex<double>* lhs, const std::complex<double>* rhs, size_t size) noexcept {
+        getKernels<double>().complexMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void conjugateMultiplyAdd<std::complex<double>>(std::complex<double>* dest, const std::complex<double>* lhs, const std::complex<double>* rhs, size_t size) noexcept {
+        getKernels<double>().complexConjugateMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void magnitude<std::complex<double>>(double* dest, const std::complex<double>* src, size_t size) noexcept {
+        getKernels<double>().magnitude(dest, src, size);
+    }
+
+    template <>
+    void magnitudeSquared<std::complex<double>>(double* dest, const std::complex<double>* src, size_t size) noexcept {
+        getKernels<double>().magnitudeSquared(dest, src, size);
+    }
+
+    template <>
+    void phase<std::complex<double>>(double* dest, const std::complex<double>* src, size_t size) noexcept {
+        getKernels<double>().phase(dest, src, size);
+    }
+
+    template <>
+    void polarToCartesian<std::complex<double>>(std::complex<double>* dest, const double* magnitudes, const double* phases, size_t size) noexcept {
+        getKernels<double>().polarToCartesian(dest, magnitudes, phases, size);
+    }
+
+    template <>
+    void multiply<double>(SplitComplex<double> dest, SplitComplex<double> lhs, SplitComplex<double> rhs, size_t size) noexcept {
+        getKernels<double>().splitMultiply(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void multiplyAdd<double>(SplitComplex<double> dest, SplitComplex<double> lhs, SplitComplex<double> rhs, size_t size) noexcept {
+        getKernels<double>().splitMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void conjugateMultiplyAdd<double>(SplitComplex<double> dest, SplitComplex<double> lhs, SplitComplex<double> rhs, size_t size) noexcept {
+        getKernels<double>().splitConjugateMultiplyAdd(dest, lhs, rhs, size);
+    }
+
+    template <>
+    void magnitude<double>(double* dest, SplitComplex<double> src, size_t size) noexcept {
+        getKernels<double>().splitMagnitude(dest, src, size);
+    }
+
+    template <>
+    void magnitudeSquared<double>(double* dest, SplitComplex<double> src, size_t size) noexcept {
+        getKernels<double>().splitMagnitudeSquared(dest, src, size);
+    }
+
+    template <>
+    void phase<double>(double* dest, SplitComplex<double> src, size_t size) noexcept {
+        getKernels<double>().splitPhase(dest, src, size);
+    }
+
+    template <>
+    void polarToCartesian<double>(SplitComplex<double> dest, const double* magnitudes, const double* phases, size_t size) noexcept {
+        getKernels<double>().splitPolarToCartesian(dest, magnitudes, phases, size);
+    }
+
+#endif
+
+    // Conversions and (de)interleaving use the xsimd kernels on every backend.
+    template <FloatType T>
+    void interleave(T* dest, const T* const* channels, size_t numChannels, size_t numSamples) noexcept {
+        getKernels<T>().interleave(dest, channels, numChannels, numSamples);
+    }
+
+    template <FloatType T>
+    void deinterleave(T* const* channels, const T* src, size_t numChannels, size_t numSamples) noexcept {
+        getKernels<T>().deinterleave(channels, src, numChannels, numSamples);
+    }
+
+    template <FloatType T>
+    void TriangularDither::fill(T* dest, size_t size) noexcept {
         for (auto i = 0_sz; i < size; ++i) {
-            arr[i] /= scalar;
+            dest[i] = next<T>();
         }
     }
 
+    template <FloatType T>
+    void intToFloat(T* dest, const std::byte* src, SampleFormat srcFormat, size_t size) noexcept {
+        getKernels<T>().decode(dest, src, srcFormat, size, 1);
+    }
 
-#endif
+    template <FloatType T>
+    void floatToInt(std::byte* dest, SampleFormat destFormat, const T* src, size_t size) noexcept {
+        getKernels<T>().encode(dest, destFormat, src, size, 1, nullptr);
+    }
+
+    template <FloatType T>
+    void floatToInt(std::byte* dest, SampleFormat destFormat, const T* src, size_t size, TriangularDither& dither) noexcept {
+        getKernels<T>().encode(dest, destFormat, src, size, 1, &dither);
+    }
+
+    template <FloatType T>
+    void deinterleave(T* const* channels, const std::byte* src, SampleFormat srcFormat, size_t numChannels, size_t numSamples) noexcept {
+        const auto bytesPerSample = getBytesPerSample(srcFormat);
+        for (auto channel = 0_sz; channel < numChannels; ++channel) {
+            getKernels<T>().decode(channels[channel], src + channel * bytesPerSample, srcFormat, numSamples, numChannels);
+        }
+    }
 
+    template <FloatType T>
+    void interleave(std::byte* dest, SampleFormat destFormat, const T* const* channels, size_t numChannels, size_t numSamples) noexcept {
+        const auto bytesPerSample = getBytesPerSample(destFormat);
+        for (auto channel = 0_sz; channel < numChannels; ++channel) {
+            getKernels<T>().encode(dest + channel * bytesPerSample, destFormat, channels[channel], numSamples, numChannels, nullptr);
+        }
+    }
+
+    template <FloatType T>
+    void interleave(std::byte* dest, SampleFormat destFormat, const T* const* channels, size_t numChannels, size_t numSamples, TriangularDither& dither) noexcept {
+        const auto bytesPerSample = getBytesPerSample(destFormat);
+        for (auto channel = 0_sz; channel < numChannels; ++channel) {
+            getKernels<T>().encode(dest + channel * bytesPerSample, destFormat, channels[channel], numSamples, numChannels, &dither);
+        }
+    }
 
+    template void interleave<float>(float*, const float* const*, size_t, size_t) noexcept;
+    template void interleave<double>(double*, const double* const*, size_t, size_t) noexcept;
+    template void deinterleave<float>(float* const*, const float*, size_t, size_t) noexcept;
+    template void deinterleave<double>(double* const*, const double*, size_t, size_t) noexcept;
+    template void TriangularDither::fill<float>(float*, size_t) noexcept;
+    template void TriangularDither::fill<double>(double*, size_t) noexcept;
+    template void intToFloat<float>(float*, const std::byte*, SampleFormat, size_t) noexcept;
+    template void intToFloat<double>(double*, const std::byte*, SampleFormat, size_t) noexcept;
+    template void floatToInt<float>(std::byte*, SampleFormat, const float*, size_t) noexcept;
+    template void floatToInt<double>(std::byte*, SampleFormat, const double*, size_t) noexcept;
+    template void floatToInt<float>(std::byte*, SampleFormat, const float*, size_t, TriangularDither&) noexcept;
+    template void floatToInt<double>(std::byte*, SampleFormat, const double*, size_t, TriangularDither&) noexcept;
+    template void deinterleave<float>(float* const*, const std::byte*, SampleFormat, size_t, size_t) noexcept;
+    template void deinterleave<double>(double* const*, const std::byte*, SampleFormat, size_t, size_t) noexcept;
+    template void interleave<float>(std::byte*, SampleFormat, const float* const*, size_t, size_t) noexcept;
+    template void interleave<double>(std::byte*, SampleFormat, const double* const*, size_t, size_t) noexcept;
+    template void interleave<float>(std::byte*, SampleFormat, const float* const*, size_t, size_t, TriangularDither&) noexcept;
+    template void interleave<double>(std::byte*, SampleFormat, const double* const*, size_t, size_t, TriangularDither&) noexcept;
 } // namespace marvin::math::vecops
\ No newline at end of file
@@ -0,0 +1,946 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_VECOPSKERNELS_H
+#define MARVIN_VECOPSKERNELS_H
+#include "marvin/library/marvin_Concepts.h"
+#include "marvin/library/marvin_Literals.h"
+#include "marvin/math/marvin_VecOps.h"
+#include "marvin/utils/marvin_Range.h"
+#include "utils/marvin_SIMDDispatchImpl.h"
+#include <xsimd/xsimd.hpp>
+#include <type_traits>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+/*
+    Everything in here is compiled once per arch, with that arch's `-m` flags. Any inline function or template instantiation that isn't templated on the arch
+    would get the same mangled name in every arch's TU, and the linker keeps whichever copy it sees first - so the baseline TUs could end up calling a wide copy.
+    So the kernels don't call into the standard library (no `std::array`, `std::copy`, `std::min`, `std::complex` members and so on), and anything they do share
+    is templated on `Arch`. The `marvin-kernel-symbols` test checks the objects for overlaps.
+*/
+namespace marvin::math::vecops::kernels {
+    /*
+        Applies `op` element-wise to `lhs` and `rhs`, storing the result in `dest`. `dest` may alias either input. `op` is called with either a pair of `xsimd::batch<T, Arch>`s
+        or a pair of `T`s (for the tail that doesn't fill a full batch), so it needs to be a generic lambda.
+        Takes the aligned load / store path if all pointers are aligned to the batch's alignment, otherwise falls back to unaligned loads and stores.
+    */
+    template <class Arch, FloatType T, typename Op>
+    void binaryOp(T* dest, const T* lhs, const T* rhs, size_t size, Op&& op) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        const auto vecSize = size - size % simdSize;
+        if (xsimd::is_aligned<Arch>(dest) && xsimd::is_aligned<Arch>(lhs) && xsimd::is_aligned<Arch>(rhs)) {
+            for (auto i = 0_sz; i < vecSize; i += simdSize) {
+                const auto a = BatchType::load_aligned(lhs + i);
+                const auto b = BatchType::load_aligned(rhs + i);
+                op(a, b).store_aligned(dest + i);
+            }
+        } else {
+            for (auto i = 0_sz; i < vecSize; i += simdSize) {
+                const auto a = BatchType::load_unaligned(lhs + i);
+                const auto b = BatchType::load_unaligned(rhs + i);
+                op(a, b).store_unaligned(dest + i);
+            }
+        }
+        for (auto i = vecSize; i < size; ++i) {
+            dest[i] = op(lhs[i], rhs[i]);
+        }
+    }
+
+    /*
+        Three-input version of `binaryOp`, for the fused kernels. Same rules apply.
+    */
+    template <class Arch, FloatType T, typename Op>
+    void ternaryOp(T* dest, const T* a, const T* b, const T* c, size_t size, Op&& op) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        const auto vecSize = size - size % simdSize;
+        if (xsimd::is_aligned<Arch>(dest) && xsimd::is_aligned<Arch>(a) && xsimd::is_aligned<Arch>(b) && xsimd::is_aligned<Arch>(c)) {
+            for (auto i = 0_sz; i < vecSize; i += simdSize) {
+                op(BatchType::load_aligned(a + i), BatchType::load_aligned(b + i), BatchType::load_aligned(c + i)).store_aligned(dest + i);
+            }
+        } else {
+            for (auto i = 0_sz; i < vecSize; i += simdSize) {
+                op(BatchType::load_unaligned(a + i), BatchType::load_unaligned(b + i), BatchType::load_unaligned(c + i)).store_unaligned(dest + i);
+            }
+        }
+        for (auto i = vecSize; i < size; ++i) {
+            dest[i] = op(a[i], b[i], c[i]);
+        }
+    }
+
+    /*
+        Applies `op` element-wise to `src` and `scalar`, storing the result in `dest`. `dest` may alias `src`. Same rules as `binaryOp` apply to `op`.
+    */
+    template <class Arch, FloatType T, typename Op>
+    void scalarOp(T* dest, const T* src, T scalar, size_t size, Op&& op) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        const auto vecSize = size - size % simdSize;
+        const auto scalarBatch = BatchType::broadcast(scalar);
+        if (xsimd::is_aligned<Arch>(dest) && xsimd::is_aligned<Arch>(src)) {
+            for (auto i = 0_sz; i < vecSize; i += simdSize) {
+                const auto a = BatchType::load_aligned(src + i);
+                op(a, scalarBatch).store_aligned(dest + i);
+            }
+        } else {
+            for (auto i = 0_sz; i < vecSize; i += simdSize) {
+                const auto a = BatchType::load_unaligned(src + i);
+                op(a, scalarBatch).store_unaligned(dest + i);
+            }
+        }
+        for (auto i = vecSize; i < size; ++i) {
+            dest[i] = op(src[i], scalar);
+        }
+    }
+
+    /*
+        The ops are templated on the arch (even though they don't use it) so each arch's TU gets its own closure types. Otherwise the scalar tail's
+        instantiations would share a mangled name across TUs built with different `-m` flags, and the linker could hand the baseline TU a wide copy.
+    */
+    template <class Arch>
+    inline constexpr auto addOp = [](const auto& a, const auto& b) { return a + b; };
+    template <class Arch>
+    inline constexpr auto subtractOp = [](const auto& a, const auto& b) { return a - b; };
+    template <class Arch>
+    inline constexpr auto multiplyOp = [](const auto& a, const auto& b) { return a * b; };
+    template <class Arch>
+    inline constexpr auto divideOp = [](const auto& a, const auto& b) { return a / b; };
+
+    template <class Arch, FloatType T>
+    void add(T* lhs, const T* rhs, size_t size) noexcept {
+        binaryOp<Arch>(lhs, lhs, rhs, size, addOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void addOutOfPlace(T* dest, const T* lhs, const T* rhs, size_t size) noexcept {
+        binaryOp<Arch>(dest, lhs, rhs, size, addOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void addScalar(T* arr, T scalar, size_t size) noexcept {
+        scalarOp<Arch>(arr, arr, scalar, size, addOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void subtract(T* lhs, const T* rhs, size_t size) noexcept {
+        binaryOp<Arch>(lhs, lhs, rhs, size, subtractOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void subtractOutOfPlace(T* dest, const T* lhs, const T* rhs, size_t size) noexcept {
+        binaryOp<Arch>(dest, lhs, rhs, size, subtractOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void subtractScalar(T* arr, T scalar, size_t size) noexcept {
+        scalarOp<Arch>(arr, arr, scalar, size, subtractOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void multiply(T* lhs, const T* rhs, size_t size) noexcept {
+        binaryOp<Arch>(lhs, lhs, rhs, size, multiplyOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void multiplyOutOfPlace(T* dest, const T* lhs, const T* rhs, size_t size) noexcept {
+        binaryOp<Arch>(dest, lhs, rhs, size, multiplyOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void multiplyScalar(T* arr, T scalar, size_t size) noexcept {
+        scalarOp<Arch>(arr, arr, scalar, size, multiplyOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void divide(T* lhs, const T* rhs, size_t size) noexcept {
+        binaryOp<Arch>(lhs, lhs, rhs, size, divideOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void divideOutOfPlace(T* dest, const T* lhs, const T* rhs, size_t size) noexcept {
+        binaryOp<Arch>(dest, lhs, rhs, size, divideOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void divideScalar(T* arr, T scalar, size_t size) noexcept {
+        scalarOp<Arch>(arr, arr, scalar, size, divideOp<Arch>);
+    }
+
+    template <class Arch, FloatType T>
+    void copyWithGain(T* dest, const T* src, T gain, size_t size) noexcept {
+        scalarOp<Arch>(dest, src, gain, size, multiplyOp<Arch>);
+    }
+
+    /*
+        `xsimd::fma` for batches. The scalar tails use a plain (unfused) multiply-add instead - the scalar `xsimd::fma` and `std::fma` overloads aren't templated
+        on the arch, so calling them would share their instantiations with the baseline TUs.
+    */
+    template <class Arch, typename V>
+    [[nodiscard]] V fusedMultiplyAdd(const V& a, const V& b, const V& c) noexcept {
+        if constexpr (std::is_floating_point_v<V>) {
+            return a * b + c;
+        } else {
+            return xsimd::fma(a, b, c);
+        }
+    }
+
+    template <class Arch, FloatType T>
+    void multiplyAdd(T* dest, const T* lhs, const T* rhs, size_t size) noexcept {
+        ternaryOp<Arch>(dest, lhs, rhs, dest, size, [](const auto& a, const auto& b, const auto& c) { return fusedMultiplyAdd<Arch>(a, b, c); });
+    }
+
+    template <class Arch, FloatType T>
+    void multiplyAddScalar(T* dest, const T* src, T gain, size_t size) noexcept {
+        binaryOp<Arch>(dest, dest, src, size, [gain](const auto& acc, const auto& x) {
+            using ValueType = std::decay_t<decltype(acc)>;
+            return fusedMultiplyAdd<Arch>(x, ValueType(gain), acc);
+        });
+    }
+
+    template <class Arch, FloatType T>
+    void addScaled(T* dest, const T* a, T aGain, const T* b, T bGain, size_t size) noexcept {
+        binaryOp<Arch>(dest, a, b, size, [aGain, bGain](const auto& x, const auto& y) {
+            using ValueType = std::decay_t<decltype(x)>;
+            return fusedMultiplyAdd<Arch>(y, ValueType(bGain), x * ValueType(aGain));
+        });
+    }
+
+    template <class Arch, FloatType T>
+    void crossfade(T* dest, const T* from, const T* to, const T* ramp, size_t size) noexcept {
+        ternaryOp<Arch>(dest, from, to, ramp, size, [](const auto& a, const auto& b, const auto& r) { return fusedMultiplyAdd<Arch>(r, b - a, a); });
+    }
+
+    /*
+        Applies `op` element-wise to the `sources`, storing the result in `dest`, for the transcendental kernels. Unlike `binaryOp`, the tail is
+        padded out to a full batch (with 1s, which are in-domain for everything we call this with) rather than handled with scalar code, so every element
+        goes through the same xsimd polynomial, rather than the tail silently falling back to `std::`.
+    */
+    template <class Arch, FloatType T, typename Op, typename... Sources>
+    void paddedOp(T* dest, size_t size, Op&& op, Sources... sources) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        const auto vecSize = size - size % simdSize;
+        for (auto i = 0_sz; i < vecSize; i += simdSize) {
+            op(BatchType::load_unaligned(sources + i)...).store_unaligned(dest + i);
+        }
+        if (vecSize == size) return;
+        const auto loadTail = [vecSize, size](const T* source) {
+            T padded[simdSize];
+            for (auto i = 0_sz; i < simdSize; ++i) {
+                padded[i] = vecSize + i < size ? source[vecSize + i] : static_cast<T>(1.0);
+            }
+            return BatchType::load_unaligned(padded);
+        };
+        T res[simdSize];
+        op(loadTail(sources)...).store_unaligned(res);
+        for (auto i = vecSize; i < size; ++i) {
+            dest[i] = res[i - vecSize];
+        }
+    }
+
+    template <class Arch, FloatType T>
+    void exp(T* dest, const T* src, size_t size) noexcept {
+        paddedOp<Arch>(dest, size, [](const auto& x) { return xsimd::exp(x); }, src);
+    }
+
+    template <class Arch, FloatType T>
+    void log(T* dest, const T* src, size_t size) noexcept {
+        paddedOp<Arch>(dest, size, [](const auto& x) { return xsimd::log(x); }, src);
+    }
+
+    template <class Arch, FloatType T>
+    void log10(T* dest, const T* src, size_t size) noexcept {
+        paddedOp<Arch>(dest, size, [](const auto& x) { return xsimd::log10(x); }, src);
+    }
+
+    template <class Arch, FloatType T>
+    void tanh(T* dest, const T* src, size_t size) noexcept {
+        paddedOp<Arch>(dest, size, [](const auto& x) { return xsimd::tanh(x); }, src);
+    }
+
+    template <class Arch, FloatType T>
+    void sin(T* dest, const T* src, size_t size) noexcept {
+        paddedOp<Arch>(dest, size, [](const auto& x) { return xsimd::sin(x); }, src);
+    }
+
+    template <class Arch, FloatType T>
+    void cos(T* dest, const T* src, size_t size) noexcept {
+        paddedOp<Arch>(dest, size, [](const auto& x) { return xsimd::cos(x); }, src);
+    }
+
+    template <class Arch, FloatType T>
+    void pow(T* dest, const T* base, const T* exponent, size_t size) noexcept {
+        paddedOp<Arch>(dest, size, [](const auto& x, const auto& y) { return xsimd::pow(x, y); }, base, exponent);
+    }
+
+    /*
+        Reductions accumulate into a fixed 64 byte wide set of lanes, regardless of the width of `Arch` (so 4 SSE batches, 2 AVX batches or 1 AVX-512 batch),
+        and element `i` always lands in lane `i % numLanes`. The lanes are then summed with a fixed pairwise tree, so the summation order (and therefore the
+        result) doesn't depend on which instruction set was picked at runtime.
+    */
+    inline constexpr size_t reductionBytes{ 64 };
+
+    /*
+        Loads either a single value or a batch, depending on `V`. Templated on the arch so the scalar instantiation isn't shared between arch TUs.
+    */
+    template <class Arch, typename V, FloatType T>
+    [[nodiscard]] V loadAs(const T* ptr) noexcept {
+        if constexpr (std::is_same_v<V, T>) {
+            return *ptr;
+        } else {
+            return V::load_unaligned(ptr);
+        }
+    }
+
+    /*
+        `term` is called as `term(std::type_identity<V>{}, i)`, and should return the value (or batch of values, if `V` is a batch) to accumulate for index `i`.
+    */
+    template <class Arch, FloatType T, typename Term>
+    [[nodiscard]] T reduceSum(size_t size, Term&& term) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        constexpr static auto numLanes = reductionBytes / sizeof(T);
+        static_assert(numLanes % simdSize == 0);
+        constexpr static auto numAccumulators = numLanes / simdSize;
+        BatchType accumulators[numAccumulators];
+        for (auto acc = 0_sz; acc < numAccumulators; ++acc) {
+            accumulators[acc] = BatchType::broadcast(static_cast<T>(0.0));
+        }
+        const auto vecSize = size - size % numLanes;
+        for (auto i = 0_sz; i < vecSize; i += numLanes) {
+            for (auto acc = 0_sz; acc < numAccumulators; ++acc) {
+                accumulators[acc] += term(std::type_identity<BatchType>{}, i + acc * simdSize);
+            }
+        }
+        alignas(reductionBytes) T lanes[numLanes];
+        for (auto acc = 0_sz; acc < numAccumulators; ++acc) {
+            accumulators[acc].store_unaligned(lanes + acc * simdSize);
+        }
+        for (auto i = vecSize; i < size; ++i) {
+            lanes[i - vecSize] += term(std::type_identity<T>{}, i);
+        }
+        for (auto width = numLanes / 2; width > 0; width /= 2) {
+            for (auto lane = 0_sz; lane < width; ++lane) {
+                lanes[lane] += lanes[lane + width];
+            }
+        }
+        return lanes[0];
+    }
+
+    template <class Arch, FloatType T>
+    [[nodiscard]] T sum(const T* arr, size_t size) noexcept {
+        return reduceSum<Arch, T>(size, [arr]<typename V>(std::type_identity<V>, size_t i) { return loadAs<Arch, V>(arr + i); });
+    }
+
+    template <class Arch, FloatType T>
+    [[nodiscard]] T dot(const T* lhs, const T* rhs, size_t size) noexcept {
+        return reduceSum<Arch, T>(size, [lhs, rhs]<typename V>(std::type_identity<V>, size_t i) { return loadAs<Arch, V>(lhs + i) * loadAs<Arch, V>(rhs + i); });
+    }
+
+    template <class Arch, FloatType T>
+    [[nodiscard]] T sumOfSquares(const T* arr, size_t size) noexcept {
+        return reduceSum<Arch, T>(size, [arr]<typename V>(std::type_identity<V>, size_t i) {
+            const auto x = loadAs<Arch, V>(arr + i);
+            return x * x;
+        });
+    }
+
+    template <class Arch, FloatType T>
+    [[nodiscard]] IndexedValue<T> maxAbs(const T* arr, size_t size) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        if (size == 0) return { static_cast<T>(0.0), 0 };
+        const auto vecSize = size - size % simdSize;
+        // First pass finds the peak, second pass finds the first index it occurs at - max is exact, so this is deterministic.
+        auto peakBatch = BatchType::broadcast(static_cast<T>(0.0));
+        for (auto i = 0_sz; i < vecSize; i += simdSize) {
+            peakBatch = xsimd::max(peakBatch, xsimd::abs(BatchType::load_unaligned(arr + i)));
+        }
+        auto peak = xsimd::reduce_max(peakBatch);
+        for (auto i = vecSize; i < size; ++i) {
+            const auto x = arr[i] < static_cast<T>(0.0) ? -arr[i] : arr[i];
+            peak = peak < x ? x : peak;
+        }
+        const auto peakBroadcast = BatchType::broadcast(peak);
+        auto searchStart = 0_sz;
+        for (; searchStart < vecSize; searchStart += simdSize) {
+            if (xsimd::any(xsimd::abs(BatchType::load_unaligned(arr + searchStart)) == peakBroadcast)) break;
+        }
+        for (auto i = searchStart; i < size; ++i) {
+            if (arr[i] == peak || -arr[i] == peak) return { peak, i };
+        }
+        return { peak, 0 };
+    }
+
+    template <class Arch, FloatType T>
+    [[nodiscard]] utils::Range<T> minMax(const T* arr, size_t size) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        if (size == 0) return { static_cast<T>(0.0), static_cast<T>(0.0) };
+        const auto vecSize = size - size % simdSize;
+        auto minBatch = BatchType::broadcast(arr[0]);
+        auto maxBatch = minBatch;
+        for (auto i = 0_sz; i < vecSize; i += simdSize) {
+            const auto x = BatchType::load_unaligned(arr + i);
+            minBatch = xsimd::min(minBatch, x);
+            maxBatch = xsimd::max(maxBatch, x);
+        }
+        utils::Range<T> res{ .min = xsimd::reduce_min(minBatch), .max = xsimd::reduce_max(maxBatch) };
+        for (auto i = vecSize; i < size; ++i) {
+            res.min = arr[i] < res.min ? arr[i] : res.min;
+            res.max = res.max < arr[i] ? arr[i] : res.max;
+        }
+        return res;
+    }
+
+    /*
+        Complex kernels are written once against complex batches, and work on either interleaved `std::complex<T>*` or `SplitComplex<T>` data -
+        `loadBatch`, `storeBatch` and `offsetBy` below hide the difference (plus plain `T*` for the real inputs / outputs).
+    */
+    template <class Arch, FloatType T>
+    [[nodiscard]] auto loadBatch(const T* ptr) noexcept {
+        return xsimd::batch<T, Arch>::load_unaligned(ptr);
+    }
+
+    template <class Arch, FloatType T>
+    [[nodiscard]] auto loadBatch(const std::complex<T>* ptr) noexcept {
+        return xsimd::batch<std::complex<T>, Arch>::load_unaligned(ptr);
+    }
+
+    template <class Arch, FloatType T>
+    [[nodiscard]] auto loadBatch(SplitComplex<T> ptr) noexcept {
+        using RealBatch = xsimd::batch<T, Arch>;
+        return xsimd::batch<std::complex<T>, Arch>{ RealBatch::load_unaligned(ptr.real), RealBatch::load_unaligned(ptr.imag) };
+    }
+
+    template <class Arch, FloatType T>
+    void storeBatch(T* ptr, const xsimd::batch<T, Arch>& batch) noexcept {
+        batch.store_unaligned(ptr);
+    }
+
+    template <class Arch, FloatType T>
+    void storeBatch(std::complex<T>* ptr, const xsimd::batch<std::complex<T>, Arch>& batch) noexcept {
+        batch.store_unaligned(ptr);
+    }
+
+    template <class Arch, FloatType T>
+    void storeBatch(SplitComplex<T> ptr, const xsimd::batch<std::complex<T>, Arch>& batch) noexcept {
+        batch.real().store_unaligned(ptr.real);
+        batch.imag().store_unaligned(ptr.imag);
+    }
+
+    /*
+        These helpers (and `PaddedTail`) are templated on the arch purely so their instantiations don't share a mangled name between arch TUs -
+        otherwise the linker could hand the baseline TU a copy built with AVX flags.
+    */
+    template <class Arch, typename Ptr>
+    [[nodiscard]] Ptr offsetBy(Ptr ptr, size_t offset) noexcept {
+        return ptr + offset;
+    }
+
+    template <class Arch, FloatType T>
+    [[nodiscard]] SplitComplex<T> offsetBy(SplitComplex<T> ptr, size_t offset) noexcept {
+        return { ptr.real + offset, ptr.imag + offset };
+    }
+
+    /*
+        Local, padded storage for a partial batch of whichever data layout `Ptr` points at. Padded with 1s (or 1 + 0i). `std::complex` data is copied as
+        pairs of `T`s (which its layout guarantees), rather than through `std::complex`'s members.
+    */
+    template <class Arch, FloatType T, size_t N, typename Ptr>
+    struct PaddedTail;
+
+    template <class Arch, FloatType T, size_t N, typename Ptr>
+    requires std::is_same_v<std::remove_const_t<std::remove_pointer_t<Ptr>>, T> || std::is_same_v<std::remove_const_t<std::remove_pointer_t<Ptr>>, std::complex<T>>
+    struct PaddedTail<Arch, T, N, Ptr> final {
+        using ElementType = std::remove_const_t<std::remove_pointer_t<Ptr>>;
+        constexpr static auto valuesPerElement = sizeof(ElementType) / sizeof(T);
+        T data[N * valuesPerElement];
+        PaddedTail() noexcept {
+            for (auto i = 0_sz; i < N * valuesPerElement; ++i) {
+                data[i] = i % valuesPerElement == 0 ? static_cast<T>(1.0) : static_cast<T>(0.0);
+            }
+        }
+        void copyFrom(Ptr source, size_t count) noexcept {
+            const auto* values = reinterpret_cast<const T*>(source);
+            for (auto i = 0_sz; i < count * valuesPerElement; ++i) {
+                data[i] = values[i];
+            }
+        }
+        void copyTo(ElementType* dest, size_t count) const noexcept {
+            auto* values = reinterpret_cast<T*>(dest);
+            for (auto i = 0_sz; i < count * valuesPerElement; ++i) {
+                values[i] = data[i];
+            }
+        }
+        [[nodiscard]] ElementType* ptr() noexcept {
+            return reinterpret_cast<ElementType*>(data);
+        }
+    };
+
+    template <class Arch, FloatType T, size_t N>
+    struct PaddedTail<Arch, T, N, SplitComplex<T>> final {
+        T real[N];
+        T imag[N];
+        PaddedTail() noexcept {
+            for (auto i = 0_sz; i < N; ++i) {
+                real[i] = static_cast<T>(1.0);
+                imag[i] = static_cast<T>(0.0);
+            }
+        }
+        void copyFrom(SplitComplex<T> source, size_t count) noexcept {
+            for (auto i = 0_sz; i < count; ++i) {
+                real[i] = source.real[i];
+                imag[i] = source.imag[i];
+            }
+        }
+        void copyTo(SplitComplex<T> dest, size_t count) const noexcept {
+            for (auto i = 0_sz; i < count; ++i) {
+                dest.real[i] = real[i];
+                dest.imag[i] = imag[i];
+            }
+        }
+        [[nodiscard]] SplitComplex<T> ptr() noexcept {
+            return { real, imag };
+        }
+    };
+
+    /*
+        Loads a batch from each of `sources`, passes them to `op`, and stores the result to `dest`. As with `paddedOp`, the tail goes through
+        the same batch code via padded local copies.
+    */
+    template <class Arch, FloatType T, typename Op, typename Dest, typename... Sources>
+    void complexOp(Dest dest, size_t size, Op&& op, Sources... sources) noexcept {
+        constexpr static auto simdSize = xsimd::batch<T, Arch>::size;
+        const auto vecSize = size - size % simdSize;
+        for (auto i = 0_sz; i < vecSize; i += simdSize) {
+            storeBatch<Arch, T>(offsetBy<Arch>(dest, i), op(loadBatch<Arch, T>(offsetBy<Arch>(sources, i))...));
+        }
+        if (vecSize == size) return;
+        const auto remaining = size - vecSize;
+        const auto loadTail = [vecSize, remaining](auto source) {
+            PaddedTail<Arch, T, simdSize, decltype(source)> padded;
+            padded.copyFrom(offsetBy<Arch>(source, vecSize), remaining);
+            return loadBatch<Arch, T>(padded.ptr());
+        };
+        PaddedTail<Arch, T, simdSize, Dest> res;
+        storeBatch<Arch, T>(res.ptr(), op(loadTail(sources)...));
+        res.copyTo(offsetBy<Arch>(dest, vecSize), remaining);
+    }
+
+    inline constexpr auto complexMultiplyOp = [](const auto& a, const auto& b) { return a * b; };
+    inline constexpr auto complexMultiplyAddOp = [](const auto& acc, const auto& a, const auto& b) { return acc + a * b; };
+    inline constexpr auto complexConjugateMultiplyAddOp = [](const auto& acc, const auto& a, const auto& b) { return acc + a * xsimd::conj(b); };
+    inline constexpr auto magnitudeOp = [](const auto& z) { return xsimd::abs(z); };
+    inline constexpr auto magnitudeSquaredOp = [](const auto& z) { return xsimd::norm(z); };
+    inline constexpr auto phaseOp = [](const auto& z) { return xsimd::arg(z); };
+
+    template <class Arch, FloatType T, typename ComplexPtr, typename ConstComplexPtr>
+    void complexMultiply(ComplexPtr dest, ConstComplexPtr lhs, ConstComplexPtr rhs, size_t size) noexcept {
+        complexOp<Arch, T>(dest, size, complexMultiplyOp, lhs, rhs);
+    }
+
+    template <class Arch, FloatType T, typename ComplexPtr, typename ConstComplexPtr>
+    void complexMultiplyAdd(ComplexPtr dest, ConstComplexPtr lhs, ConstComplexPtr rhs, size_t size) noexcept {
+        complexOp<Arch, T>(dest, size, complexMultiplyAddOp, static_cast<ConstComplexPtr>(dest), lhs, rhs);
+    }
+
+    template <class Arch, FloatType T, typename ComplexPtr, typename ConstComplexPtr>
+    void complexConjugateMultiplyAdd(ComplexPtr dest, ConstComplexPtr lhs, ConstComplexPtr rhs, size_t size) noexcept {
+        complexOp<Arch, T>(dest, size, complexConjugateMultiplyAddOp, static_cast<ConstComplexPtr>(dest), lhs, rhs);
+    }
+
+    template <class Arch, FloatType T, typename ConstComplexPtr>
+    void magnitude(T* dest, ConstComplexPtr src, size_t size) noexcept {
+        complexOp<Arch, T>(dest, size, magnitudeOp, src);
+    }
+
+    template <class Arch, FloatType T, typename ConstComplexPtr>
+    void magnitudeSquared(T* dest, ConstComplexPtr src, size_t size) noexcept {
+        complexOp<Arch, T>(dest, size, magnitudeSquaredOp, src);
+    }
+
+    template <class Arch, FloatType T, typename ConstComplexPtr>
+    void phase(T* dest, ConstComplexPtr src, size_t size) noexcept {
+        complexOp<Arch, T>(dest, size, phaseOp, src);
+    }
+
+    template <class Arch, FloatType T, typename ComplexPtr>
+    void polarToCartesian(ComplexPtr dest, const T* magnitudes, const T* phases, size_t size) noexcept {
+        complexOp<Arch, T>(dest, size, [](const auto& r, const auto& theta) {
+            using ComplexBatch = xsimd::batch<std::complex<T>, Arch>;
+            return ComplexBatch{ r * xsimd::cos(theta), r * xsimd::sin(theta) };
+        }, magnitudes, phases);
+    }
+
+    /*
+        Interleaving. Stereo is treated as `std::complex` data, so xsimd's (de)interleaving complex loads and stores do the shuffling. Other channel counts
+        go a tile at a time - a group of up to `simdSize` channels by `simdSize` frames, one batch per channel, transposed in registers so that each batch holds
+        one frame's worth of the group (or the other way around, for deinterleaving).
+        A group narrower than a batch (the last one, or the only one if there are fewer channels than lanes) still loads / stores a whole batch per frame,
+        which runs on into the next frame. That's harmless for loads. For stores, the narrow group goes first, and its frames are stored in order, so every
+        sample it spills into gets overwritten afterwards - by the group's next frame, or by the full groups. Frames near the end of the buffer, where a whole
+        batch would run past it, go through a strided scalar loop.
+    */
+    template <class Arch, FloatType T>
+    [[nodiscard]] size_t getTiledFrames(size_t firstChannel, size_t numChannels, size_t numSamples) noexcept {
+        constexpr static auto simdSize = xsimd::batch<T, Arch>::size;
+        auto tiledFrames = 0_sz;
+        while (tiledFrames + simdSize <= numSamples && (tiledFrames + simdSize - 1) * numChannels + firstChannel + simdSize <= numSamples * numChannels) {
+            tiledFrames += simdSize;
+        }
+        return tiledFrames;
+    }
+
+    template <class Arch, FloatType T>
+    void interleaveGroup(T* dest, const T* const* channels, size_t firstChannel, size_t groupSize, size_t numChannels, size_t numSamples) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        const auto tiledFrames = getTiledFrames<Arch, T>(firstChannel, numChannels, numSamples);
+        BatchType tile[simdSize];
+        for (auto row = groupSize; row < simdSize; ++row) {
+            tile[row] = BatchType(static_cast<T>(0.0));
+        }
+        for (auto frame = 0_sz; frame < tiledFrames; frame += simdSize) {
+            for (auto row = 0_sz; row < groupSize; ++row) {
+                tile[row] = BatchType::load_unaligned(channels[firstChannel + row] + frame);
+            }
+            xsimd::transpose(tile, tile + simdSize);
+            for (auto i = 0_sz; i < simdSize; ++i) {
+                tile[i].store_unaligned(dest + (frame + i) * numChannels + firstChannel);
+            }
+        }
+        for (auto channel = firstChannel; channel < firstChannel + groupSize; ++channel) {
+            const auto* source = channels[channel];
+            for (auto i = tiledFrames; i < numSamples; ++i) {
+                dest[i * numChannels + channel] = source[i];
+            }
+        }
+    }
+
+    template <class Arch, FloatType T>
+    void deinterleaveGroup(T* const* channels, const T* src, size_t firstChannel, size_t groupSize, size_t numChannels, size_t numSamples) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        const auto tiledFrames = getTiledFrames<Arch, T>(firstChannel, numChannels, numSamples);
+        BatchType tile[simdSize];
+        for (auto frame = 0_sz; frame < tiledFrames; frame += simdSize) {
+            for (auto i = 0_sz; i < simdSize; ++i) {
+                tile[i] = BatchType::load_unaligned(src + (frame + i) * numChannels + firstChannel);
+            }
+            xsimd::transpose(tile, tile + simdSize);
+            for (auto row = 0_sz; row < groupSize; ++row) {
+                tile[row].store_unaligned(channels[firstChannel + row] + frame);
+            }
+        }
+        for (auto channel = firstChannel; channel < firstChannel + groupSize; ++channel) {
+            auto* target = channels[channel];
+            for (auto i = tiledFrames; i < numSamples; ++i) {
+                target[i] = src[i * numChannels + channel];
+            }
+        }
+    }
+
+    template <class Arch, FloatType T>
+    void interleave(T* dest, const T* const* channels, size_t numChannels, size_t numSamples) noexcept {
+        constexpr static auto simdSize = xsimd::batch<T, Arch>::size;
+        if (numChannels == 2) {
+            auto* asComplex = reinterpret_cast<std::complex<T>*>(dest);
+            complexOp<Arch, T>(asComplex, numSamples, [](const auto& left, const auto& right) {
+                return xsimd::batch<std::complex<T>, Arch>{ left, right };
+            }, channels[0], channels[1]);
+            return;
+        }
+        const auto fullGroups = numChannels - numChannels % simdSize;
+        if (fullGroups != numChannels) {
+            interleaveGroup<Arch, T>(dest, channels, fullGroups, numChannels - fullGroups, numChannels, numSamples);
+        }
+        for (auto channel = 0_sz; channel < fullGroups; channel += simdSize) {
+            interleaveGroup<Arch, T>(dest, channels, channel, simdSize, numChannels, numSamples);
+        }
+    }
+
+    template <class Arch, FloatType T>
+    void deinterleave(T* const* channels, const T* src, size_t numChannels, size_t numSamples) noexcept {
+        using ComplexBatch = xsimd::batch<std::complex<T>, Arch>;
+        constexpr static auto simdSize = xsimd::batch<T, Arch>::size;
+        if (numChannels == 2) {
+            const auto* asComplex = reinterpret_cast<const std::complex<T>*>(src);
+            const auto vecSize = numSamples - numSamples % ComplexBatch::size;
+            for (auto i = 0_sz; i < vecSize; i += ComplexBatch::size) {
+                const auto frames = ComplexBatch::load_unaligned(asComplex + i);
+                frames.real().store_unaligned(channels[0] + i);
+                frames.imag().store_unaligned(channels[1] + i);
+            }
+            for (auto i = vecSize; i < numSamples; ++i) {
+                channels[0][i] = src[i * 2];
+                channels[1][i] = src[i * 2 + 1];
+            }
+            return;
+        }
+        for (auto channel = 0_sz; channel < numChannels; channel += simdSize) {
+            const auto groupSize = numChannels - channel < simdSize ? numChannels - channel : simdSize;
+            deinterleaveGroup<Arch, T>(channels, src, channel, groupSize, numChannels, numSamples);
+        }
+    }
+
+    /*
+        Integer sample (de)coding. The format is a template parameter, so `decode` / `encode` switch on it once and then run a loop specialised for it.
+        Samples are unpacked to / packed from int32s one at a time (so any stride works, and nothing relies on alignment), and the int <-> float conversion,
+        scaling, clipping and rounding happen a batch at a time. The dither comes from `TriangularDither::fill`, which is compiled out of line in the baseline
+        TU, and the clip bounds are compile time constants rather than `std::nextafter` calls - the only calls out of here are arch-templated or non-inline.
+    */
+    template <class Arch, SampleFormat Format>
+    [[nodiscard]] std::int32_t readSample(const std::byte* src) noexcept {
+        if constexpr (Format == SampleFormat::Int16) {
+            std::int16_t res;
+            std::memcpy(&res, src, sizeof(res));
+            return res;
+        } else if constexpr (Format == SampleFormat::Int24) {
+            const auto unsignedRes = static_cast<std::uint32_t>(src[0]) | (static_cast<std::uint32_t>(src[1]) << 8) | (static_cast<std::uint32_t>(src[2]) << 16);
+            // Shift into the top 24 bits then arithmetic shift back down, to sign extend.
+            return static_cast<std::int32_t>(unsignedRes << 8) >> 8;
+        } else {
+            std::int32_t res;
+            std::memcpy(&res, src, sizeof(res));
+            return res;
+        }
+    }
+
+    template <class Arch, SampleFormat Format>
+    void writeSample(std::byte* dest, std::int32_t sample) noexcept {
+        if constexpr (Format == SampleFormat::Int16) {
+            const auto truncated = static_cast<std::int16_t>(sample);
+            std::memcpy(dest, &truncated, sizeof(truncated));
+        } else if constexpr (Format == SampleFormat::Int24) {
+            const auto unsignedSample = static_cast<std::uint32_t>(sample);
+            dest[0] = static_cast<std::byte>(unsignedSample & 0xFF);
+            dest[1] = static_cast<std::byte>((unsignedSample >> 8) & 0xFF);
+            dest[2] = static_cast<std::byte>((unsignedSample >> 16) & 0xFF);
+        } else {
+            std::memcpy(dest, &sample, sizeof(sample));
+        }
+    }
+
+    template <class Arch, FloatType T, SampleFormat Format>
+    [[nodiscard]] constexpr T getFullScale() noexcept {
+        return static_cast<T>(std::uint64_t{ 1 } << (getBytesPerSample(Format) * 8 - 1));
+    }
+
+    /*
+        `stride` is in samples, so deinterleaving a channel is just a decode with `stride == numChannels`.
+    */
+    template <class Arch, FloatType T, SampleFormat Format>
+    void decodeFormat(T* dest, const std::byte* src, size_t size, size_t stride) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        constexpr static auto scale = static_cast<T>(1.0) / getFullScale<Arch, T, Format>();
+        constexpr static auto bytesPerSample = getBytesPerSample(Format);
+        const auto bytesPerFrame = bytesPerSample * stride;
+        const auto scaleBatch = BatchType::broadcast(scale);
+        const auto vecSize = size - size % simdSize;
+        std::int32_t unpacked[simdSize];
+        for (auto i = 0_sz; i < vecSize; i += simdSize) {
+            for (auto j = 0_sz; j < simdSize; ++j) {
+                unpacked[j] = readSample<Arch, Format>(src + (i + j) * bytesPerFrame);
+            }
+            (BatchType::load_unaligned(unpacked) * scaleBatch).store_unaligned(dest + i);
+        }
+        for (auto i = vecSize; i < size; ++i) {
+            dest[i] = static_cast<T>(readSample<Arch, Format>(src + i * bytesPerFrame)) * scale;
+        }
+    }
+
+    template <class Arch, FloatType T>
+    void decode(T* dest, const std::byte* src, SampleFormat format, size_t size, size_t stride) noexcept {
+        switch (format) {
+            case SampleFormat::Int16: return decodeFormat<Arch, T, SampleFormat::Int16>(dest, src, size, stride);
+            case SampleFormat::Int24: return decodeFormat<Arch, T, SampleFormat::Int24>(dest, src, size, stride);
+            case SampleFormat::Int32: return decodeFormat<Arch, T, SampleFormat::Int32>(dest, src, size, stride);
+        }
+    }
+
+    /*
+        The tail is run through the same batch code as the rest, via a zero padded copy, so it's clipped and rounded identically.
+        Dither is drawn one value per sample (never for the padding), so the output doesn't depend on the arch's batch width.
+    */
+    template <class Arch, FloatType T, SampleFormat Format>
+    void encodeFormat(std::byte* dest, const T* src, size_t size, size_t stride, TriangularDither* dither) noexcept {
+        using BatchType = xsimd::batch<T, Arch>;
+        constexpr static auto simdSize = BatchType::size;
+        constexpr static auto fullScale = getFullScale<Arch, T, Format>();
+        constexpr static auto bytesPerSample = getBytesPerSample(Format);
+        const auto bytesPerFrame = bytesPerSample * stride;
+        // For float -> int32, fullScale - 1 isn't representable and rounds up to fullScale (which would overflow), so take the largest float below it instead.
+        // fullScale is a power of two, so that's one step of half an epsilon (relative) down.
+        constexpr static auto belowFullScale = fullScale - fullScale * (std::numeric_limits<T>::epsilon() / static_cast<T>(2.0));
+        constexpr static auto maxValue = fullScale - static_cast<T>(1.0) < belowFullScale ? fullScale - static_cast<T>(1.0) : belowFullScale;
+        const auto scaleBatch = BatchType::broadcast(fullScale);
+        const auto minBatch = BatchType::broadcast(-fullScale);
+        const auto maxBatch = BatchType::broadcast(maxValue);
+        T staging[simdSize];
+        std::int32_t packed[simdSize];
+        const auto convert = [&](const T* source, size_t i, size_t count) {
+            auto scaled = BatchType::load_unaligned(source) * scaleBatch;
+            if (dither != nullptr) {
+                for (auto j = count; j < simdSize; ++j) {
+                    staging[j] = static_cast<T>(0.0);
+                }
+                dither->fill(staging, count);
+                scaled += BatchType::load_unaligned(staging);
+            }
+            const auto rounded = xsimd::nearbyint(xsimd::min(xsimd::max(scaled, minBatch), maxBatch));
+            rounded.store_unaligned(packed);
+            for (auto j = 0_sz; j < count; ++j) {
+                writeSample<Arch, Format>(dest + (i + j) * bytesPerFrame, packed[j]);
+            }
+        };
+        const auto vecSize = size - size % simdSize;
+        for (auto i = 0_sz; i < vecSize; i += simdSize) {
+            convert(src + i, i, simdSize);
+        }
+        if (vecSize != size) {
+            T tail[simdSize];
+            for (auto i = 0_sz; i < simdSize; ++i) {
+                tail[i] = vecSize + i < size ? src[vecSize + i] : static_cast<T>(0.0);
+            }
+            convert(tail, vecSize, size - vecSize);
+        }
+    }
+
+    template <class Arch, FloatType T>
+    void encode(std::byte* dest, SampleFormat format, const T* src, size_t size, size_t stride, TriangularDither* dither) noexcept {
+        switch (format) {
+            case SampleFormat::Int16: return encodeFormat<Arch, T, SampleFormat::Int16>(dest, src, size, stride, dither);
+            case SampleFormat::Int24: return encodeFormat<Arch, T, SampleFormat::Int24>(dest, src, size, stride, dither);
+            case SampleFormat::Int32: return encodeFormat<Arch, T, SampleFormat::Int32>(dest, src, size, stride, dither);
+        }
+    }
+
+    /*
+        Table of kernels for a single arch, bound once at startup by `getKernels()` in marvin_VecOps.cpp.
+    */
+    template <FloatType T>
+    struct KernelTable final {
+        void (*add)(T*, const T*, size_t) noexcept;
+        void (*addScalar)(T*, T, size_t) noexcept;
+        void (*subtract)(T*, const T*, size_t) noexcept;
+        void (*subtractScalar)(T*, T, size_t) noexcept;
+        void (*multiply)(T*, const T*, size_t) noexcept;
+        void (*multiplyScalar)(T*, T, size_t) noexcept;
+        void (*divide)(T*, const T*, size_t) noexcept;
+        void (*divideScalar)(T*, T, size_t) noexcept;
+        void (*addOutOfPlace)(T*, const T*, const T*, size_t) noexcept;
+        void (*subtractOutOfPlace)(T*, const T*, const T*, size_t) noexcept;
+        void (*multiplyOutOfPlace)(T*, const T*, const T*, size_t) noexcept;
+        void (*divideOutOfPlace)(T*, const T*, const T*, size_t) noexcept;
+        void (*copyWithGain)(T*, const T*, T, size_t) noexcept;
+        void (*multiplyAdd)(T*, const T*, const T*, size_t) noexcept;
+        void (*multiplyAddScalar)(T*, const T*, T, size_t) noexcept;
+        void (*addScaled)(T*, const T*, T, const T*, T, size_t) noexcept;
+        void (*crossfade)(T*, const T*, const T*, const T*, size_t) noexcept;
+        T (*sum)(const T*, size_t) noexcept;
+        T (*dot)(const T*, const T*, size_t) noexcept;
+        T (*sumOfSquares)(const T*, size_t) noexcept;
+        IndexedValue<T> (*maxAbs)(const T*, size_t) noexcept;
+        utils::Range<T> (*minMax)(const T*, size_t) noexcept;
+        void (*exp)(T*, const T*, size_t) noexcept;
+        void (*log)(T*, const T*, size_t) noexcept;
+        void (*log10)(T*, const T*, size_t) noexcept;
+        void (*tanh)(T*, const T*, size_t) noexcept;
+        void (*sin)(T*, const T*, size_t) noexcept;
+        void (*cos)(T*, const T*, size_t) noexcept;
+        void (*pow)(T*, const T*, const T*, size_t) noexcept;
+        void (*complexMultiply)(std::complex<T>*, const std::complex<T>*, const std::complex<T>*, size_t) noexcept;
+        void (*complexMultiplyAdd)(std::complex<T>*, const std::complex<T>*, const std::complex<T>*, size_t) noexcept;
+        void (*complexConjugateMultiplyAdd)(std::complex<T>*, const std::complex<T>*, const std::complex<T>*, size_t) noexcept;
+        void (*magnitude)(T*, const std::complex<T>*, size_t) noexcept;
+        void (*magnitudeSquared)(T*, const std::complex<T>*, size_t) noexcept;
+        void (*phase)(T*, const std::complex<T>*, size_t) noexcept;
+        void (*polarToCartesian)(std::complex<T>*, const T*, const T*, size_t) noexcept;
+        void (*splitMultiply)(SplitComplex<T>, SplitComplex<T>, SplitComplex<T>, size_t) noexcept;
+        void (*splitMultiplyAdd)(SplitComplex<T>, SplitComplex<T>, SplitComplex<T>, size_t) noexcept;
+        void (*splitConjugateMultiplyAdd)(SplitComplex<T>, SplitComplex<T>, SplitComplex<T>, size_t) noexcept;
+        void (*splitMagnitude)(T*, SplitComplex<T>, size_t) noexcept;
+        void (*splitMagnitudeSquared)(T*, SplitComplex<T>, size_t) noexcept;
+        void (*splitPhase)(T*, SplitComplex<T>, size_t) noexcept;
+        void (*splitPolarToCartesian)(SplitComplex<T>, const T*, const T*, size_t) noexcept;
+        void (*interleave)(T*, const T* const*, size_t, size_t) noexcept;
+        void (*deinterleave)(T* const*, const T*, size_t, size_t) noexcept;
+        void (*decode)(T*, const std::byte*, SampleFormat, size_t, size_t) noexcept;
+        void (*encode)(std::byte*, SampleFormat, const T*, size_t, size_t, TriangularDither*) noexcept;
+    };
+
+    template <class Arch, FloatType T>
+    [[nodiscard]] KernelTable<T> makeKernelTable() noexcept {
+        return {
+            .add = &add<Arch, T>,
+            .addScalar = &addScalar<Arch, T>,
+            .subtract = &subtract<Arch, T>,
+            .subtractScalar = &subtractScalar<Arch, T>,
+            .multiply = &multiply<Arch, T>,
+            .multiplyScalar = &multiplyScalar<Arch, T>,
+            .divide = &divide<Arch, T>,
+            .divideScalar = &divideScalar<Arch, T>,
+            .addOutOfPlace = &addOutOfPlace<Arch, T>,
+            .subtractOutOfPlace = &subtractOutOfPlace<Arch, T>,
+            .multiplyOutOfPlace = &multiplyOutOfPlace<Arch, T>,
+            .divideOutOfPlace = &divideOutOfPlace<Arch, T>,
+            .copyWithGain = &copyWithGain<Arch, T>,
+            .multiplyAdd = &multiplyAdd<Arch, T>,
+            .multiplyAddScalar = &multiplyAddScalar<Arch, T>,
+            .addScaled = &addScaled<Arch, T>,
+            .crossfade = &crossfade<Arch, T>,
+            .sum = &sum<Arch, T>,
+            .dot = &dot<Arch, T>,
+            .sumOfSquares = &sumOfSquares<Arch, T>,
+            .maxAbs = &maxAbs<Arch, T>,
+            .minMax = &minMax<Arch, T>,
+            .exp = &exp<Arch, T>,
+            .log = &log<Arch, T>,
+            .log10 = &log10<Arch, T>,
+            .tanh = &tanh<Arch, T>,
+            .sin = &sin<Arch, T>,
+            .cos = &cos<Arch, T>,
+            .pow = &pow<Arch, T>,
+            .complexMultiply = &complexMultiply<Arch, T, std::complex<T>*, const std::complex<T>*>,
+            .complexMultiplyAdd = &complexMultiplyAdd<Arch, T, std::complex<T>*, const std::complex<T>*>,
+            .complexConjugateMultiplyAdd = &complexConjugateMultiplyAdd<Arch, T, std::complex<T>*, const std::complex<T>*>,
+            .magnitude = &magnitude<Arch, T, const std::complex<T>*>,
+            .magnitudeSquared = &magnitudeSquared<Arch, T, const std::complex<T>*>,
+            .phase = &phase<Arch, T, const std::complex<T>*>,
+            .polarToCartesian = &polarToCartesian<Arch, T, std::complex<T>*>,
+            .splitMultiply = &complexMultiply<Arch, T, SplitComplex<T>, SplitComplex<T>>,
+            .splitMultiplyAdd = &complexMultiplyAdd<Arch, T, SplitComplex<T>, SplitComplex<T>>,
+            .splitConjugateMultiplyAdd = &complexConjugateMultiplyAdd<Arch, T, SplitComplex<T>, SplitComplex<T>>,
+            .splitMagnitude = &magnitude<Arch, T, SplitComplex<T>>,
+            .splitMagnitudeSquared = &magnitudeSquared<Arch, T, SplitComplex<T>>,
+            .splitPhase = &phase<Arch, T, SplitComplex<T>>,
+            .splitPolarToCartesian = &polarToCartesian<Arch, T, SplitComplex<T>>,
+            .interleave = &interleave<Arch, T>,
+            .deinterleave = &deinterleave<Arch, T>,
+            .decode = &decode<Arch, T>,
+            .encode = &encode<Arch, T>
+        };
+    }
+
+#if defined(MARVIN_HAS_AVX2_KERNELS)
+    extern template KernelTable<float> makeKernelTable<utils::simd::AVX2Arch, float>() noexcept;
+    extern template KernelTable<double> makeKernelTable<utils::simd::AVX2Arch, double>() noexcept;
+#endif
+#if defined(MARVIN_HAS_AVX512_KERNELS)
+    extern template KernelTable<float> makeKernelTable<utils::simd::AVX512Arch, float>() noexcept;
+    extern template KernelTable<double> makeKernelTable<utils::simd::AVX512Arch, double>() noexcept;
+#endif
+} // namespace marvin::math::vecops::kernels
+#endif
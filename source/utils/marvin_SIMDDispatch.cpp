@@ -0,0 +1,71 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include "marvin/utils/marvin_SIMDDispatch.h"
+#include <xsimd/xsimd.hpp>
+#if defined(_MSC_VER) && defined(MARVIN_HAS_AVX512_KERNELS)
+#include <intrin.h>
+#endif
+
+namespace marvin::utils {
+#if defined(_MSC_VER) && defined(MARVIN_HAS_AVX512_KERNELS)
+    /*
+        MSVC has no flag for AVX-512F alone - `/arch:AVX512` also lets the compiler use BW, DQ and VL instructions in the AVX-512 kernel TU, so that's only safe
+        to dispatch to if the CPU has all four. xsimd doesn't report VL, so this reads CPUID leaf 7 directly (the OS support check is covered by xsimd's avx512f).
+    */
+    [[nodiscard]] static bool hasAVX512BWDQVL() noexcept {
+        int registers[4]{};
+        __cpuid(registers, 0);
+        if (registers[0] < 7) {
+            return false;
+        }
+        __cpuidex(registers, 7, 0);
+        const auto ebx = static_cast<unsigned>(registers[1]);
+        constexpr static auto dq = 1u << 17, bw = 1u << 30, vl = 1u << 31;
+        return (ebx & dq) && (ebx & bw) && (ebx & vl);
+    }
+#endif
+
+    [[nodiscard]] static InstructionSet getDefaultInstructionSet() noexcept {
+#if XSIMD_WITH_AVX512F
+        return InstructionSet::AVX512;
+#elif XSIMD_WITH_AVX2
+        return InstructionSet::AVX2;
+#elif XSIMD_WITH_SSE2
+        return InstructionSet::SSE2;
+#elif XSIMD_WITH_NEON || XSIMD_WITH_NEON64
+        return InstructionSet::NEON;
+#else
+        return InstructionSet::Other;
+#endif
+    }
+
+    InstructionSet getInstructionSet() noexcept {
+        static const auto instructionSet = []() -> InstructionSet {
+            [[maybe_unused]] const auto available = xsimd::available_architectures();
+#if defined(MARVIN_HAS_AVX512_KERNELS)
+#if defined(_MSC_VER)
+            if (available.avx512f && hasAVX512BWDQVL()) {
+#else
+            if (available.avx512f) {
+#endif
+                return InstructionSet::AVX512;
+            }
+#endif
+#if defined(MARVIN_HAS_AVX2_KERNELS)
+            if (available.avx2 && available.fma3_avx2) {
+                return InstructionSet::AVX2;
+            }
+#endif
+            return getDefaultInstructionSet();
+        }();
+        return instructionSet;
+    }
+} // namespace marvin::utils
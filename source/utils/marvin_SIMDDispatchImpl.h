@@ -0,0 +1,71 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_SIMDDISPATCHIMPL_H
+#define MARVIN_SIMDDISPATCHIMPL_H
+#include "marvin/utils/marvin_SIMDDispatch.h"
+#include <xsimd/xsimd.hpp>
+namespace marvin::utils::simd {
+    // Kernels are written as templates on an xsimd arch. The default arch is instantiated in whichever TU uses the kernels,
+    // the others are explicitly instantiated in `source/utils/simd/marvin_SIMDKernels_<Arch>.cpp`, which are compiled with the
+    // matching `-m` flags. Consumers should declare those instantiations `extern template`. That only covers the kernels themselves - anything else they
+    // instantiate that isn't templated on the arch (standard library templates, inline functions) is emitted as a weak symbol in every TU that uses it, and
+    // the linker is free to pick the wide copy for the baseline TUs too. So the kernels must stick to arch-templated code - the `marvin-kernel-symbols` test checks.
+    using DefaultArch = xsimd::default_arch;
+#if defined(MARVIN_HAS_AVX2_KERNELS)
+    using AVX2Arch = xsimd::fma3<xsimd::avx2>;
+#endif
+#if defined(MARVIN_HAS_AVX512_KERNELS)
+    using AVX512Arch = xsimd::avx512f;
+#endif
+
+    // The next narrower arch a kernel built for `Arch` can use (with `Arch`'s flags), for data that doesn't fill one of `Arch`'s batches - `void` if there's
+    // nothing narrower. Each TU gets its own chain (AVX-512 -> AVX2 -> SSE4.1, FMA/AVX2 -> FMA/SSE4.2), and none of them include the default arch, so the
+    // narrower xsimd instantiations aren't shared with another TU built with different flags.
+    template <class Arch>
+    struct NarrowerArch {
+        using type = void;
+    };
+#if defined(MARVIN_HAS_AVX2_KERNELS)
+    template <>
+    struct NarrowerArch<AVX2Arch> {
+        using type = xsimd::fma3<xsimd::sse4_2>;
+    };
+#endif
+#if defined(MARVIN_HAS_AVX512_KERNELS)
+    template <>
+    struct NarrowerArch<AVX512Arch> {
+        using type = xsimd::avx2;
+    };
+
+    template <>
+    struct NarrowerArch<xsimd::avx2> {
+        using type = xsimd::sse4_1;
+    };
+#endif
+
+    /**
+        Calls `factory.template operator()<Arch>()` with the arch matching `getInstructionSet()`, and returns the result.
+        Intended to be called once, to initialise a function-local static table of kernels.
+    */
+    template <typename Factory>
+    [[nodiscard]] auto dispatch(Factory&& factory) {
+        switch (getInstructionSet()) {
+#if defined(MARVIN_HAS_AVX512_KERNELS)
+            case InstructionSet::AVX512: return factory.template operator()<AVX512Arch>();
+#endif
+#if defined(MARVIN_HAS_AVX2_KERNELS)
+            case InstructionSet::AVX2: return factory.template operator()<AVX2Arch>();
+#endif
+            default: return factory.template operator()<DefaultArch>();
+        }
+    }
+} // namespace marvin::utils::simd
+#endif
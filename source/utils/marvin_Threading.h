@@ -0,0 +1,70 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_THREADING_H
+#define MARVIN_THREADING_H
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <latch>
+#include <mutex>
+#include <thread>
+#include <vector>
+namespace marvin::utils {
+    /*
+        Calls `task(thread)` for each of `numThreads` threads - thread 0 on the calling thread, the rest on threads of their own - and returns once they've all finished.
+        The threads are joined however this exits, including when starting one fails. If any of the tasks throw, the first exception is rethrown here once they're
+        all done, rather than terminating.
+        None of the tasks start until every thread has, and if starting one fails none of them run, so the tasks can wait on each other (eg through a `std::barrier`)
+        without a thread that never started leaving the rest waiting on it - as long as none of them throw while the others are waiting.
+    */
+    template <typename Task>
+    void runOnThreads(size_t numThreads, const Task& task) {
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        std::latch started{ 1 };
+        std::atomic<bool> aborted{ false };
+        const auto runTask = [&](size_t thread) noexcept {
+            if (thread != 0) {
+                started.wait();
+                if (aborted.load()) {
+                    return;
+                }
+            }
+            try {
+                task(thread);
+            } catch (...) {
+                std::scoped_lock lock{ errorMutex };
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        };
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(numThreads);
+            try {
+                for (size_t thread = 1; thread < numThreads; ++thread) {
+                    workers.emplace_back(runTask, thread);
+                }
+            } catch (...) {
+                aborted.store(true);
+                started.count_down();
+                throw;
+            }
+            started.count_down();
+            runTask(0);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+} // namespace marvin::utils
+#endif
@@ -0,0 +1,39 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+// Compiled with the AVX512 flags - see MARVIN_RUNTIME_DISPATCH in the root CMakeLists.txt.
+#include "utils/marvin_SIMDDispatchImpl.h"
+#include "math/marvin_VecOpsKernels.h"
+#include "dsp/filters/biquad/marvin_SIMDBiquadKernels.h"
+#include "dsp/filters/marvin_FIRKernels.h"
+#include "dsp/spectral/marvin_FFTKernels.h"
+
+namespace marvin::math::vecops::kernels {
+    template KernelTable<float> makeKernelTable<utils::simd::AVX512Arch, float>() noexcept;
+    template KernelTable<double> makeKernelTable<utils::simd::AVX512Arch, double>() noexcept;
+} // namespace marvin::math::vecops::kernels
+
+namespace marvin::dsp::filters::kernels {
+    template SIMDBiquadKernel<float> getSIMDBiquadKernel<utils::simd::AVX512Arch, float>() noexcept;
+    template SIMDBiquadKernel<double> getSIMDBiquadKernel<utils::simd::AVX512Arch, double>() noexcept;
+    template SIMDBiquadBlockKernel<float> getSIMDBiquadBlockKernel<utils::simd::AVX512Arch, float>() noexcept;
+    template SIMDBiquadBlockKernel<double> getSIMDBiquadBlockKernel<utils::simd::AVX512Arch, double>() noexcept;
+    template SIMDBiquadNumVectorisedQuery<float> getSIMDBiquadNumVectorisedQuery<utils::simd::AVX512Arch, float>() noexcept;
+    template SIMDBiquadNumVectorisedQuery<double> getSIMDBiquadNumVectorisedQuery<utils::simd::AVX512Arch, double>() noexcept;
+    template FIRFrameKernel<float> getFIRFrameKernel<utils::simd::AVX512Arch, float>() noexcept;
+    template FIRFrameKernel<double> getFIRFrameKernel<utils::simd::AVX512Arch, double>() noexcept;
+    template FIRBlockKernel<float> getFIRBlockKernel<utils::simd::AVX512Arch, float>() noexcept;
+    template FIRBlockKernel<double> getFIRBlockKernel<utils::simd::AVX512Arch, double>() noexcept;
+} // namespace marvin::dsp::filters::kernels
+
+namespace marvin::dsp::spectral::kernels {
+    template FFTKernels<float> getFFTKernels<utils::simd::AVX512Arch, float>() noexcept;
+    template FFTKernels<double> getFFTKernels<utils::simd::AVX512Arch, double>() noexcept;
+} // namespace marvin::dsp::spectral::kernels
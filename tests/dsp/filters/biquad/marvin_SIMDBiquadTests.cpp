@@ -9,6 +9,7 @@
 #include <marvin/dsp/filters/biquad/marvin_RBJCoefficients.h>
 #include <marvin/dsp/filters/biquad/marvin_SIMDBiquad.h>
 #include <marvin/dsp/oscillators/marvin_Oscillator.h>
+#include <marvin/library/marvin_Literals.h>
 #include <fmt/core.h>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
@@ -51,6 +52,141 @@ namespace marvin::testing {
         }
     }
 
+    template <FloatType SampleType, size_t N>
+    auto testBlockParity() -> void {
+        constexpr static auto sampleRate{ 44100.0 };
+        constexpr static auto numSamples{ 257 };
+        marvin::dsp::filters::SIMDBiquad<SampleType, N> perSample;
+        marvin::dsp::filters::SIMDBiquad<SampleType, N> block;
+        for (auto filter = 0; filter < N; ++filter) {
+            const auto coeffs = dsp::filters::rbj::lowpass<SampleType>(sampleRate, 100.0 + 350.0 * filter, 0.707);
+            perSample.setCoeffs(filter, coeffs);
+            block.setCoeffs(filter, coeffs);
+        }
+        std::vector<std::vector<SampleType>> channels;
+        std::vector<SampleType*> channelPtrs;
+        for (auto filter = 0; filter < N; ++filter) {
+            channels.emplace_back(generateNoise<SampleType, numSamples>());
+        }
+        for (auto& channel : channels) {
+            channelPtrs.emplace_back(channel.data());
+        }
+        auto expected = channels;
+        for (auto i = 0; i < numSamples; ++i) {
+            std::array<SampleType, N> frame;
+            for (auto filter = 0; filter < N; ++filter) {
+                frame[filter] = expected[filter][i];
+            }
+            perSample(frame);
+            for (auto filter = 0; filter < N; ++filter) {
+                expected[filter][i] = frame[filter];
+            }
+        }
+        // Split across two calls, to check the state carries over between blocks.
+        block(containers::BufferView<SampleType>{ channelPtrs.data(), N, 100 });
+        for (auto& ptr : channelPtrs) {
+            ptr += 100;
+        }
+        block(containers::BufferView<SampleType>{ channelPtrs.data(), N, numSamples - 100 });
+        for (auto filter = 0; filter < N; ++filter) {
+            for (auto i = 0; i < numSamples; ++i) {
+                REQUIRE_THAT(channels[filter][i], Catch::Matchers::WithinAbs(expected[filter][i], 1e-5));
+            }
+        }
+    }
+
+    TEST_CASE("Test SIMDBiquad block parity") {
+        // Below, at, and around the SIMD widths of the instruction sets the kernels can be dispatched to, and across more than one storage block.
+        testBlockParity<float, 1>();
+        testBlockParity<float, 3>();
+        testBlockParity<float, 4>();
+        testBlockParity<float, 5>();
+        testBlockParity<float, 6>();
+        testBlockParity<float, 8>();
+        testBlockParity<float, 12>();
+        testBlockParity<float, 13>();
+        testBlockParity<float, 16>();
+        testBlockParity<float, 21>();
+        testBlockParity<float, 35>();
+        testBlockParity<double, 1>();
+        testBlockParity<double, 2>();
+        testBlockParity<double, 3>();
+        testBlockParity<double, 7>();
+        testBlockParity<double, 8>();
+        testBlockParity<double, 13>();
+        testBlockParity<double, 16>();
+        testBlockParity<double, 21>();
+    }
+
+    TEST_CASE("Test SIMDBiquad storage") {
+        using FilterType = marvin::dsp::filters::SIMDBiquad<float, 21>;
+        // In-object, so copyable without allocating, and contiguous in a container.
+        static_assert(std::is_trivially_copyable_v<FilterType>);
+        static_assert(alignof(FilterType) == marvin::dsp::filters::detail::SIMDBiquadAlignment);
+        // Small banks aren't padded out to a whole AVX-512 register's worth of filters - two floats' coefficients and state, plus the flag and its padding.
+        static_assert(sizeof(marvin::dsp::filters::SIMDBiquad<float, 2>) <= 9 * 2 * sizeof(float) + alignof(marvin::dsp::filters::SIMDBiquad<float, 2>));
+        static_assert(sizeof(marvin::dsp::filters::SIMDBiquad<double, 5>) <= 9 * 8 * sizeof(double) + alignof(marvin::dsp::filters::SIMDBiquad<double, 5>));
+        std::vector<FilterType> filters(64);
+        for (auto i = 0; i < filters.size(); ++i) {
+            REQUIRE(reinterpret_cast<std::uintptr_t>(&filters[i]) % marvin::dsp::filters::detail::SIMDBiquadAlignment == 0);
+            for (auto filter = 0; filter < 21; ++filter) {
+                filters[i].setCoeffs(filter, dsp::filters::rbj::lowpass<float>(44100.0, 100.0 + 50.0 * i + 10.0 * filter, 0.707));
+            }
+        }
+        const auto runImpulse = [](FilterType& f) {
+            std::vector<std::array<float, 21>> out;
+            const auto impulse = generateImpulse<float>(64);
+            for (const auto x : impulse) {
+                std::array<float, 21> frame;
+                std::fill(frame.begin(), frame.end(), x);
+                f(frame);
+                out.emplace_back(frame);
+            }
+            return out;
+        };
+        const auto original = runImpulse(filters[7]);
+        // A copy carries the coefficients and state, and is independent of the original.
+        auto copy = filters[7];
+        copy.reset();
+        filters[7].reset();
+        REQUIRE(runImpulse(copy) == original);
+        REQUIRE(runImpulse(filters[7]) == original);
+        // Every filter in the bank keeps its own coefficients.
+        filters[8].reset();
+        REQUIRE(runImpulse(filters[8]) != original);
+    }
+
+    template <FloatType SampleType>
+    [[nodiscard]] size_t getNumVectorised(size_t numFilters) {
+        using namespace marvin::dsp::filters::detail;
+        return getSIMDBiquadNumVectorised<SampleType>(getSIMDBiquadLanes<SampleType>(numFilters), numFilters);
+    }
+
+    TEST_CASE("Test SIMDBiquad small banks are vectorised") {
+        // Every instruction set the kernels can be dispatched to steps down to 16 byte batches for the filters that don't fill its widest ones, so all but the
+        // last few filters that don't fill a 16 byte batch should be vectorised, whatever the CPU - rather than falling back to scalar when the bank is narrower
+        // than, or not a multiple of, the widest batch.
+        for (const auto n : { 4_sz, 8_sz, 16_sz, 32_sz }) {
+            REQUIRE(getNumVectorised<float>(n) == n);
+        }
+        for (const auto n : { 2_sz, 4_sz, 8_sz, 16_sz }) {
+            REQUIRE(getNumVectorised<double>(n) == n);
+        }
+        // Not a power of two - eg 6 floats is 4 + 2 on AVX2, and 12 is 8 + 4 on AVX-512.
+        REQUIRE(getNumVectorised<float>(6) == 4);
+        REQUIRE(getNumVectorised<float>(12) == 12);
+        REQUIRE(getNumVectorised<float>(13) == 12);
+        REQUIRE(getNumVectorised<float>(21) == 20);
+        REQUIRE(getNumVectorised<float>(35) == 32);
+        REQUIRE(getNumVectorised<double>(3) == 2);
+        REQUIRE(getNumVectorised<double>(7) == 6);
+        REQUIRE(getNumVectorised<double>(13) == 12);
+        // Too narrow for any batch.
+        REQUIRE(getNumVectorised<float>(2) == 0);
+        REQUIRE(getNumVectorised<float>(3) == 0);
+        REQUIRE(getNumVectorised<double>(1) == 0);
+    }
+
     template <NumericType T>
     [[nodiscard]] std::string getTypeName() {
         if constexpr (std::is_same_v<T, float>) {
@@ -96,6 +232,26 @@ namespace marvin::testing {
                 simdFilters(simdInputs[i]);
             }
         };
+        std::vector<std::vector<SampleType>> channels(N, impulse);
+        std::vector<SampleType*> channelPtrs;
+        for (auto& channel : channels) {
+            channelPtrs.emplace_back(channel.data());
+        }
+        // The block overload's baseline - fixed coefficients, like the block benchmark below, so the coefficient calculation doesn't swamp the filtering.
+        for (auto& f : normalFilters) {
+            f.setCoeffs(0, coeffs);
+        }
+        simdFilters.setCoeffs(coeffs);
+        BENCHMARK(fmt::format("Biquad (block), N = {}, NSamples = {}, Type = {}", N, NumSamples, getTypeName<SampleType>())) {
+            for (auto channel = 0_sz; channel < N; ++channel) {
+                for (auto& x : channels[channel]) {
+                    x = normalFilters[channel](x);
+                }
+            }
+        };
+        BENCHMARK(fmt::format("SIMDBiquad<{}> (block), NSamples = {}, Type = {}", N, NumSamples, getTypeName<SampleType>())) {
+            simdFilters(containers::BufferView<SampleType>{ channelPtrs.data(), N, NumSamples });
+        };
     }
 
     TEST_CASE("Benchmark Biquads") {
@@ -114,6 +270,15 @@ namespace marvin::testing {
         benchmarkSIMD<float, 14, 32>();
         benchmarkSIMD<float, 15, 32>();
         benchmarkSIMD<float, 16, 32>();
+        // Multichannel EQ sized blocks - stereo, 5.1, 7.1 and 7.1.4.
+        benchmarkSIMD<float, 2, 512>();
+        benchmarkSIMD<float, 6, 512>();
+        benchmarkSIMD<float, 8, 512>();
+        benchmarkSIMD<float, 12, 512>();
+        benchmarkSIMD<double, 2, 512>();
+        benchmarkSIMD<double, 6, 512>();
+        benchmarkSIMD<double, 8, 512>();
+        benchmarkSIMD<double, 12, 512>();
     }
 
 } // namespace marvin::testing
\ No newline at end of file
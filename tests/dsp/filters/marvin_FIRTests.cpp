@@ -0,0 +1,158 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include <marvin/dsp/filters/marvin_FIR.h>
+#include <marvin/library/marvin_Literals.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "marvin_TestHelpers.h"
+#include <algorithm>
+#include <span>
+#include <vector>
+namespace marvin::testing {
+    namespace {
+        template <FloatType SampleType>
+        [[nodiscard]] SampleType referenceFIR(const std::vector<SampleType>& signal, const std::vector<SampleType>& coefficients, size_t n) {
+            auto sum = static_cast<SampleType>(0.0);
+            for (auto k = 0_sz; k < coefficients.size() && k <= n; ++k) {
+                sum += coefficients[k] * signal[n - k];
+            }
+            return sum;
+        }
+
+        template <FloatType SampleType>
+        void testFIR(size_t numTaps) {
+            const auto coefficients = generateNoise<SampleType>(numTaps);
+            const auto signal = generateNoise<SampleType>(numTaps * 3 + 11);
+            dsp::filters::FIR<SampleType> fir;
+            fir.setCoefficients(coefficients);
+            REQUIRE(fir.getNumTaps() == numTaps);
+            std::vector<SampleType> processed(signal.size());
+            fir.process(signal, processed);
+            for (auto i = 0_sz; i < signal.size(); ++i) {
+                REQUIRE_THAT(processed[i], Catch::Matchers::WithinAbs(referenceFIR(signal, coefficients, i), 1e-4));
+            }
+        }
+
+        template <FloatType SampleType>
+        void testMultichannelFIR(size_t numChannels, size_t numTaps) {
+            const auto coefficients = generateNoise<SampleType>(numTaps);
+            const auto numSamples = numTaps * 2 + 5;
+            std::vector<std::vector<SampleType>> signals;
+            std::vector<SampleType*> channels;
+            for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                signals.emplace_back(generateNoise<SampleType>(numSamples));
+            }
+            auto processed = signals;
+            for (auto& channel : processed) {
+                channels.emplace_back(channel.data());
+            }
+            dsp::filters::MultichannelFIR<SampleType> fir;
+            fir.initialise(numChannels, coefficients);
+            REQUIRE(fir.getNumChannels() == numChannels);
+            REQUIRE(fir.getNumTaps() == numTaps);
+            // In place, in two blocks.
+            const auto split = numSamples / 3;
+            std::vector<SampleType*> secondBlock;
+            for (auto* channel : channels) {
+                secondBlock.emplace_back(channel + split);
+            }
+            fir.process({ channels.data(), numChannels, split }, { channels.data(), numChannels, split });
+            fir.process({ secondBlock.data(), numChannels, numSamples - split }, { secondBlock.data(), numChannels, numSamples - split });
+            for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                for (auto i = 0_sz; i < numSamples; ++i) {
+                    REQUIRE_THAT(processed[channel][i], Catch::Matchers::WithinAbs(referenceFIR(signals[channel], coefficients, i), 1e-4));
+                }
+            }
+        }
+    } // namespace
+
+    TEST_CASE("Test FIR") {
+        SECTION("Against direct convolution") {
+            for (const auto numTaps : { 1_sz, 2_sz, 16_sz, 31_sz, 64_sz, 256_sz }) {
+                testFIR<float>(numTaps);
+                testFIR<double>(numTaps);
+            }
+        }
+
+        SECTION("Mixed block sizes and single samples") {
+            for (const auto numTaps : { 1_sz, 7_sz, 33_sz, 100_sz }) {
+                const auto coefficients = generateNoise<float>(numTaps);
+                const auto signal = generateNoise<float>(1000);
+                dsp::filters::FIR<float> fir;
+                fir.setCoefficients(coefficients);
+                auto processed = signal;
+                std::span<float> remaining{ processed };
+                for (auto i = 0_sz; !remaining.empty(); ++i) {
+                    const auto blockSize = std::min<size_t>(remaining.size(), (i * 37) % 151);
+                    if (blockSize == 0) {
+                        remaining[0] = fir(remaining[0]);
+                        remaining = remaining.subspan(1);
+                        continue;
+                    }
+                    fir.process(remaining.first(blockSize), remaining.first(blockSize));
+                    remaining = remaining.subspan(blockSize);
+                }
+                for (auto i = 0_sz; i < signal.size(); ++i) {
+                    REQUIRE_THAT(processed[i], Catch::Matchers::WithinAbs(referenceFIR(signal, coefficients, i), 1e-4));
+                }
+            }
+        }
+
+        SECTION("Coefficient swap keeps history") {
+            const auto first = generateNoise<double>(16);
+            const auto second = generateNoise<double>(16);
+            const auto signal = generateNoise<double>(40);
+            dsp::filters::FIR<double> fir;
+            fir.setCoefficients(first);
+            for (auto i = 0_sz; i < 20; ++i) {
+                [[maybe_unused]] const auto _ = fir(signal[i]);
+            }
+            fir.setCoefficients(second);
+            for (auto i = 20_sz; i < signal.size(); ++i) {
+                REQUIRE_THAT(fir(signal[i]), Catch::Matchers::WithinAbs(referenceFIR(signal, second, i), 1e-10));
+            }
+        }
+
+        SECTION("Reset") {
+            dsp::filters::FIR<float> fir;
+            fir.setCoefficients(generateNoise<float>(32));
+            for (const auto x : generateNoise<float>(50)) {
+                [[maybe_unused]] const auto _ = fir(x);
+            }
+            fir.reset();
+            for (auto i = 0_sz; i < 64; ++i) {
+                REQUIRE_THAT(fir(0.0f), Catch::Matchers::WithinAbs(0.0f, 1e-10));
+            }
+        }
+
+        SECTION("Multichannel against direct convolution") {
+            // Below, at, and around the SIMD widths of the instruction sets the kernels can be dispatched to.
+            for (const auto numChannels : { 1_sz, 2_sz, 3_sz, 4_sz, 8_sz, 13_sz, 16_sz }) {
+                testMultichannelFIR<float>(numChannels, 33);
+                testMultichannelFIR<double>(numChannels, 16);
+            }
+        }
+
+        SECTION("Multichannel single frame") {
+            const std::vector<float> coefficients{ 0.5f, 0.25f };
+            dsp::filters::MultichannelFIR<float> fir;
+            fir.initialise(3, coefficients);
+            std::vector<float> frame{ 1.0f, 2.0f, 3.0f };
+            fir(frame);
+            REQUIRE_THAT(frame[2], Catch::Matchers::WithinAbs(1.5f, 1e-6));
+            frame = { 0.0f, 0.0f, 0.0f };
+            fir(frame);
+            REQUIRE_THAT(frame[0], Catch::Matchers::WithinAbs(0.25f, 1e-6));
+            REQUIRE_THAT(frame[1], Catch::Matchers::WithinAbs(0.5f, 1e-6));
+            REQUIRE_THAT(frame[2], Catch::Matchers::WithinAbs(0.75f, 1e-6));
+        }
+    }
+} // namespace marvin::testing
@@ -0,0 +1,139 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include <marvin/dsp/spectral/marvin_Convolver.h>
+#include <marvin/library/marvin_Literals.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "marvin_TestHelpers.h"
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <type_traits>
+#include <vector>
+namespace marvin::testing {
+    /*
+        Processes `signal` in chunks cycling through `chunkSizes`, and checks the result against a direct convolution.
+    */
+    template <FloatType SampleType>
+    void testAgainstDirectConvolution(size_t blockSize, size_t irSize, const std::vector<size_t>& chunkSizes) {
+        const auto impulseResponse = generateNoise<SampleType>(irSize);
+        const auto signal = generateNoise<SampleType>(irSize * 2 + blockSize * 3 + 17);
+        const auto expected = directConvolution(signal, impulseResponse);
+        dsp::spectral::Convolver<SampleType> convolver;
+        convolver.initialise(blockSize, impulseResponse);
+        REQUIRE(convolver.getNumPartitions() == (irSize + blockSize - 1) / blockSize);
+        auto processed = signal;
+        auto position = 0_sz;
+        for (auto chunk = 0_sz; position < processed.size(); ++chunk) {
+            const auto size = std::min<size_t>(chunkSizes[chunk % chunkSizes.size()], processed.size() - position);
+            convolver.process({ processed.data() + position, size });
+            position += size;
+        }
+        // Noise is in [-1, 1], so the output grows with sqrt(irSize).
+        const auto tolerance = std::sqrt(static_cast<SampleType>(irSize)) * (std::is_same_v<SampleType, float> ? static_cast<SampleType>(1e-5) : static_cast<SampleType>(1e-12));
+        for (auto i = 0_sz; i < processed.size(); ++i) {
+            REQUIRE_THAT(processed[i], Catch::Matchers::WithinAbs(expected[i], tolerance));
+        }
+    }
+
+    /*
+        Convolves `numInputs` channels with a matrix of impulse responses of assorted lengths (including a disconnected path), and checks each output
+        against the sum of the direct convolutions of the paths into it.
+    */
+    template <FloatType SampleType>
+    void testMatrixAgainstDirectConvolution(size_t blockSize, size_t numInputs, size_t numOutputs, const std::vector<size_t>& chunkSizes) {
+        std::vector<std::vector<SampleType>> impulseResponses;
+        for (auto path = 0_sz; path < numInputs * numOutputs; ++path) {
+            impulseResponses.emplace_back(generateNoise<SampleType>(path == 1 ? 0 : 300 + path * 97));
+        }
+        const std::vector<std::span<const SampleType>> irViews{ impulseResponses.begin(), impulseResponses.end() };
+        const auto numSamples = 1500_sz;
+        std::vector<std::vector<SampleType>> inputs;
+        for (auto input = 0_sz; input < numInputs; ++input) {
+            inputs.emplace_back(generateNoise<SampleType>(numSamples));
+        }
+        std::vector<std::vector<SampleType>> outputs(numOutputs, std::vector<SampleType>(numSamples));
+        dsp::spectral::MatrixConvolver<SampleType> convolver;
+        convolver.initialise(blockSize, numInputs, numOutputs, irViews);
+        std::vector<SampleType*> inputPointers(numInputs), outputPointers(numOutputs);
+        auto position = 0_sz;
+        for (auto chunk = 0_sz; position < numSamples; ++chunk) {
+            const auto size = std::min<size_t>(chunkSizes[chunk % chunkSizes.size()], numSamples - position);
+            for (auto input = 0_sz; input < numInputs; ++input) {
+                inputPointers[input] = inputs[input].data() + position;
+            }
+            for (auto output = 0_sz; output < numOutputs; ++output) {
+                outputPointers[output] = outputs[output].data() + position;
+            }
+            convolver.process({ inputPointers.data(), numInputs, size }, { outputPointers.data(), numOutputs, size });
+            position += size;
+        }
+        const auto tolerance = std::sqrt(static_cast<SampleType>(numInputs * 1000)) * (std::is_same_v<SampleType, float> ? static_cast<SampleType>(1e-5) : static_cast<SampleType>(1e-12));
+        for (auto output = 0_sz; output < numOutputs; ++output) {
+            std::vector<SampleType> expected(numSamples, static_cast<SampleType>(0.0));
+            for (auto input = 0_sz; input < numInputs; ++input) {
+                const auto path = directConvolution(inputs[input], impulseResponses[output * numInputs + input]);
+                for (auto i = 0_sz; i < numSamples; ++i) {
+                    expected[i] += path[i];
+                }
+            }
+            for (auto i = 0_sz; i < numSamples; ++i) {
+                REQUIRE_THAT(outputs[output][i], Catch::Matchers::WithinAbs(expected[i], tolerance));
+            }
+        }
+    }
+
+    TEST_CASE("Test Convolver") {
+        SECTION("Against direct convolution") {
+            for (const auto& chunkSizes : std::vector<std::vector<size_t>>{ { 64 }, { 1 }, { 7, 64, 200, 13 } }) {
+                testAgainstDirectConvolution<float>(64, 1000, chunkSizes);
+                testAgainstDirectConvolution<double>(64, 1000, chunkSizes);
+                // Shorter than a single partition, and a non-power-of-two block size.
+                testAgainstDirectConvolution<float>(64, 10, chunkSizes);
+                testAgainstDirectConvolution<double>(48, 500, chunkSizes);
+            }
+        }
+
+        SECTION("Zero latency impulse") {
+            const auto impulseResponse = generateNoise<float>(300);
+            dsp::spectral::Convolver<float> convolver;
+            convolver.initialise(32, impulseResponse);
+            std::vector<float> impulse(400, 0.0f);
+            impulse[0] = 1.0f;
+            convolver.process(impulse);
+            for (auto i = 0_sz; i < impulse.size(); ++i) {
+                REQUIRE_THAT(impulse[i], Catch::Matchers::WithinAbs(i < impulseResponse.size() ? impulseResponse[i] : 0.0f, 1e-5));
+            }
+        }
+
+        SECTION("Matrix against direct convolution") {
+            for (const auto& chunkSizes : std::vector<std::vector<size_t>>{ { 64 }, { 1 }, { 7, 64, 200, 13 } }) {
+                testMatrixAgainstDirectConvolution<float>(64, 2, 2, chunkSizes);
+                testMatrixAgainstDirectConvolution<double>(64, 2, 3, chunkSizes);
+                testMatrixAgainstDirectConvolution<float>(32, 4, 1, chunkSizes);
+            }
+        }
+
+        SECTION("Reset") {
+            const auto impulseResponse = generateNoise<double>(200);
+            dsp::spectral::Convolver<double> convolver;
+            convolver.initialise(32, impulseResponse);
+            auto noise = generateNoise<double>(100);
+            convolver.process(noise);
+            convolver.reset();
+            std::vector<double> silence(300, 0.0);
+            convolver.process(silence);
+            for (const auto x : silence) {
+                REQUIRE_THAT(x, Catch::Matchers::WithinAbs(0.0, 1e-12));
+            }
+        }
+    }
+} // namespace marvin::testing
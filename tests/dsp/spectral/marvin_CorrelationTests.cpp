@@ -0,0 +1,147 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include <marvin/dsp/spectral/marvin_Correlation.h>
+#include <marvin/library/marvin_Literals.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "marvin_TestHelpers.h"
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+namespace marvin::testing {
+    namespace {
+        template <FloatType SampleType>
+        [[nodiscard]] SampleType directCorrelation(const std::vector<SampleType>& lhs, const std::vector<SampleType>& rhs, std::ptrdiff_t lag) {
+            auto sum = static_cast<SampleType>(0.0);
+            for (auto n = 0_sz; n < rhs.size(); ++n) {
+                const auto lhsIndex = static_cast<std::ptrdiff_t>(n) + lag;
+                if (lhsIndex >= 0 && lhsIndex < static_cast<std::ptrdiff_t>(lhs.size())) {
+                    sum += lhs[static_cast<size_t>(lhsIndex)] * rhs[n];
+                }
+            }
+            return sum;
+        }
+
+        template <FloatType SampleType>
+        void testAgainstDirect(size_t lhsSize, size_t rhsSize) {
+            const auto lhs = generateNoise<SampleType>(lhsSize);
+            const auto rhs = generateNoise<SampleType>(rhsSize);
+            const auto result = dsp::spectral::correlate<SampleType>(lhs, rhs);
+            REQUIRE(result.size() == lhsSize + rhsSize - 1);
+            const auto firstLag = -static_cast<std::ptrdiff_t>(rhsSize - 1);
+            for (auto i = 0_sz; i < result.size(); ++i) {
+                const auto expected = directCorrelation(lhs, rhs, firstLag + static_cast<std::ptrdiff_t>(i));
+                REQUIRE_THAT(result[i], Catch::Matchers::WithinAbs(expected, 1e-3));
+            }
+            const auto autocorrelation = dsp::spectral::autocorrelate<SampleType>(lhs);
+            REQUIRE(autocorrelation.size() == lhsSize);
+            for (auto lag = 0_sz; lag < autocorrelation.size(); ++lag) {
+                const auto expected = directCorrelation(lhs, lhs, static_cast<std::ptrdiff_t>(lag));
+                REQUIRE_THAT(autocorrelation[lag], Catch::Matchers::WithinAbs(expected, 1e-3));
+            }
+        }
+
+        /*
+            A handful of sines at random frequencies and phases, evaluated at `n - delay` - smooth enough for the parabolic fit to land on a fractional delay.
+        */
+        template <FloatType SampleType>
+        [[nodiscard]] std::vector<SampleType> generateSines(size_t size, double delay, unsigned int seed) {
+            std::mt19937 rng{ seed };
+            std::uniform_real_distribution<double> frequencyDist{ 0.002, 0.03 };
+            std::uniform_real_distribution<double> phaseDist{ 0.0, 2.0 * std::numbers::pi };
+            std::vector<SampleType> signal(size, static_cast<SampleType>(0.0));
+            for (auto partial = 0; partial < 16; ++partial) {
+                const auto frequency = frequencyDist(rng);
+                const auto phase = phaseDist(rng);
+                for (auto n = 0_sz; n < size; ++n) {
+                    signal[n] += static_cast<SampleType>(0.1 * std::sin(2.0 * std::numbers::pi * frequency * (static_cast<double>(n) - delay) + phase));
+                }
+            }
+            return signal;
+        }
+    } // namespace
+
+    TEST_CASE("Test Correlation") {
+        SECTION("Matches direct correlation") {
+            for (const auto& [lhsSize, rhsSize] : std::vector<std::pair<size_t, size_t>>{ { 1, 1 }, { 1, 17 }, { 64, 64 }, { 100, 7 }, { 33, 250 } }) {
+                testAgainstDirect<float>(lhsSize, rhsSize);
+                testAgainstDirect<double>(lhsSize, rhsSize);
+            }
+        }
+
+        SECTION("Correlator reuse with smaller inputs") {
+            dsp::spectral::Correlator<double> correlator;
+            correlator.initialise(512, 128);
+            REQUIRE(correlator.getFFTSize() >= 512 + 128 - 1);
+            REQUIRE(correlator.getFFTSize() == 640);
+            for (const auto& [lhsSize, rhsSize] : std::vector<std::pair<size_t, size_t>>{ { 512, 128 }, { 300, 50 }, { 10, 128 } }) {
+                const auto lhs = generateNoise<double>(lhsSize);
+                const auto rhs = generateNoise<double>(rhsSize);
+                std::vector<double> result(lhsSize + rhsSize - 1);
+                correlator.correlate(lhs, rhs, result);
+                const auto firstLag = -static_cast<std::ptrdiff_t>(rhsSize - 1);
+                for (auto i = 0_sz; i < result.size(); ++i) {
+                    REQUIRE_THAT(result[i], Catch::Matchers::WithinAbs(directCorrelation(lhs, rhs, firstLag + static_cast<std::ptrdiff_t>(i)), 1e-9));
+                }
+            }
+        }
+
+        SECTION("Integer delay") {
+            // Ten seconds at 48kHz, with the delayed copy 1234 samples behind.
+            const auto rhs = generateNoise<float>(480000);
+            std::vector<float> lhs(rhs.size(), 0.0f);
+            std::copy(rhs.begin(), rhs.end() - 1234, lhs.begin() + 1234);
+            const auto result = dsp::spectral::correlate<float>(lhs, rhs);
+            const auto peak = dsp::spectral::findPeak<float>(result, -static_cast<std::ptrdiff_t>(rhs.size() - 1));
+            REQUIRE_THAT(peak.lag, Catch::Matchers::WithinAbs(1234.0, 0.05));
+            // Swapping the arguments mirrors the lags.
+            const auto swapped = dsp::spectral::correlate<float>(rhs, lhs);
+            const auto swappedPeak = dsp::spectral::findPeak<float>(swapped, -static_cast<std::ptrdiff_t>(lhs.size() - 1));
+            REQUIRE_THAT(swappedPeak.lag, Catch::Matchers::WithinAbs(-1234.0, 0.05));
+        }
+
+        SECTION("Fractional delay") {
+            // Correlating against a segment from the middle keeps the overlap (and so the correlation's envelope) constant around the peak.
+            const auto reference = generateSines<double>(4096, 0.0, 1234);
+            const std::vector<double> rhs(reference.begin() + 1024, reference.begin() + 3072);
+            for (const auto delay : { 3.25, 10.5, 47.8 }) {
+                const auto lhs = generateSines<double>(4096, delay, 1234);
+                const auto result = dsp::spectral::correlate<double>(lhs, rhs);
+                const auto peak = dsp::spectral::findPeak<double>(result, -static_cast<std::ptrdiff_t>(rhs.size() - 1), 824, 1224);
+                REQUIRE_THAT(peak.lag, Catch::Matchers::WithinAbs(1024.0 + delay, 0.05));
+            }
+        }
+
+        SECTION("Autocorrelation period") {
+            const auto period = 100.5;
+            std::vector<double> sine(4800);
+            for (auto n = 0_sz; n < sine.size(); ++n) {
+                sine[n] = std::sin(2.0 * std::numbers::pi * static_cast<double>(n) / period);
+            }
+            const auto autocorrelation = dsp::spectral::autocorrelate<double>(sine);
+            // Skip the zero-lag peak.
+            const auto peak = dsp::spectral::findPeak<double>(autocorrelation, 0, 50, 150);
+            REQUIRE_THAT(peak.lag, Catch::Matchers::WithinAbs(period, 0.1));
+            REQUIRE(peak.value > autocorrelation[100]);
+            const auto zeroLag = dsp::spectral::findPeak<double>(autocorrelation);
+            REQUIRE(zeroLag.lag == 0.0);
+        }
+
+        SECTION("Empty search range") {
+            const std::vector<float> correlation{ 1.0f, 2.0f, 1.0f };
+            const auto peak = dsp::spectral::findPeak<float>(correlation, 0, 5, 10);
+            REQUIRE(peak.lag == 0.0f);
+            REQUIRE(peak.value == 0.0f);
+            REQUIRE(dsp::spectral::correlate<float>({}, correlation).empty());
+        }
+    }
+} // namespace marvin::testing
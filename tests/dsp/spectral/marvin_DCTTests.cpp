@@ -0,0 +1,149 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include <marvin/dsp/spectral/marvin_DCT.h>
+#include <marvin/library/marvin_Literals.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "marvin_TestHelpers.h"
+#include <cmath>
+#include <numbers>
+#include <vector>
+namespace marvin::testing {
+    namespace {
+        template <FloatType SampleType>
+        [[nodiscard]] std::vector<SampleType> directDCT(dsp::spectral::DCTType type, const std::vector<SampleType>& source) {
+            const auto size = source.size();
+            const auto n = static_cast<double>(size);
+            std::vector<SampleType> result(size);
+            for (auto k = 0_sz; k < size; ++k) {
+                auto sum = type == dsp::spectral::DCTType::III ? static_cast<double>(source[0]) / 2.0 : 0.0;
+                for (auto i = 0_sz; i < size; ++i) {
+                    const auto index = static_cast<double>(i);
+                    const auto bin = static_cast<double>(k);
+                    switch (type) {
+                        case dsp::spectral::DCTType::II: sum += static_cast<double>(source[i]) * std::cos(std::numbers::pi / n * (index + 0.5) * bin); break;
+                        case dsp::spectral::DCTType::III: sum += i == 0 ? 0.0 : static_cast<double>(source[i]) * std::cos(std::numbers::pi / n * index * (bin + 0.5)); break;
+                        case dsp::spectral::DCTType::IV: sum += static_cast<double>(source[i]) * std::cos(std::numbers::pi / n * (index + 0.5) * (bin + 0.5)); break;
+                    }
+                }
+                result[k] = static_cast<SampleType>(sum);
+            }
+            return result;
+        }
+
+        template <FloatType SampleType>
+        void testDCT(dsp::spectral::DCTType type, size_t size) {
+            dsp::spectral::DCT<SampleType> dct{ type, size };
+            REQUIRE(dct.getType() == type);
+            REQUIRE(dct.getSize() == size);
+            const auto source = generateNoise<SampleType>(size);
+            const auto expected = directDCT(type, source);
+            std::vector<SampleType> result(size);
+            dct.transform(source, result);
+            const auto tolerance = static_cast<double>(size) * (std::is_same_v<SampleType, float> ? 1e-5 : 1e-10);
+            for (auto k = 0_sz; k < size; ++k) {
+                REQUIRE_THAT(result[k], Catch::Matchers::WithinAbs(expected[k], tolerance));
+            }
+            // In place.
+            auto inPlace = source;
+            dct.transform(inPlace, inPlace);
+            for (auto k = 0_sz; k < size; ++k) {
+                REQUIRE_THAT(inPlace[k], Catch::Matchers::WithinAbs(result[k], tolerance));
+            }
+        }
+
+        template <FloatType SampleType>
+        [[nodiscard]] std::vector<SampleType> directMDCT(const std::vector<SampleType>& source, const std::vector<SampleType>& window) {
+            const auto size = source.size() / 2;
+            const auto n = static_cast<double>(size);
+            std::vector<SampleType> result(size);
+            for (auto k = 0_sz; k < size; ++k) {
+                auto sum = 0.0;
+                for (auto i = 0_sz; i < source.size(); ++i) {
+                    sum += static_cast<double>(source[i] * window[i]) * std::cos(std::numbers::pi / n * (static_cast<double>(i) + 0.5 + n / 2.0) * (static_cast<double>(k) + 0.5));
+                }
+                result[k] = static_cast<SampleType>(sum);
+            }
+            return result;
+        }
+
+        template <FloatType SampleType>
+        void testMDCT(size_t size) {
+            dsp::spectral::MDCT<SampleType> mdct{ size };
+            REQUIRE(mdct.getSize() == size);
+            std::vector<SampleType> window(size * 2);
+            for (auto i = 0_sz; i < window.size(); ++i) {
+                window[i] = static_cast<SampleType>(std::sin(std::numbers::pi * (static_cast<double>(i) + 0.5) / static_cast<double>(size * 2)));
+            }
+            const auto tolerance = static_cast<double>(size) * (std::is_same_v<SampleType, float> ? 1e-5 : 1e-10);
+            const auto frame = generateNoise<SampleType>(size * 2);
+            const auto expected = directMDCT(frame, window);
+            std::vector<SampleType> coefficients(size);
+            mdct.forward(frame, coefficients);
+            for (auto k = 0_sz; k < size; ++k) {
+                REQUIRE_THAT(coefficients[k], Catch::Matchers::WithinAbs(expected[k], tolerance));
+            }
+            // Overlap-adding the inverse of consecutive frames (hopped by N) cancels the aliasing, everywhere covered by two frames.
+            const auto signal = generateNoise<SampleType>(size * 8);
+            std::vector<SampleType> reconstructed(signal.size(), static_cast<SampleType>(0.0));
+            std::vector<SampleType> output(size * 2);
+            for (auto start = 0_sz; start + size * 2 <= signal.size(); start += size) {
+                mdct.forward({ signal.data() + start, size * 2 }, coefficients);
+                mdct.inverse(coefficients, output);
+                for (auto i = 0_sz; i < output.size(); ++i) {
+                    reconstructed[start + i] += output[i];
+                }
+            }
+            for (auto i = size; i < signal.size() - size; ++i) {
+                REQUIRE_THAT(reconstructed[i], Catch::Matchers::WithinAbs(signal[i], 1e-4));
+            }
+        }
+    } // namespace
+
+    TEST_CASE("Test DCT") {
+        using DCTType = dsp::spectral::DCTType;
+        SECTION("Matches direct DCT") {
+            for (const auto type : { DCTType::II, DCTType::III, DCTType::IV }) {
+                for (const auto size : { 4_sz, 6_sz, 16_sz, 30_sz, 64_sz, 256_sz }) {
+                    testDCT<float>(type, size);
+                    testDCT<double>(type, size);
+                }
+            }
+        }
+
+        SECTION("Inverses") {
+            // III undoes II, and IV undoes itself, both scaled by N / 2.
+            const auto size = 128_sz;
+            const auto source = generateNoise<double>(size);
+            dsp::spectral::DCT<double> dct2{ DCTType::II, size };
+            dsp::spectral::DCT<double> dct3{ DCTType::III, size };
+            dsp::spectral::DCT<double> dct4{ DCTType::IV, size };
+            std::vector<double> transformed(size), restored(size);
+            dct2.transform(source, transformed);
+            dct3.transform(transformed, restored);
+            for (auto i = 0_sz; i < size; ++i) {
+                REQUIRE_THAT(restored[i], Catch::Matchers::WithinAbs(source[i] * 64.0, 1e-9));
+            }
+            dct4.transform(source, transformed);
+            dct4.transform(transformed, restored);
+            for (auto i = 0_sz; i < size; ++i) {
+                REQUIRE_THAT(restored[i], Catch::Matchers::WithinAbs(source[i] * 64.0, 1e-9));
+            }
+        }
+    }
+
+    TEST_CASE("Test MDCT") {
+        for (const auto size : { 4_sz, 16_sz, 60_sz, 256_sz }) {
+            testMDCT<float>(size);
+            testMDCT<double>(size);
+        }
+    }
+} // namespace marvin::testing
@@ -10,10 +10,13 @@
 
 #include "catch2/matchers/catch_matchers.hpp"
 #include "marvin/containers/marvin_StrideView.h"
+#include "marvin/containers/marvin_BufferView.h"
 #include "marvin/containers/marvin_SwapBuffer.h"
 #include "marvin/library/marvin_Concepts.h"
 #include "marvin/utils/marvin_Utils.h"
+#include <bit>
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <marvin/dsp/spectral/marvin_FFT.h>
 #include <marvin/dsp/oscillators/marvin_Oscillator.h>
@@ -22,6 +25,8 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <unordered_map>
 #include <array>
+#include <vector>
+#include <memory>
 #include <iostream>
 namespace marvin::testing {
     static std::random_device s_rd{};
@@ -200,6 +205,192 @@ namespace marvin::testing {
         }
     }
 
+    template <FloatType SampleType>
+    void compareAgainstNaiveDFT(dsp::spectral::FFT<std::complex<SampleType>>& engine) {
+        const auto size = engine.getFFTSize();
+        marvin::dsp::oscillators::NoiseOscillator<SampleType> noiseOsc{ s_rd };
+        std::vector<std::complex<SampleType>> signal(size), results(size), roundTrip(size);
+        for (auto& x : signal) {
+            x = { noiseOsc(), noiseOsc() };
+        }
+        engine.forward(signal, results);
+        engine.inverse(results, roundTrip);
+        const auto tolerance = static_cast<SampleType>(std::bit_width(size)) * std::numeric_limits<SampleType>::epsilon() * static_cast<SampleType>(8.0);
+        // Scaled by the signal's rms (~sqrt(N)), so the tolerance is relative to the overall energy rather than each bin.
+        const auto scale = std::sqrt(static_cast<double>(size));
+        for (auto k = 0_sz; k < size; ++k) {
+            std::complex<double> expected{ 0.0, 0.0 };
+            for (auto n = 0_sz; n < size; ++n) {
+                const auto phase = -2.0 * std::numbers::pi * static_cast<double>((k * n) % size) / static_cast<double>(size);
+                expected += std::complex<double>{ signal[n].real(), signal[n].imag() } * std::polar(1.0, phase);
+            }
+            REQUIRE_THAT(results[k].real() / scale, Catch::Matchers::WithinAbs(expected.real() / scale, tolerance));
+            REQUIRE_THAT(results[k].imag() / scale, Catch::Matchers::WithinAbs(expected.imag() / scale, tolerance));
+            REQUIRE_THAT(roundTrip[k].real(), Catch::Matchers::WithinAbs(signal[k].real(), tolerance));
+            REQUIRE_THAT(roundTrip[k].imag(), Catch::Matchers::WithinAbs(signal[k].imag(), tolerance));
+        }
+    }
+
+    template <FloatType SampleType>
+    void compareAgainstNaiveDFT(dsp::spectral::FFT<SampleType>& engine) {
+        const auto size = engine.getFFTSize();
+        marvin::dsp::oscillators::NoiseOscillator<SampleType> noiseOsc{ s_rd };
+        std::vector<SampleType> signal(size), roundTrip(size);
+        std::vector<std::complex<SampleType>> results((size / 2) + 1);
+        for (auto& x : signal) {
+            x = noiseOsc();
+        }
+        engine.forward(signal, results);
+        engine.inverse(results, roundTrip);
+        const auto tolerance = static_cast<SampleType>(std::bit_width(size)) * std::numeric_limits<SampleType>::epsilon() * static_cast<SampleType>(8.0);
+        const auto scale = std::sqrt(static_cast<double>(size));
+        for (auto k = 0_sz; k < results.size(); ++k) {
+            std::complex<double> expected{ 0.0, 0.0 };
+            for (auto n = 0_sz; n < size; ++n) {
+                const auto phase = -2.0 * std::numbers::pi * static_cast<double>((k * n) % size) / static_cast<double>(size);
+                expected += static_cast<double>(signal[n]) * std::polar(1.0, phase);
+            }
+            REQUIRE_THAT(results[k].real() / scale, Catch::Matchers::WithinAbs(expected.real() / scale, tolerance));
+            REQUIRE_THAT(results[k].imag() / scale, Catch::Matchers::WithinAbs(expected.imag() / scale, tolerance));
+        }
+        for (auto i = 0_sz; i < size; ++i) {
+            REQUIRE_THAT(roundTrip[i], Catch::Matchers::WithinAbs(signal[i], tolerance));
+        }
+    }
+
+    template <FloatType SampleType, size_t Order>
+    void testAgainstNaiveDFT() {
+        dsp::spectral::FFT<std::complex<SampleType>> engine{ Order };
+        compareAgainstNaiveDFT(engine);
+    }
+
+    template <FloatType SampleType, size_t Order>
+    void testRealAgainstNaiveDFT() {
+        dsp::spectral::FFT<SampleType> engine{ Order };
+        compareAgainstNaiveDFT(engine);
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    void testSizeAgainstNaiveDFT(size_t size) {
+        dsp::spectral::FFT<SampleType> engine{ dsp::spectral::FFTSize{ size } };
+        REQUIRE(engine.getFFTSize() == size);
+        compareAgainstNaiveDFT(engine);
+    }
+
+    template <RealOrComplexFloatType SampleType>
+    void testBatchAgainstSingle(size_t size, size_t numChannels) {
+        using ValueType = typename dsp::spectral::getValueType<SampleType>::ValueType;
+        dsp::spectral::FFT<SampleType> engine{ dsp::spectral::FFTSize{ size } };
+        const auto numBins = ComplexFloatType<SampleType> ? size : (size / 2) + 1;
+        marvin::dsp::oscillators::NoiseOscillator<ValueType> noiseOsc{ s_rd };
+        std::vector<std::vector<SampleType>> signals(numChannels, std::vector<SampleType>(size)), roundTrips(numChannels, std::vector<SampleType>(size));
+        std::vector<std::vector<std::complex<ValueType>>> spectra(numChannels, std::vector<std::complex<ValueType>>(numBins));
+        std::vector<SampleType*> signalPtrs, roundTripPtrs;
+        std::vector<std::complex<ValueType>*> spectrumPtrs;
+        for (auto channel = 0_sz; channel < numChannels; ++channel) {
+            for (auto& x : signals[channel]) {
+                if constexpr (ComplexFloatType<SampleType>) {
+                    x = { noiseOsc(), noiseOsc() };
+                } else {
+                    x = noiseOsc();
+                }
+            }
+            signalPtrs.emplace_back(signals[channel].data());
+            roundTripPtrs.emplace_back(roundTrips[channel].data());
+            spectrumPtrs.emplace_back(spectra[channel].data());
+        }
+        containers::BufferView<SampleType> signalView{ signalPtrs.data(), numChannels, size };
+        containers::BufferView<SampleType> roundTripView{ roundTripPtrs.data(), numChannels, size };
+        containers::BufferView<std::complex<ValueType>> spectrumView{ spectrumPtrs.data(), numChannels, numBins };
+        engine.forwardBatch(signalView, spectrumView);
+        engine.inverseBatch(spectrumView, roundTripView);
+        const auto tolerance = static_cast<ValueType>(std::bit_width(size)) * std::numeric_limits<ValueType>::epsilon() * static_cast<ValueType>(8.0);
+        const auto scale = static_cast<ValueType>(std::sqrt(static_cast<double>(size)));
+        std::vector<std::complex<ValueType>> expected(numBins);
+        for (auto channel = 0_sz; channel < numChannels; ++channel) {
+            engine.forward(signals[channel], expected);
+            for (auto k = 0_sz; k < numBins; ++k) {
+                REQUIRE_THAT(spectra[channel][k].real() / scale, Catch::Matchers::WithinAbs(expected[k].real() / scale, tolerance));
+                REQUIRE_THAT(spectra[channel][k].imag() / scale, Catch::Matchers::WithinAbs(expected[k].imag() / scale, tolerance));
+            }
+            for (auto i = 0_sz; i < size; ++i) {
+                if constexpr (ComplexFloatType<SampleType>) {
+                    REQUIRE_THAT(roundTrips[channel][i].real(), Catch::Matchers::WithinAbs(signals[channel][i].real(), tolerance));
+                    REQUIRE_THAT(roundTrips[channel][i].imag(), Catch::Matchers::WithinAbs(signals[channel][i].imag(), tolerance));
+                } else {
+                    REQUIRE_THAT(roundTrips[channel][i], Catch::Matchers::WithinAbs(signals[channel][i], tolerance));
+                }
+            }
+        }
+    }
+
+    /*
+        Checks the in-place, split complex and unscaled entry points against the regular out-of-place ones.
+    */
+    template <RealOrComplexFloatType SampleType>
+    void testAlternateEntryPoints(size_t size) {
+        using ValueType = typename dsp::spectral::getValueType<SampleType>::ValueType;
+        dsp::spectral::FFT<SampleType> engine{ dsp::spectral::FFTSize{ size } };
+        const auto numBins = ComplexFloatType<SampleType> ? size : (size / 2) + 1;
+        marvin::dsp::oscillators::NoiseOscillator<ValueType> noiseOsc{ s_rd };
+        std::vector<SampleType> signal(size), roundTrip(size);
+        for (auto& x : signal) {
+            if constexpr (ComplexFloatType<SampleType>) {
+                x = { noiseOsc(), noiseOsc() };
+            } else {
+                x = noiseOsc();
+            }
+        }
+        std::vector<std::complex<ValueType>> expected(numBins);
+        engine.forward(signal, expected);
+        const auto tolerance = static_cast<ValueType>(std::bit_width(size)) * std::numeric_limits<ValueType>::epsilon() * static_cast<ValueType>(8.0);
+        const auto scale = static_cast<ValueType>(std::sqrt(static_cast<double>(size)));
+        const auto requireSpectrumMatches = [&](std::complex<ValueType> actual, std::complex<ValueType> target) {
+            REQUIRE_THAT(actual.real() / scale, Catch::Matchers::WithinAbs(target.real() / scale, tolerance));
+            REQUIRE_THAT(actual.imag() / scale, Catch::Matchers::WithinAbs(target.imag() / scale, tolerance));
+        };
+        const auto requireSignalMatches = [&](const SampleType* actual, ValueType factor) {
+            for (auto i = 0_sz; i < size; ++i) {
+                if constexpr (ComplexFloatType<SampleType>) {
+                    REQUIRE_THAT(actual[i].real() * factor, Catch::Matchers::WithinAbs(signal[i].real(), tolerance));
+                    REQUIRE_THAT(actual[i].imag() * factor, Catch::Matchers::WithinAbs(signal[i].imag(), tolerance));
+                } else {
+                    REQUIRE_THAT(actual[i] * factor, Catch::Matchers::WithinAbs(signal[i], tolerance));
+                }
+            }
+        };
+        // In place - the real signal is packed into the start of the complex buffer.
+        std::vector<std::complex<ValueType>> inPlace(numBins);
+        std::memcpy(inPlace.data(), signal.data(), size * sizeof(SampleType));
+        engine.forwardInPlace(inPlace);
+        for (auto k = 0_sz; k < numBins; ++k) {
+            requireSpectrumMatches(inPlace[k], expected[k]);
+        }
+        engine.inverseInPlace(inPlace);
+        requireSignalMatches(reinterpret_cast<const SampleType*>(inPlace.data()), static_cast<ValueType>(1.0));
+        // Split complex.
+        std::vector<ValueType> real(numBins), imag(numBins);
+        engine.forward(signal, math::vecops::SplitComplex<ValueType>{ real.data(), imag.data() });
+        for (auto k = 0_sz; k < numBins; ++k) {
+            requireSpectrumMatches({ real[k], imag[k] }, expected[k]);
+        }
+        engine.inverse(math::vecops::SplitComplex<ValueType>{ real.data(), imag.data() }, roundTrip);
+        requireSignalMatches(roundTrip.data(), static_cast<ValueType>(1.0));
+        for (auto k = 0_sz; k < numBins; ++k) {
+            requireSpectrumMatches({ real[k], imag[k] }, expected[k]);
+        }
+        // Unscaled - the skipped scaling is reported by the getters instead.
+        engine.setScalingEnabled(false);
+        std::vector<std::complex<ValueType>> unscaled(numBins);
+        engine.forward(signal, unscaled);
+        for (auto k = 0_sz; k < numBins; ++k) {
+            requireSpectrumMatches(unscaled[k] * engine.getForwardScaling(), expected[k]);
+        }
+        engine.inverse(expected, roundTrip);
+        requireSignalMatches(roundTrip.data(), engine.getInverseScaling());
+        REQUIRE_THAT(engine.getInverseScaling(), Catch::Matchers::WithinRel(static_cast<ValueType>(1.0) / static_cast<ValueType>(size)));
+    }
+
     TEST_CASE("Test Real-Only Round Trip") {
         testRealImpulse<float, 4>();
         testComplexImpulse<float, 4>();
@@ -299,4 +490,93 @@ namespace marvin::testing {
         // testLinearity<double, 13>();
     }
 
-} // namespace marvin::testing
\ No newline at end of file
+    TEST_CASE("Test Against Naive DFT") {
+        // Covers both odd and even orders, so both the pure radix-4 and radix-4 + radix-2 paths of the fallback get exercised.
+        testAgainstNaiveDFT<float, 1>();
+        testAgainstNaiveDFT<float, 2>();
+        testAgainstNaiveDFT<float, 3>();
+        testAgainstNaiveDFT<float, 4>();
+        testAgainstNaiveDFT<float, 5>();
+        testAgainstNaiveDFT<float, 6>();
+        testAgainstNaiveDFT<float, 7>();
+        testAgainstNaiveDFT<float, 8>();
+        testAgainstNaiveDFT<float, 9>();
+        testAgainstNaiveDFT<float, 10>();
+        testAgainstNaiveDFT<double, 1>();
+        testAgainstNaiveDFT<double, 2>();
+        testAgainstNaiveDFT<double, 3>();
+        testAgainstNaiveDFT<double, 4>();
+        testAgainstNaiveDFT<double, 5>();
+        testAgainstNaiveDFT<double, 6>();
+        testAgainstNaiveDFT<double, 7>();
+        testAgainstNaiveDFT<double, 8>();
+        testAgainstNaiveDFT<double, 9>();
+        testAgainstNaiveDFT<double, 10>();
+        // Odd and even orders again for the real transforms, so the half-length complex transform goes through both paths too.
+        testRealAgainstNaiveDFT<float, 1>();
+        testRealAgainstNaiveDFT<float, 2>();
+        testRealAgainstNaiveDFT<float, 3>();
+        testRealAgainstNaiveDFT<float, 4>();
+        testRealAgainstNaiveDFT<float, 5>();
+        testRealAgainstNaiveDFT<float, 8>();
+        testRealAgainstNaiveDFT<float, 11>();
+        testRealAgainstNaiveDFT<double, 1>();
+        testRealAgainstNaiveDFT<double, 2>();
+        testRealAgainstNaiveDFT<double, 3>();
+        testRealAgainstNaiveDFT<double, 4>();
+        testRealAgainstNaiveDFT<double, 5>();
+        testRealAgainstNaiveDFT<double, 8>();
+        testRealAgainstNaiveDFT<double, 11>();
+    }
+
+    TEST_CASE("Test Non Power Of Two Sizes") {
+        // Mixed radix: 480 = 2^5 * 3 * 5, 1470 = 2 * 3 * 5 * 7^2 (735 complex points for the real transform), 960 = 2^6 * 3 * 5.
+        // Bluestein: 17 and 97 are prime, 202 = 2 * 101 leaves a prime for the real transform's half-length complex transform.
+        for (const auto size : { 3_sz, 5_sz, 7_sz, 12_sz, 17_sz, 97_sz, 480_sz, 1470_sz }) {
+            testSizeAgainstNaiveDFT<std::complex<float>>(size);
+            testSizeAgainstNaiveDFT<std::complex<double>>(size);
+        }
+        for (const auto size : { 6_sz, 10_sz, 14_sz, 202_sz, 480_sz, 960_sz, 1470_sz }) {
+            testSizeAgainstNaiveDFT<float>(size);
+            testSizeAgainstNaiveDFT<double>(size);
+        }
+    }
+
+    TEST_CASE("Test Batched Transforms") {
+        // 1 channel takes the same route as the single channel path, 3 leaves a scalar tail after the SIMD lanes, 16 fills every lane on every arch.
+        for (const auto numChannels : { 1_sz, 3_sz, 16_sz }) {
+            for (const auto size : { 2_sz, 256_sz, 480_sz, 202_sz }) {
+                testBatchAgainstSingle<float>(size, numChannels);
+                testBatchAgainstSingle<double>(size, numChannels);
+            }
+            for (const auto size : { 1_sz, 256_sz, 480_sz, 97_sz }) {
+                testBatchAgainstSingle<std::complex<float>>(size, numChannels);
+                testBatchAgainstSingle<std::complex<double>>(size, numChannels);
+            }
+        }
+    }
+
+    TEST_CASE("Test Alternate Entry Points") {
+        for (const auto size : { 2_sz, 64_sz, 480_sz, 202_sz }) {
+            testAlternateEntryPoints<float>(size);
+            testAlternateEntryPoints<double>(size);
+        }
+        for (const auto size : { 1_sz, 64_sz, 480_sz, 97_sz }) {
+            testAlternateEntryPoints<std::complex<float>>(size);
+            testAlternateEntryPoints<std::complex<double>>(size);
+        }
+    }
+
+    TEST_CASE("Test Shared Setup Lifetime") {
+        // Engines of the same size share their setup - make sure one outliving another still has valid data, and that a fresh one picks it up again.
+        for (const auto size : { 512_sz, 480_sz, 202_sz }) {
+            auto first = std::make_unique<dsp::spectral::FFT<float>>(dsp::spectral::FFTSize{ size });
+            dsp::spectral::FFT<float> second{ dsp::spectral::FFTSize{ size } };
+            first.reset();
+            compareAgainstNaiveDFT(second);
+            dsp::spectral::FFT<float> third{ dsp::spectral::FFTSize{ size } };
+            compareAgainstNaiveDFT(third);
+        }
+    }
+
+} // namespace marvin::testing
@@ -0,0 +1,162 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include <marvin/dsp/spectral/marvin_Filterbank.h>
+#include <marvin/math/marvin_Conversions.h>
+#include <marvin/library/marvin_Literals.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+namespace marvin::testing {
+    namespace {
+        [[nodiscard]] std::vector<float> generateFilterbankFrame(size_t size, std::mt19937& rng) {
+            std::uniform_real_distribution<float> dist{ 0.0f, 1.0f };
+            std::vector<float> frame(size);
+            for (auto& x : frame) {
+                x = dist(rng);
+            }
+            return frame;
+        }
+
+        /*
+            Expands a band's sparse weights back out to the full number of bins.
+        */
+        template <FloatType SampleType>
+        [[nodiscard]] std::vector<SampleType> getDenseWeights(const dsp::spectral::Filterbank<SampleType>& filterbank, size_t band) {
+            std::vector<SampleType> dense(filterbank.getNumBins(), static_cast<SampleType>(0.0));
+            const auto weights = filterbank.getBandWeights(band);
+            std::copy(weights.begin(), weights.end(), dense.begin() + static_cast<std::ptrdiff_t>(filterbank.getBandStart(band)));
+            return dense;
+        }
+    } // namespace
+
+    TEST_CASE("Test Filterbank") {
+        SECTION("Mel band layout") {
+            dsp::spectral::Filterbank<double> filterbank;
+            filterbank.initialiseMel(16000.0, 512, 40, 0.0, 8000.0, false);
+            REQUIRE(filterbank.getNumBands() == 40);
+            REQUIRE(filterbank.getNumBins() == 257);
+            const auto binWidth = 16000.0 / 512.0;
+            const auto maxMel = math::hzToMel(8000.0);
+            std::vector<double> sum(filterbank.getNumBins(), 0.0);
+            for (auto band = 0_sz; band < filterbank.getNumBands(); ++band) {
+                const auto lower = math::melToHz(maxMel * static_cast<double>(band) / 41.0);
+                const auto centre = math::melToHz(maxMel * static_cast<double>(band + 1) / 41.0);
+                const auto upper = math::melToHz(maxMel * static_cast<double>(band + 2) / 41.0);
+                const auto dense = getDenseWeights(filterbank, band);
+                for (auto bin = 0_sz; bin < dense.size(); ++bin) {
+                    const auto frequency = static_cast<double>(bin) * binWidth;
+                    const auto expected = std::max(0.0, std::min((frequency - lower) / (centre - lower), (upper - frequency) / (upper - centre)));
+                    REQUIRE_THAT(dense[bin], Catch::Matchers::WithinAbs(expected, 1e-9));
+                    sum[bin] += dense[bin];
+                }
+                // Sparse, with no zeros stored at either end.
+                const auto weights = filterbank.getBandWeights(band);
+                REQUIRE(weights.front() > 0.0);
+                REQUIRE(weights.back() > 0.0);
+            }
+            // Overlapping triangles sum to 1 between the first and last band centres.
+            const auto firstCentre = static_cast<size_t>(std::ceil(math::melToHz(maxMel / 41.0) / binWidth));
+            const auto lastCentre = static_cast<size_t>(std::floor(math::melToHz(maxMel * 40.0 / 41.0) / binWidth));
+            for (auto bin = firstCentre; bin <= lastCentre; ++bin) {
+                REQUIRE_THAT(sum[bin], Catch::Matchers::WithinAbs(1.0, 1e-9));
+            }
+        }
+
+        SECTION("Mel normalisation") {
+            dsp::spectral::Filterbank<double> filterbank;
+            filterbank.initialiseMel(44100.0, 2048, 64, 20.0, 16000.0, true);
+            const auto maxMel = math::hzToMel(16000.0);
+            const auto minMel = math::hzToMel(20.0);
+            for (const auto band : { 20_sz, 40_sz, 63_sz }) {
+                const auto lower = math::melToHz(minMel + (maxMel - minMel) * static_cast<double>(band) / 65.0);
+                const auto upper = math::melToHz(minMel + (maxMel - minMel) * static_cast<double>(band + 2) / 65.0);
+                // Area (in Hz) of each triangle is ~1.
+                auto area = 0.0;
+                for (const auto weight : filterbank.getBandWeights(band)) {
+                    area += weight * (44100.0 / 2048.0);
+                }
+                REQUIRE_THAT(area, Catch::Matchers::WithinRel(1.0, 0.05));
+                REQUIRE(*std::max_element(filterbank.getBandWeights(band).begin(), filterbank.getBandWeights(band).end()) <= 2.0 / (upper - lower));
+            }
+        }
+
+        SECTION("Process matches dense weights") {
+            std::mt19937 rng{ 42 };
+            dsp::spectral::Filterbank<float> filterbank;
+            filterbank.initialiseMel(48000.0, 1024, 80, 30.0, 20000.0);
+            const auto frame = generateFilterbankFrame(filterbank.getNumBins(), rng);
+            std::vector<float> bands(filterbank.getNumBands());
+            filterbank.process(frame, bands);
+            for (auto band = 0_sz; band < bands.size(); ++band) {
+                const auto dense = getDenseWeights(filterbank, band);
+                auto expected = 0.0;
+                for (auto bin = 0_sz; bin < frame.size(); ++bin) {
+                    expected += static_cast<double>(frame[bin] * dense[bin]);
+                }
+                REQUIRE_THAT(bands[band], Catch::Matchers::WithinRel(static_cast<float>(expected), 1e-4f));
+            }
+        }
+
+        SECTION("Batch matches single frames") {
+            std::mt19937 rng{ 1234 };
+            dsp::spectral::Filterbank<float> filterbank;
+            filterbank.initialiseMel(44100.0, 2048, 128, 0.0, 22050.0);
+            const auto numFrames = 37_sz;
+            std::vector<std::vector<float>> frames;
+            std::vector<std::vector<float>> batchBands(numFrames, std::vector<float>(filterbank.getNumBands()));
+            std::vector<float*> framePtrs, bandPtrs;
+            for (auto frame = 0_sz; frame < numFrames; ++frame) {
+                frames.emplace_back(generateFilterbankFrame(filterbank.getNumBins(), rng));
+            }
+            for (auto frame = 0_sz; frame < numFrames; ++frame) {
+                framePtrs.emplace_back(frames[frame].data());
+                bandPtrs.emplace_back(batchBands[frame].data());
+            }
+            filterbank.processBatch({ framePtrs.data(), numFrames, filterbank.getNumBins() }, { bandPtrs.data(), numFrames, filterbank.getNumBands() });
+            std::vector<float> bands(filterbank.getNumBands());
+            for (auto frame = 0_sz; frame < numFrames; ++frame) {
+                filterbank.process(frames[frame], bands);
+                for (auto band = 0_sz; band < bands.size(); ++band) {
+                    REQUIRE(batchBands[frame][band] == bands[band]);
+                }
+            }
+        }
+
+        SECTION("Constant-Q centres") {
+            dsp::spectral::Filterbank<double> filterbank;
+            const auto sampleRate = 44100.0;
+            const auto fftSize = 16384_sz;
+            filterbank.initialiseConstantQ(sampleRate, fftSize, 55.0, 12, 72);
+            REQUIRE(filterbank.getNumBands() == 72);
+            const auto binWidth = sampleRate / static_cast<double>(fftSize);
+            std::vector<double> frame(filterbank.getNumBins());
+            std::vector<double> bands(filterbank.getNumBands());
+            for (const auto band : { 0_sz, 12_sz, 30_sz, 71_sz }) {
+                // A single bin at the band's centre should land in that band, and (almost) nowhere else.
+                const auto centre = 55.0 * std::exp2(static_cast<double>(band) / 12.0);
+                std::fill(frame.begin(), frame.end(), 0.0);
+                frame[static_cast<size_t>(std::round(centre / binWidth))] = 1.0;
+                filterbank.process(frame, bands);
+                const auto loudest = std::distance(bands.begin(), std::max_element(bands.begin(), bands.end()));
+                REQUIRE(static_cast<size_t>(loudest) == band);
+            }
+            // Every band gets at least one bin, even where they're narrower than the FFT's resolution.
+            dsp::spectral::Filterbank<double> coarse;
+            coarse.initialiseConstantQ(sampleRate, 1024, 40.0, 24, 100);
+            for (auto band = 0_sz; band < coarse.getNumBands(); ++band) {
+                REQUIRE(!coarse.getBandWeights(band).empty());
+            }
+        }
+    }
+} // namespace marvin::testing
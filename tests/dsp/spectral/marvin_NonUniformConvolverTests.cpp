@@ -0,0 +1,119 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include <marvin/dsp/spectral/marvin_NonUniformConvolver.h>
+#include <marvin/library/marvin_Literals.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "marvin_TestHelpers.h"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+namespace marvin::testing {
+    namespace {
+        /*
+            Processes `signal` in chunks cycling through `chunkSizes`, and checks the result against a direct convolution.
+        */
+        template <FloatType SampleType>
+        void testNonUniformAgainstDirect(size_t blockSize, size_t irSize, size_t expectedStages, const std::vector<size_t>& chunkSizes, bool raiseWorkerPriority = false) {
+            const auto impulseResponse = generateNoise<SampleType>(irSize);
+            const auto signal = generateNoise<SampleType>(irSize + blockSize * 3 + 17);
+            const auto expected = directConvolution(signal, impulseResponse);
+            dsp::spectral::NonUniformConvolver<SampleType> convolver;
+            convolver.initialise(blockSize, impulseResponse, raiseWorkerPriority);
+            REQUIRE(convolver.getNumStages() == expectedStages);
+            auto processed = signal;
+            auto position = 0_sz;
+            for (auto chunk = 0_sz; position < processed.size(); ++chunk) {
+                const auto size = std::min<size_t>(chunkSizes[chunk % chunkSizes.size()], processed.size() - position);
+                convolver.process({ processed.data() + position, size });
+                position += size;
+            }
+            // Noise is in [-1, 1], so the output grows with sqrt(irSize).
+            const auto tolerance = std::sqrt(static_cast<SampleType>(irSize)) * (std::is_same_v<SampleType, float> ? static_cast<SampleType>(1e-5) : static_cast<SampleType>(1e-12));
+            for (auto i = 0_sz; i < processed.size(); ++i) {
+                REQUIRE_THAT(processed[i], Catch::Matchers::WithinAbs(expected[i], tolerance));
+            }
+        }
+    } // namespace
+
+    TEST_CASE("Test NonUniformConvolver") {
+        SECTION("Against direct convolution") {
+            for (const auto& chunkSizes : std::vector<std::vector<size_t>>{ { 16 }, { 1 }, { 7, 64, 200, 13 } }) {
+                // Head, first stage, and two background stages (the last one only partly filled).
+                testNonUniformAgainstDirect<float>(16, 5000, 3, chunkSizes);
+                testNonUniformAgainstDirect<double>(16, 5000, 3, chunkSizes);
+                // Head and first stage only, and head only.
+                testNonUniformAgainstDirect<float>(16, 200, 1, chunkSizes);
+                testNonUniformAgainstDirect<double>(16, 10, 0, chunkSizes);
+            }
+        }
+
+        SECTION("Raised worker priority") {
+            // Opt-in, and best effort - the output's the same whether or not the platform lets the workers have it.
+            testNonUniformAgainstDirect<float>(16, 5000, 3, { 7, 64, 200, 13 }, true);
+        }
+
+        SECTION("Zero latency impulse") {
+            const auto impulseResponse = generateNoise<float>(3000);
+            dsp::spectral::NonUniformConvolver<float> convolver;
+            convolver.initialise(32, impulseResponse);
+            std::vector<float> impulse(4000, 0.0f);
+            impulse[0] = 1.0f;
+            convolver.process(impulse);
+            for (auto i = 0_sz; i < impulse.size(); ++i) {
+                REQUIRE_THAT(impulse[i], Catch::Matchers::WithinAbs(i < impulseResponse.size() ? impulseResponse[i] : 0.0f, 1e-5));
+            }
+        }
+
+        SECTION("Reset") {
+            const auto impulseResponse = generateNoise<double>(2000);
+            dsp::spectral::NonUniformConvolver<double> convolver;
+            convolver.initialise(16, impulseResponse);
+            auto noise = generateNoise<double>(1000);
+            convolver.process(noise);
+            convolver.reset();
+            REQUIRE(convolver.getNumMissedDeadlines() == 0);
+            std::vector<double> silence(3000, 0.0);
+            convolver.process(silence);
+            for (const auto x : silence) {
+                REQUIRE_THAT(x, Catch::Matchers::WithinAbs(0.0, 1e-12));
+            }
+        }
+
+        SECTION("Destroyed with a job in flight") {
+            // Exercises tearing down a background stage straight after it's been handed a block - most useful under a thread sanitizer.
+            const auto impulseResponse = generateNoise<float>(5000);
+            // Exactly one of the first background stage's blocks.
+            auto noise = generateNoise<float>(128);
+            for (auto i = 0; i < 50; ++i) {
+                dsp::spectral::NonUniformConvolver<float> convolver;
+                convolver.initialise(16, impulseResponse);
+                convolver.process(noise);
+            }
+        }
+
+        SECTION("Reinitialise") {
+            dsp::spectral::NonUniformConvolver<float> convolver;
+            convolver.initialise(16, generateNoise<float>(5000));
+            REQUIRE(convolver.getNumStages() == 3);
+            const auto impulseResponse = generateNoise<float>(100);
+            convolver.initialise(16, impulseResponse);
+            REQUIRE(convolver.getNumStages() == 1);
+            std::vector<float> impulse(200, 0.0f);
+            impulse[0] = 1.0f;
+            convolver.process(impulse);
+            for (auto i = 0_sz; i < impulse.size(); ++i) {
+                REQUIRE_THAT(impulse[i], Catch::Matchers::WithinAbs(i < impulseResponse.size() ? impulseResponse[i] : 0.0f, 1e-5));
+            }
+        }
+    }
+} // namespace marvin::testing
@@ -0,0 +1,85 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include <marvin/dsp/spectral/marvin_STFT.h>
+#include <marvin/library/marvin_Literals.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "marvin_TestHelpers.h"
+#include <algorithm>
+#include <vector>
+namespace marvin::testing {
+    namespace {
+        /*
+            Runs `signal` through `stft` in chunks cycling through `chunkSizes`, and checks the output is the input delayed by the latency, scaled by `gain`.
+        */
+        template <FloatType SampleType>
+        void testReconstruction(dsp::spectral::STFT<SampleType>& stft, const std::vector<size_t>& chunkSizes, SampleType gain) {
+            const auto signal = generateNoise<SampleType>(stft.getFFTSize() * 6 + 37);
+            auto processed = signal;
+            auto position = 0_sz;
+            for (auto chunk = 0_sz; position < processed.size(); ++chunk) {
+                const auto size = std::min<size_t>(chunkSizes[chunk % chunkSizes.size()], processed.size() - position);
+                stft.process({ processed.data() + position, size });
+                position += size;
+            }
+            const auto latency = stft.getLatency();
+            for (auto i = 0_sz; i < processed.size(); ++i) {
+                const auto expected = i < latency ? static_cast<SampleType>(0.0) : signal[i - latency] * gain;
+                REQUIRE_THAT(processed[i], Catch::Matchers::WithinAbs(expected, 1e-4));
+            }
+        }
+    } // namespace
+
+    TEST_CASE("Test STFT") {
+        using WindowType = math::windows::WindowType;
+        SECTION("Unmodified reconstruction") {
+            for (const auto windowType : { WindowType::Hann, WindowType::Hamming, WindowType::BlackmanHarris, WindowType::Sine, WindowType::Tukey }) {
+                for (const auto& [fftSize, hopSize] : std::vector<std::pair<size_t, size_t>>{ { 64, 32 }, { 64, 16 }, { 128, 24 } }) {
+                    for (const auto& chunkSizes : std::vector<std::vector<size_t>>{ { 1 }, { 32 }, { 7, 100, 3 } }) {
+                        dsp::spectral::STFT<float> floatStft;
+                        floatStft.initialise(fftSize, hopSize, windowType);
+                        testReconstruction<float>(floatStft, chunkSizes, 1.0f);
+                        dsp::spectral::STFT<double> doubleStft;
+                        doubleStft.initialise(fftSize, hopSize, windowType);
+                        testReconstruction<double>(doubleStft, chunkSizes, 1.0);
+                    }
+                }
+            }
+        }
+
+        SECTION("Frame callback") {
+            dsp::spectral::STFT<double> stft;
+            stft.initialise(64, 16, WindowType::Hann);
+            REQUIRE(stft.getLatency() == 63);
+            REQUIRE(stft.getHopSize() == 16);
+            auto numFrames = 0_sz;
+            stft.setFrameCallback([&numFrames](std::span<std::complex<double>> spectrum) {
+                REQUIRE(spectrum.size() == 33);
+                for (auto& bin : spectrum) {
+                    bin *= 0.5;
+                }
+                ++numFrames;
+            });
+            testReconstruction<double>(stft, { 13, 64 }, 0.5);
+            REQUIRE(numFrames == (64 * 6 + 37) / 16);
+        }
+
+        SECTION("Custom window and reset") {
+            const std::vector<float> rectangular(32, 1.0f);
+            dsp::spectral::STFT<float> stft;
+            stft.initialise(32, 8, rectangular);
+            auto noise = generateNoise<float>(100);
+            stft.process(noise);
+            stft.reset();
+            testReconstruction<float>(stft, { 32 }, 1.0f);
+        }
+    }
+} // namespace marvin::testing
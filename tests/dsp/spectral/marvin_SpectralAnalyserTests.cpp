@@ -0,0 +1,113 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#include <marvin/dsp/spectral/marvin_SpectralAnalyser.h>
+#include <marvin/dsp/spectral/marvin_FFT.h>
+#include <marvin/library/marvin_Literals.h>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include "marvin_TestHelpers.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <vector>
+namespace marvin::testing {
+    TEST_CASE("Test SpectralAnalyser") {
+        using Analyser = dsp::spectral::SpectralAnalyser<double>;
+        SECTION("Magnitudes match a direct STFT") {
+            Analyser::Settings settings;
+            settings.fftSize = 256;
+            settings.hopSize = 100;
+            const auto input = generateNoise<double>(5000);
+            const auto analysis = Analyser::analyse(input, settings, 1);
+            REQUIRE(analysis.numBins == 129);
+            // Just enough frames to cover every sample.
+            REQUIRE(analysis.numFrames == 49);
+            REQUIRE((analysis.numFrames - 1) * settings.hopSize + settings.fftSize >= input.size());
+            REQUIRE((analysis.numFrames - 2) * settings.hopSize + settings.fftSize < input.size());
+            std::vector<double> window(settings.fftSize);
+            math::windows::fillPeriodic<double>(settings.windowType, window);
+            dsp::spectral::FFT<double> fft{ dsp::spectral::FFTSize{ settings.fftSize } };
+            std::vector<double> frame(settings.fftSize);
+            std::vector<std::complex<double>> spectrum(analysis.numBins);
+            for (const auto index : { 0_sz, 17_sz, 48_sz }) {
+                for (auto i = 0_sz; i < settings.fftSize; ++i) {
+                    const auto position = index * settings.hopSize + i;
+                    frame[i] = position < input.size() ? input[position] * window[i] : 0.0;
+                }
+                fft.forward(frame, spectrum);
+                const auto row = analysis.getFrame(index);
+                for (auto bin = 0_sz; bin < analysis.numBins; ++bin) {
+                    REQUIRE_THAT(row[bin], Catch::Matchers::WithinAbs(std::abs(spectrum[bin]), 1e-9));
+                }
+            }
+        }
+
+        SECTION("Threads give identical results") {
+            Analyser::Settings settings;
+            settings.fftSize = 512;
+            settings.hopSize = 128;
+            const auto input = generateNoise<double>(48000);
+            const auto reference = Analyser::analyse(input, settings, 1);
+            for (const auto numThreads : { 2_sz, 3_sz, 8_sz }) {
+                const auto analysis = Analyser::analyse(input, settings, numThreads);
+                REQUIRE(analysis.numFrames == reference.numFrames);
+                REQUIRE(analysis.magnitudes == reference.magnitudes);
+                REQUIRE(analysis.centroid == reference.centroid);
+                REQUIRE(analysis.flux == reference.flux);
+                REQUIRE(analysis.rolloff == reference.rolloff);
+                REQUIRE(analysis.rms == reference.rms);
+            }
+        }
+
+        SECTION("Features of a sine") {
+            Analyser::Settings settings;
+            settings.fftSize = 2048;
+            settings.hopSize = 512;
+            settings.sampleRate = 48000.0;
+            std::vector<double> sine(48000);
+            const auto frequency = 1000.0;
+            for (auto i = 0_sz; i < sine.size(); ++i) {
+                sine[i] = 0.5 * std::sin(2.0 * std::numbers::pi * frequency * static_cast<double>(i) / settings.sampleRate);
+            }
+            const auto analysis = Analyser::analyse(sine, settings, 4);
+            const auto binWidth = settings.sampleRate / static_cast<double>(settings.fftSize);
+            for (auto frame = 1_sz; frame + 1 < analysis.numFrames; ++frame) {
+                REQUIRE_THAT(analysis.centroid[frame], Catch::Matchers::WithinAbs(frequency, binWidth));
+                REQUIRE_THAT(analysis.rolloff[frame], Catch::Matchers::WithinAbs(frequency, binWidth));
+                REQUIRE_THAT(analysis.rms[frame], Catch::Matchers::WithinAbs(0.5 / std::sqrt(2.0), 1e-3));
+                // Steady state - nothing new after the first frame.
+                REQUIRE(analysis.flux[frame] < analysis.flux[0] * 0.01);
+            }
+        }
+
+        SECTION("Flux and silence") {
+            Analyser::Settings settings;
+            settings.fftSize = 256;
+            settings.hopSize = 256;
+            // Silence, then noise starting at frame 10.
+            std::vector<double> input(256 * 20, 0.0);
+            const auto noise = generateNoise<double>(256 * 10);
+            std::copy(noise.begin(), noise.end(), input.begin() + 256 * 10);
+            const auto analysis = Analyser::analyse(input, settings, 1);
+            REQUIRE(analysis.numFrames == 20);
+            for (auto frame = 0_sz; frame < 10; ++frame) {
+                REQUIRE(analysis.flux[frame] == 0.0);
+                REQUIRE(analysis.centroid[frame] == 0.0);
+                REQUIRE(analysis.rolloff[frame] == 0.0);
+                REQUIRE(analysis.rms[frame] == 0.0);
+            }
+            const auto loudest = std::distance(analysis.flux.begin(), std::max_element(analysis.flux.begin(), analysis.flux.end()));
+            REQUIRE(loudest == 10);
+            REQUIRE(Analyser::analyse({}, settings, 4).numFrames == 0);
+        }
+    }
+} // namespace marvin::testing
@@ -79,6 +79,15 @@ namespace marvin::testing {
         static_assert(FloatArrayLike<std::array<double, 16>>);
     }
 
+    TEST_CASE("Assert ComplexArrayLike") {
+        static_assert(!ComplexArrayLike<std::complex<float>>);
+        static_assert(!ComplexArrayLike<std::vector<float>>);
+        static_assert(!ComplexArrayLike<std::array<double, 16>>);
+        static_assert(ComplexArrayLike<std::span<std::complex<float>>>);
+        static_assert(ComplexArrayLike<std::vector<std::complex<double>>>);
+        static_assert(ComplexArrayLike<std::array<std::complex<float>, 16>>);
+    }
+
     TEST_CASE("Assert SmartPointerType") {
         static_assert(SmartPointerType<std::unique_ptr<float>>);
         static_assert(SmartPointerType<std::unique_ptr<double>>);
@@ -0,0 +1,56 @@
+// ========================================================================================================
+//  _______ _______ ______ ___ ___ _______ _______
+// |   |   |   _   |   __ \   |   |_     _|    |  |
+// |       |       |      <   |   |_|   |_|       |
+// |__|_|__|___|___|___|__|\_____/|_______|__|____|
+//
+// This file is part of the Marvin open source library and is licensed under the terms of the MIT License.
+//
+// ========================================================================================================
+
+#ifndef MARVIN_TESTHELPERS_H
+#define MARVIN_TESTHELPERS_H
+#include <marvin/dsp/oscillators/marvin_Oscillator.h>
+#include <marvin/library/marvin_Concepts.h>
+#include <marvin/library/marvin_Literals.h>
+#include <random>
+#include <vector>
+namespace marvin::testing {
+    /*
+        The random device shared by the helpers below.
+    */
+    [[nodiscard]] inline std::random_device& getTestRandomDevice() {
+        static std::random_device rd{};
+        return rd;
+    }
+
+    /*
+        `size` samples of white noise, in [-1, 1].
+    */
+    template <FloatType SampleType>
+    [[nodiscard]] std::vector<SampleType> generateNoise(size_t size) {
+        dsp::oscillators::NoiseOscillator<SampleType> noiseOsc{ getTestRandomDevice() };
+        std::vector<SampleType> noise(size);
+        for (auto& x : noise) {
+            x = noiseOsc();
+        }
+        return noise;
+    }
+
+    /*
+        Time domain convolution of `signal` with `impulseResponse`, truncated to the length of `signal`, and accumulated in double precision.
+    */
+    template <FloatType SampleType>
+    [[nodiscard]] std::vector<SampleType> directConvolution(const std::vector<SampleType>& signal, const std::vector<SampleType>& impulseResponse) {
+        std::vector<SampleType> result(signal.size(), static_cast<SampleType>(0.0));
+        for (auto n = 0_sz; n < signal.size(); ++n) {
+            double sum{ 0.0 };
+            for (auto k = 0_sz; k < impulseResponse.size() && k <= n; ++k) {
+                sum += static_cast<double>(impulseResponse[k]) * static_cast<double>(signal[n - k]);
+            }
+            result[n] = static_cast<SampleType>(sum);
+        }
+        return result;
+    }
+} // namespace marvin::testing
+#endif
@@ -12,6 +12,7 @@
 #include <marvin/utils/marvin_Random.h>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_all.hpp>
+#include <vector>
 namespace marvin::testing {
     static std::random_device s_rd;
     template <marvin::FloatType T>
@@ -65,5 +66,50 @@ namespace marvin::testing {
         }
     }
 
+    template <marvin::FloatType T>
+    void testBlockDbConversions() {
+        // Spans several of the block conversions' internal chunks, with silent values in each.
+        constexpr static auto size{ 601 };
+        std::vector<T> db(size), gain(size), blockRes(size);
+        for (auto i = 0; i < size; ++i) {
+            db[i] = static_cast<T>(-120.0) + static_cast<T>(i % 37) * static_cast<T>(3.5);
+            gain[i] = static_cast<T>(i % 37) / static_cast<T>(36.0);
+        }
+        math::dbToGain(blockRes, db);
+        for (auto i = 0; i < size; ++i) {
+            const auto expected = math::dbToGain(db[i]);
+            if (expected == static_cast<T>(0.0)) {
+                REQUIRE(blockRes[i] == static_cast<T>(0.0));
+            } else {
+                REQUIRE_THAT(blockRes[i], Catch::Matchers::WithinRel(expected, static_cast<T>(1e-5)));
+            }
+        }
+        math::gainToDb(blockRes, gain);
+        for (auto i = 0; i < size; ++i) {
+            REQUIRE_THAT(blockRes[i], Catch::Matchers::WithinRel(math::gainToDb(gain[i]), static_cast<T>(1e-5)));
+        }
+        // Aliased in-place conversions.
+        const auto dbCopy = db;
+        math::dbToGain(db.data(), db.data(), db.size());
+        for (auto i = 0; i < size; ++i) {
+            const auto expected = math::dbToGain(dbCopy[i]);
+            if (expected == static_cast<T>(0.0)) {
+                REQUIRE(db[i] == static_cast<T>(0.0));
+            } else {
+                REQUIRE_THAT(db[i], Catch::Matchers::WithinRel(expected, static_cast<T>(1e-5)));
+            }
+        }
+        const auto gainCopy = gain;
+        math::gainToDb(gain.data(), gain.data(), gain.size());
+        for (auto i = 0; i < size; ++i) {
+            REQUIRE_THAT(gain[i], Catch::Matchers::WithinRel(math::gainToDb(gainCopy[i]), static_cast<T>(1e-5)));
+        }
+    }
+
+    TEST_CASE("Test block dB conversions") {
+        testBlockDbConversions<float>();
+        testBlockDbConversions<double>();
+    }
+
 
 } // namespace marvin::testing
\ No newline at end of file
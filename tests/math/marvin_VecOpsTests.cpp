@@ -13,7 +13,13 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <complex>
 #include <span>
 #include <vector>
 namespace marvin::testing {
@@ -405,6 +411,392 @@ namespace marvin::testing {
         }
     }
 
+    template <FloatType T, size_t N>
+    void testUnalignedOffsets() {
+        // Offsets the start of each array by `offset` elements, so the SIMD paths have to handle both unaligned loads, and a scalar tail.
+        for (auto offset = 0_sz; offset < 4; ++offset) {
+            std::vector<T> lhs(N + offset), rhs(N + offset);
+            for (auto i = 0_sz; i < N + offset; ++i) {
+                lhs[i] = static_cast<T>(i + 1);
+                rhs[i] = static_cast<T>(2.0);
+            }
+            auto* lhsPtr = lhs.data() + offset;
+            const auto* rhsPtr = rhs.data() + offset;
+            math::vecops::add(lhsPtr, rhsPtr, N);
+            math::vecops::multiply(lhsPtr, rhsPtr, N);
+            math::vecops::subtract(lhsPtr, static_cast<T>(1.0), N);
+            math::vecops::divide(lhsPtr, static_cast<T>(0.5), N);
+            for (auto i = 0_sz; i < N; ++i) {
+                const auto original = static_cast<T>(i + offset + 1);
+                const auto expected = (((original + static_cast<T>(2.0)) * static_cast<T>(2.0)) - static_cast<T>(1.0)) / static_cast<T>(0.5);
+                REQUIRE_THAT(lhsPtr[i], Catch::Matchers::WithinRel(expected));
+            }
+        }
+    }
+
+    template <FloatType T, size_t N>
+    void testOutOfPlace() {
+        std::string typeStr{ getTypeName<T>() };
+        SECTION(fmt::format("std::vector<{}>, N = {}", typeStr, N)) {
+            std::vector<T> lhs(N), rhs(N), dest(N);
+            for (auto i = 0_sz; i < N; ++i) {
+                lhs[i] = static_cast<T>(i + 1);
+                rhs[i] = static_cast<T>(2.0);
+            }
+            math::vecops::add(dest, lhs, rhs);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(lhs[i] + rhs[i]));
+            }
+            math::vecops::subtract(dest, lhs, rhs);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(lhs[i] - rhs[i]));
+            }
+            math::vecops::multiply(dest, lhs, rhs);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(lhs[i] * rhs[i]));
+            }
+            math::vecops::divide(dest, lhs, rhs);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(lhs[i] / rhs[i]));
+                REQUIRE_THAT(lhs[i], Catch::Matchers::WithinRel(static_cast<T>(i + 1)));
+            }
+        }
+        SECTION(fmt::format("{}*, N = {}", typeStr, N)) {
+            std::array<T, N> lhs, rhs;
+            std::fill(lhs.begin(), lhs.end(), static_cast<T>(3.0));
+            std::fill(rhs.begin(), rhs.end(), static_cast<T>(4.0));
+            // Aliased destination should behave like the in-place overloads.
+            math::vecops::subtract(rhs.data(), lhs.data(), rhs.data(), N);
+            for (const auto& el : rhs) {
+                REQUIRE_THAT(el, Catch::Matchers::WithinRel(static_cast<T>(-1.0)));
+            }
+        }
+    }
+
+    template <FloatType T, size_t N>
+    void testFused() {
+        std::string typeStr{ getTypeName<T>() };
+        std::vector<T> a(N), b(N), ramp(N), dest(N);
+        for (auto i = 0_sz; i < N; ++i) {
+            a[i] = static_cast<T>(i + 1);
+            b[i] = static_cast<T>(-2.0) * static_cast<T>(i);
+            ramp[i] = static_cast<T>(i) / static_cast<T>(N);
+        }
+        SECTION(fmt::format("copyWithGain, std::vector<{}>, N = {}", typeStr, N)) {
+            math::vecops::copyWithGain(dest, a, static_cast<T>(0.5));
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(a[i] * static_cast<T>(0.5)));
+            }
+        }
+        SECTION(fmt::format("multiplyAdd, std::vector<{}>, N = {}", typeStr, N)) {
+            std::fill(dest.begin(), dest.end(), static_cast<T>(1.0));
+            math::vecops::multiplyAdd(dest, a, static_cast<T>(0.25));
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(static_cast<T>(1.0) + a[i] * static_cast<T>(0.25)));
+            }
+            std::fill(dest.begin(), dest.end(), static_cast<T>(1.0));
+            math::vecops::multiplyAdd(dest, a, b);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(static_cast<T>(1.0) + a[i] * b[i]));
+            }
+        }
+        SECTION(fmt::format("addScaled, std::vector<{}>, N = {}", typeStr, N)) {
+            math::vecops::addScaled(dest, a, static_cast<T>(0.5), b, static_cast<T>(2.0));
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(a[i] * static_cast<T>(0.5) + b[i] * static_cast<T>(2.0)));
+            }
+        }
+        SECTION(fmt::format("crossfade, std::vector<{}>, N = {}", typeStr, N)) {
+            math::vecops::crossfade(dest, a, b, ramp);
+            for (auto i = 0_sz; i < N; ++i) {
+                const auto expected = a[i] * (static_cast<T>(1.0) - ramp[i]) + b[i] * ramp[i];
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(expected, static_cast<T>(1e-5)));
+            }
+            const auto original = a;
+            math::vecops::crossfade(a.data(), a.data(), b.data(), ramp.data(), N);
+            for (auto i = 0_sz; i < N; ++i) {
+                const auto expected = original[i] * (static_cast<T>(1.0) - ramp[i]) + b[i] * ramp[i];
+                REQUIRE_THAT(a[i], Catch::Matchers::WithinRel(expected, static_cast<T>(1e-5)));
+            }
+        }
+    }
+
+    template <FloatType T, size_t N>
+    void testReductions() {
+        std::string typeStr{ getTypeName<T>() };
+        std::vector<T> a(N), b(N);
+        for (auto i = 0_sz; i < N; ++i) {
+            a[i] = static_cast<T>((i % 7) + 1) * static_cast<T>(0.25);
+            b[i] = static_cast<T>(-0.5);
+        }
+        // Plant a negative peak somewhere in the middle, and a positive one of the same magnitude after it, to check the first index wins.
+        const auto peakIndex = N / 2;
+        a[peakIndex] = static_cast<T>(-10.0);
+        if (peakIndex + 1 < N) a[peakIndex + 1] = static_cast<T>(10.0);
+        T expectedSum{ 0.0 }, expectedDot{ 0.0 }, expectedSumOfSquares{ 0.0 };
+        for (auto i = 0_sz; i < N; ++i) {
+            expectedSum += a[i];
+            expectedDot += a[i] * b[i];
+            expectedSumOfSquares += a[i] * a[i];
+        }
+        SECTION(fmt::format("std::vector<{}>, N = {}", typeStr, N)) {
+            REQUIRE_THAT(math::vecops::sum(a), Catch::Matchers::WithinRel(expectedSum, static_cast<T>(1e-5)));
+            REQUIRE_THAT(math::vecops::dot(a, b), Catch::Matchers::WithinRel(expectedDot, static_cast<T>(1e-5)));
+            REQUIRE_THAT(math::vecops::sumOfSquares(a), Catch::Matchers::WithinRel(expectedSumOfSquares, static_cast<T>(1e-5)));
+            const auto expectedRms = std::sqrt(expectedSumOfSquares / static_cast<T>(N));
+            REQUIRE_THAT(math::vecops::rms(a), Catch::Matchers::WithinRel(expectedRms, static_cast<T>(1e-5)));
+            const auto [peak, index] = math::vecops::maxAbs(a);
+            REQUIRE_THAT(peak, Catch::Matchers::WithinRel(static_cast<T>(10.0)));
+            REQUIRE(index == peakIndex);
+            const auto range = math::vecops::minMax(a);
+            const auto [expectedMin, expectedMax] = std::minmax_element(a.begin(), a.end());
+            REQUIRE_THAT(range.min, Catch::Matchers::WithinRel(*expectedMin));
+            REQUIRE_THAT(range.max, Catch::Matchers::WithinRel(*expectedMax));
+        }
+        SECTION(fmt::format("Deterministic, {}*, N = {}", typeStr, N)) {
+            const auto first = math::vecops::sum(a.data(), N);
+            for (auto repeat = 0; repeat < 4; ++repeat) {
+                REQUIRE(math::vecops::sum(a.data(), N) == first);
+            }
+        }
+        SECTION(fmt::format("Empty, {}*", typeStr)) {
+            REQUIRE(math::vecops::sum(a.data(), 0) == static_cast<T>(0.0));
+            REQUIRE(math::vecops::rms(a.data(), 0) == static_cast<T>(0.0));
+            REQUIRE(math::vecops::maxAbs(a.data(), 0).index == 0);
+        }
+    }
+
+    template <FloatType T, size_t N>
+    void testTranscendentals() {
+        std::string typeStr{ getTypeName<T>() };
+        const auto tolerance = std::is_same_v<T, float> ? static_cast<T>(1e-6) : static_cast<T>(1e-12);
+        std::vector<T> src(N), positive(N), exponent(N), dest(N);
+        for (auto i = 0_sz; i < N; ++i) {
+            const auto t = static_cast<T>(i) / static_cast<T>(N);
+            src[i] = static_cast<T>(-8.0) + t * static_cast<T>(16.0);
+            positive[i] = static_cast<T>(1e-3) + t * static_cast<T>(100.0);
+            exponent[i] = static_cast<T>(-3.0) + t * static_cast<T>(6.0);
+        }
+        const auto checkRelative = [&](const std::vector<T>& input, auto&& fn, auto&& reference) {
+            fn(dest, input);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(reference(input[i]), tolerance));
+            }
+        };
+        const auto checkAbsolute = [&](const std::vector<T>& input, auto&& fn, auto&& reference) {
+            fn(dest, input);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinAbs(reference(input[i]), tolerance));
+            }
+        };
+        SECTION(fmt::format("std::vector<{}>, N = {}", typeStr, N)) {
+            checkRelative(src, [](auto& d, const auto& s) { math::vecops::exp(d, s); }, [](T x) { return std::exp(x); });
+            checkRelative(positive, [](auto& d, const auto& s) { math::vecops::log(d, s); }, [](T x) { return std::log(x); });
+            checkRelative(positive, [](auto& d, const auto& s) { math::vecops::log10(d, s); }, [](T x) { return std::log10(x); });
+            checkRelative(src, [](auto& d, const auto& s) { math::vecops::tanh(d, s); }, [](T x) { return std::tanh(x); });
+            checkAbsolute(src, [](auto& d, const auto& s) { math::vecops::sin(d, s); }, [](T x) { return std::sin(x); });
+            checkAbsolute(src, [](auto& d, const auto& s) { math::vecops::cos(d, s); }, [](T x) { return std::cos(x); });
+            math::vecops::pow(dest, positive, exponent);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(dest[i], Catch::Matchers::WithinRel(std::pow(positive[i], exponent[i]), tolerance * static_cast<T>(10.0)));
+            }
+        }
+        SECTION(fmt::format("In place, {}*, N = {}", typeStr, N)) {
+            auto copy = src;
+            math::vecops::tanh(copy.data(), copy.data(), N);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(copy[i], Catch::Matchers::WithinRel(std::tanh(src[i]), tolerance));
+            }
+        }
+    }
+
+    template <FloatType T, size_t N>
+    void testComplex() {
+        using Complex = std::complex<T>;
+        std::string typeStr{ getTypeName<T>() };
+        const auto tolerance = std::is_same_v<T, float> ? static_cast<T>(1e-5) : static_cast<T>(1e-12);
+        std::vector<Complex> a(N), b(N);
+        for (auto i = 0_sz; i < N; ++i) {
+            const auto t = static_cast<T>(i) + static_cast<T>(1.0);
+            a[i] = { t * static_cast<T>(0.5), -t };
+            b[i] = { static_cast<T>(2.0), t * static_cast<T>(0.25) };
+        }
+        const auto requireComplex = [tolerance](Complex actual, Complex expected) {
+            REQUIRE_THAT(actual.real(), Catch::Matchers::WithinRel(expected.real(), tolerance));
+            REQUIRE_THAT(actual.imag(), Catch::Matchers::WithinRel(expected.imag(), tolerance));
+        };
+        SECTION(fmt::format("Interleaved std::complex<{}>, N = {}", typeStr, N)) {
+            std::vector<Complex> dest(N);
+            math::vecops::multiply(dest, a, b);
+            for (auto i = 0_sz; i < N; ++i) {
+                requireComplex(dest[i], a[i] * b[i]);
+            }
+            std::fill(dest.begin(), dest.end(), Complex{ 1.0, 1.0 });
+            math::vecops::multiplyAdd(dest, a, b);
+            for (auto i = 0_sz; i < N; ++i) {
+                requireComplex(dest[i], Complex{ 1.0, 1.0 } + a[i] * b[i]);
+            }
+            std::fill(dest.begin(), dest.end(), Complex{ 1.0, 1.0 });
+            math::vecops::conjugateMultiplyAdd(dest, a, b);
+            for (auto i = 0_sz; i < N; ++i) {
+                requireComplex(dest[i], Complex{ 1.0, 1.0 } + a[i] * std::conj(b[i]));
+            }
+            std::vector<T> magnitudes(N), phases(N), magnitudesSquared(N);
+            math::vecops::magnitude(magnitudes, a);
+            math::vecops::magnitudeSquared(magnitudesSquared, a);
+            math::vecops::phase(phases, a);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(magnitudes[i], Catch::Matchers::WithinRel(std::abs(a[i]), tolerance));
+                REQUIRE_THAT(magnitudesSquared[i], Catch::Matchers::WithinRel(std::norm(a[i]), tolerance));
+                REQUIRE_THAT(phases[i], Catch::Matchers::WithinRel(std::arg(a[i]), tolerance));
+            }
+            math::vecops::polarToCartesian(dest, magnitudes, phases);
+            for (auto i = 0_sz; i < N; ++i) {
+                requireComplex(dest[i], a[i]);
+            }
+        }
+        SECTION(fmt::format("Split {}, N = {}", typeStr, N)) {
+            std::vector<T> aReal(N), aImag(N), bReal(N), bImag(N), destReal(N), destImag(N), res(N);
+            for (auto i = 0_sz; i < N; ++i) {
+                aReal[i] = a[i].real();
+                aImag[i] = a[i].imag();
+                bReal[i] = b[i].real();
+                bImag[i] = b[i].imag();
+            }
+            math::vecops::SplitComplex<T> splitA{ aReal.data(), aImag.data() };
+            math::vecops::SplitComplex<T> splitB{ bReal.data(), bImag.data() };
+            math::vecops::SplitComplex<T> splitDest{ destReal.data(), destImag.data() };
+            math::vecops::multiply(splitDest, splitA, splitB, N);
+            for (auto i = 0_sz; i < N; ++i) {
+                requireComplex({ destReal[i], destImag[i] }, a[i] * b[i]);
+            }
+            math::vecops::conjugateMultiplyAdd(splitDest, splitA, splitB, N);
+            for (auto i = 0_sz; i < N; ++i) {
+                requireComplex({ destReal[i], destImag[i] }, a[i] * b[i] + a[i] * std::conj(b[i]));
+            }
+            math::vecops::magnitude(res.data(), splitA, N);
+            for (auto i = 0_sz; i < N; ++i) {
+                REQUIRE_THAT(res[i], Catch::Matchers::WithinRel(std::abs(a[i]), tolerance));
+            }
+            math::vecops::phase(res.data(), splitB, N);
+            std::vector<T> magnitudes(N);
+            math::vecops::magnitude(magnitudes.data(), splitB, N);
+            math::vecops::polarToCartesian(splitDest, magnitudes.data(), res.data(), N);
+            for (auto i = 0_sz; i < N; ++i) {
+                requireComplex({ destReal[i], destImag[i] }, b[i]);
+            }
+        }
+    }
+
+    template <FloatType T>
+    void testInterleaving(size_t numChannels, size_t numSamples) {
+        std::string typeStr{ getTypeName<T>() };
+        SECTION(fmt::format("{}, {} channels, {} samples", typeStr, numChannels, numSamples)) {
+            std::vector<std::vector<T>> channels(numChannels, std::vector<T>(numSamples)), roundTrip(numChannels, std::vector<T>(numSamples));
+            std::vector<T*> channelPtrs, roundTripPtrs;
+            for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                for (auto i = 0_sz; i < numSamples; ++i) {
+                    channels[channel][i] = static_cast<T>(channel * 1000 + i);
+                }
+                channelPtrs.emplace_back(channels[channel].data());
+                roundTripPtrs.emplace_back(roundTrip[channel].data());
+            }
+            containers::BufferView<T> source{ channelPtrs.data(), numChannels, numSamples };
+            containers::BufferView<T> dest{ roundTripPtrs.data(), numChannels, numSamples };
+            std::vector<T> interleaved(numChannels * numSamples);
+            math::vecops::interleave(interleaved.data(), source);
+            for (auto i = 0_sz; i < numSamples; ++i) {
+                for (auto channel = 0_sz; channel < numChannels; ++channel) {
+                    REQUIRE(interleaved[i * numChannels + channel] == channels[channel][i]);
+                }
+            }
+            math::vecops::deinterleave(dest, interleaved.data());
+            REQUIRE(roundTrip == channels);
+            // Views are passed by value, so a temporary one works too.
+            for (auto& channel : roundTrip) {
+                std::fill(channel.begin(), channel.end(), static_cast<T>(0.0));
+            }
+            math::vecops::deinterleave(containers::BufferView<T>{ roundTripPtrs.data(), numChannels, numSamples }, interleaved.data());
+            REQUIRE(roundTrip == channels);
+        }
+    }
+
+    template <FloatType T>
+    void testSampleConversions(math::vecops::SampleFormat format) {
+        using math::vecops::SampleFormat;
+        std::string typeStr{ getTypeName<T>() };
+        const auto bytesPerSample = math::vecops::getBytesPerSample(format);
+        const auto fullScale = static_cast<T>(std::uint64_t{ 1 } << (bytesPerSample * 8 - 1));
+        const auto lsb = static_cast<T>(1.0) / fullScale;
+        SECTION(fmt::format("{}, {} bytes per sample", typeStr, bytesPerSample)) {
+            constexpr static auto numSamples{ 37 };
+            std::vector<T> src(numSamples), roundTrip(numSamples);
+            for (auto i = 0; i < numSamples; ++i) {
+                src[i] = static_cast<T>(-1.0) + static_cast<T>(i) * (static_cast<T>(2.0) / static_cast<T>(numSamples - 1));
+            }
+            // Out of range values should be clipped, not wrapped.
+            src[numSamples - 1] = static_cast<T>(1.5);
+            std::vector<std::byte> packed(numSamples * bytesPerSample);
+            math::vecops::floatToInt(packed.data(), format, src.data(), numSamples);
+            math::vecops::intToFloat(roundTrip.data(), packed.data(), format, numSamples);
+            for (auto i = 0; i < numSamples - 1; ++i) {
+                REQUIRE_THAT(roundTrip[i], Catch::Matchers::WithinAbs(src[i], static_cast<double>(lsb)));
+            }
+            REQUIRE(roundTrip[0] == static_cast<T>(-1.0));
+            REQUIRE(roundTrip[numSamples - 1] < static_cast<T>(1.0));
+            // float can't represent every int32, so the clip point for float -> int32 is a little under full scale.
+            REQUIRE_THAT(roundTrip[numSamples - 1], Catch::Matchers::WithinAbs(1.0, static_cast<double>(std::max(lsb, std::numeric_limits<T>::epsilon()))));
+
+            math::vecops::TriangularDither dither;
+            math::vecops::floatToInt(packed.data(), format, src.data(), numSamples, dither);
+            math::vecops::intToFloat(roundTrip.data(), packed.data(), format, numSamples);
+            for (auto i = 0; i < numSamples - 1; ++i) {
+                REQUIRE_THAT(roundTrip[i], Catch::Matchers::WithinAbs(src[i], static_cast<double>(lsb * static_cast<T>(2.0))));
+            }
+        }
+        SECTION(fmt::format("Interleaved {}, {} bytes per sample", typeStr, bytesPerSample)) {
+            constexpr static auto numChannels{ 3 }, numSamples{ 19 };
+            std::vector<std::vector<T>> channels(numChannels, std::vector<T>(numSamples)), roundTrip(numChannels, std::vector<T>(numSamples));
+            std::vector<T*> channelPtrs, roundTripPtrs;
+            for (auto channel = 0; channel < numChannels; ++channel) {
+                for (auto i = 0; i < numSamples; ++i) {
+                    channels[channel][i] = static_cast<T>(channel - 1) * static_cast<T>(0.25) + static_cast<T>(i) * lsb;
+                }
+                channelPtrs.emplace_back(channels[channel].data());
+                roundTripPtrs.emplace_back(roundTrip[channel].data());
+            }
+            containers::BufferView<T> source{ channelPtrs.data(), numChannels, numSamples };
+            std::vector<std::byte> packed(numChannels * numSamples * bytesPerSample);
+            math::vecops::interleave(packed.data(), format, source);
+            math::vecops::deinterleave(containers::BufferView<T>{ roundTripPtrs.data(), numChannels, numSamples }, packed.data(), format);
+            for (auto channel = 0; channel < numChannels; ++channel) {
+                for (auto i = 0; i < numSamples; ++i) {
+                    REQUIRE_THAT(roundTrip[channel][i], Catch::Matchers::WithinAbs(channels[channel][i], static_cast<double>(lsb)));
+                }
+            }
+            // The second frame's first sample should be channel 0, sample 1.
+            std::vector<T> single(1);
+            math::vecops::intToFloat(single.data(), packed.data() + numChannels * bytesPerSample, format, 1);
+            REQUIRE_THAT(single[0], Catch::Matchers::WithinAbs(channels[0][1], static_cast<double>(lsb)));
+        }
+    }
+
+    template <FloatType T, size_t N>
+    void benchmarkMultiplyAdd() {
+        const auto typeName = getTypeName<T>();
+        std::array<T, N> bus, src, tmp;
+        std::fill(bus.begin(), bus.end(), static_cast<T>(0.0));
+        std::fill(src.begin(), src.end(), static_cast<T>(1.0));
+        BENCHMARK(fmt::format("Copy, Multiply, Add: std::array<{}, {}>", typeName, N)) {
+            math::vecops::copy(tmp, src);
+            math::vecops::multiply(tmp, static_cast<T>(0.5));
+            math::vecops::add(bus, tmp);
+        };
+        std::fill(bus.begin(), bus.end(), static_cast<T>(0.0));
+        BENCHMARK(fmt::format("MultiplyAdd: std::array<{}, {}>", typeName, N)) {
+            math::vecops::multiplyAdd(bus, src, static_cast<T>(0.5));
+        };
+    }
 
     TEST_CASE("Test VecOps") {
 
@@ -503,5 +895,67 @@ namespace marvin::testing {
             testCopy<float, 17>();
             testCopy<double, 17>();
         }
+        SECTION("Test Unaligned Offsets") {
+            testUnalignedOffsets<float, 1>();
+            testUnalignedOffsets<double, 1>();
+            testUnalignedOffsets<float, 37>();
+            testUnalignedOffsets<double, 37>();
+            testUnalignedOffsets<float, 1024>();
+            testUnalignedOffsets<double, 1024>();
+        }
+        SECTION("Test Out Of Place") {
+            testOutOfPlace<float, 5>();
+            testOutOfPlace<double, 5>();
+            testOutOfPlace<float, 17>();
+            testOutOfPlace<double, 17>();
+        }
+        SECTION("Test Fused") {
+            testFused<float, 5>();
+            testFused<double, 5>();
+            testFused<float, 17>();
+            testFused<double, 17>();
+            testFused<float, 1024>();
+            testFused<double, 1024>();
+        }
+        SECTION("Test Reductions") {
+            testReductions<float, 1>();
+            testReductions<double, 1>();
+            testReductions<float, 17>();
+            testReductions<double, 17>();
+            testReductions<float, 1023>();
+            testReductions<double, 1023>();
+        }
+        SECTION("Test Transcendentals") {
+            testTranscendentals<float, 3>();
+            testTranscendentals<double, 3>();
+            testTranscendentals<float, 257>();
+            testTranscendentals<double, 257>();
+        }
+        SECTION("Test Complex") {
+            testComplex<float, 3>();
+            testComplex<double, 3>();
+            testComplex<float, 67>();
+            testComplex<double, 67>();
+        }
+        SECTION("Test Interleaving") {
+            // Below, at, and around the SIMD widths of the instruction sets the kernels can be dispatched to.
+            for (const auto numChannels : { 1, 2, 3, 4, 5, 6, 8, 11, 16, 17, 19 }) {
+                testInterleaving<float>(static_cast<size_t>(numChannels), 37);
+                testInterleaving<double>(static_cast<size_t>(numChannels), 37);
+                testInterleaving<float>(static_cast<size_t>(numChannels), 5);
+            }
+        }
+        SECTION("Test Sample Conversions") {
+            for (const auto format : { math::vecops::SampleFormat::Int16, math::vecops::SampleFormat::Int24, math::vecops::SampleFormat::Int32 }) {
+                testSampleConversions<float>(format);
+                testSampleConversions<double>(format);
+            }
+        }
+#if defined(MARVIN_ANALYSIS)
+        SECTION("Benchmark MultiplyAdd") {
+            benchmarkMultiplyAdd<float, 512>();
+            benchmarkMultiplyAdd<double, 512>();
+        }
+#endif
     }
 } // namespace marvin::testing
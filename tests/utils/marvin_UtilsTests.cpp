@@ -9,6 +9,7 @@
 // ========================================================================================================
 
 #include <marvin/utils/marvin_Utils.h>
+#include <marvin/utils/marvin_SIMDDispatch.h>
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include <iostream>
@@ -19,4 +20,12 @@ namespace marvin::testing {
         std::cout << *pathRes << "\n";
     }
 
+    TEST_CASE("Test getInstructionSet()") {
+        const auto instructionSet = utils::getInstructionSet();
+        REQUIRE(instructionSet == utils::getInstructionSet());
+#if defined(__x86_64__) || defined(_M_X64)
+        REQUIRE(instructionSet != utils::InstructionSet::Other);
+#endif
+    }
+
 }